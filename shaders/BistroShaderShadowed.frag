@@ -124,5 +124,6 @@ void main()
     vec3 ambient = (1.0 - metallic) * albedo * irradiance;
     
     vec3 finalColor = (directLighting + ambient) * ao + emissive;
-    out_FragColor = vec4(finalColor, 1.0);
+    // Opacity only matters for blended materials; the other queues draw without blending.
+    out_FragColor = vec4(finalColor, uMaterial.Mtl1.w * texDiffuse.a);
 }
\ No newline at end of file
@@ -0,0 +1,33 @@
+#version 460 core
+#include "Common/Common.shader"
+#include "Common/Instancing.shader"
+
+layout (location = 0) in vec3 position;   // mesh space
+layout (location = 1) in vec3 normal; 
+layout (location = 2) in vec3 tangent;
+layout (location = 3) in vec2 texCoord;
+
+out vec3 wPos;
+out vec3 wNormal;
+out vec2 uv;
+out vec4 PosLightMap;
+out mat3 TBN;          // Tangent, Bitangent, Normal matrix
+
+uniform mat4 u_ShadowMatrix;
+
+void main()
+{
+    mat4 model = InstanceModel();
+    mat3 normalMatrix = transpose(inverse(mat3(model)));
+
+    wPos = vec3(model * vec4(position, 1.0));
+    gl_Position = u_Proj * u_View * vec4(wPos, 1.0);
+    PosLightMap = u_ShadowMatrix * vec4(wPos, 1.0);
+    wNormal = normalize(normalMatrix * normal);
+    uv = texCoord;
+
+    vec3 T = normalize(normalMatrix * tangent);
+    vec3 N = wNormal;
+    vec3 B = normalize(cross(N, T));
+    TBN = mat3(T, B, N); 
+}
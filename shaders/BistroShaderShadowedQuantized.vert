@@ -0,0 +1,30 @@
+#version 460 core
+#include "Common/Common.shader"
+#include "Common/Quantization.shader"
+
+layout (location = 0) in vec4 position;   // unorm16
+layout (location = 1) in vec2 normal;     // octahedral snorm16
+layout (location = 2) in vec2 tangent;    // octahedral snorm16
+layout (location = 3) in vec2 texCoord;   // unorm16
+
+out vec3 wPos;
+out vec3 wNormal;
+out vec2 uv;
+out vec4 PosLightMap;
+out mat3 TBN;          // Tangent, Bitangent, Normal matrix
+
+uniform mat4 u_ShadowMatrix;
+
+void main()
+{
+    wPos = DecodePosition(position);
+    gl_Position = u_Proj * u_View * vec4(wPos, 1.0);
+    PosLightMap = u_ShadowMatrix * vec4(wPos, 1.0);
+    wNormal = OctDecode(normal);
+    uv = DecodeUV(texCoord);
+
+    vec3 T = OctDecode(tangent);
+    vec3 N = wNormal;
+    vec3 B = normalize(cross(N, T));
+    TBN = mat3(T, B, N); 
+}
@@ -0,0 +1,21 @@
+// Per-instance transforms for instanced mesh layouts (see renderer::InstanceData).
+// Vertices arrive in mesh space; each multi-draw command's instances start at baseInstance.
+struct InstanceData
+{
+	mat4 model;
+	uvec4 info;   // x = object index within the batch
+};
+
+layout(std430, binding = 3) readonly buffer InstanceBuffer
+{
+	InstanceData u_Instances[];
+};
+
+#define INSTANCE_INDEX (gl_BaseInstance + gl_InstanceID)
+// Quantization.shader indexes its per-object table with this when included afterwards.
+#define OBJECT_INDEX (u_Instances[INSTANCE_INDEX].info.x)
+
+mat4 InstanceModel()
+{
+	return u_Instances[INSTANCE_INDEX].model;
+}
@@ -0,0 +1,39 @@
+// Dequantization for quantized vertex layouts (see graphics::VertexFormat).
+// Positions/UVs arrive as unorm16 relative to per-object ranges, directions as octahedral snorm16.
+struct ObjectDequant
+{
+	vec4 positionOffset;
+	vec4 positionScale;
+	vec4 uvOffsetScale;   // xy = offset, zw = scale
+};
+
+layout(std430, binding = 2) readonly buffer ObjectDequantBuffer
+{
+	ObjectDequant u_ObjectDequant[];
+};
+
+// Each multi-draw command stores its object index in baseInstance
+// (instanced layouts define OBJECT_INDEX in Instancing.shader instead).
+#ifndef OBJECT_INDEX
+#define OBJECT_INDEX gl_BaseInstance
+#endif
+
+vec3 DecodePosition(vec4 q)
+{
+	ObjectDequant d = u_ObjectDequant[OBJECT_INDEX];
+	return d.positionOffset.xyz + d.positionScale.xyz * q.xyz;
+}
+
+vec2 DecodeUV(vec2 q)
+{
+	vec4 os = u_ObjectDequant[OBJECT_INDEX].uvOffsetScale;
+	return os.xy + os.zw * q;
+}
+
+vec3 OctDecode(vec2 e)
+{
+	vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+	float t = max(-n.z, 0.0);
+	n.xy += mix(vec2(t), vec2(-t), greaterThanEqual(n.xy, vec2(0.0)));
+	return normalize(n);
+}
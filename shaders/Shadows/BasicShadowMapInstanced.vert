@@ -0,0 +1,11 @@
+#version 460 core
+#include "../Common/Instancing.shader"
+
+layout(location = 0) in vec3 position; // mesh space, see Common/Instancing.shader
+
+uniform mat4 u_ShadowMatrix; // Bias * LightProj * LightView
+
+void main()
+{
+    gl_Position = u_ShadowMatrix * InstanceModel() * vec4(position, 1.0);
+}
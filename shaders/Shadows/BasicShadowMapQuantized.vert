@@ -0,0 +1,11 @@
+#version 460 core
+#include "../Common/Quantization.shader"
+
+layout(location = 0) in vec4 position; // unorm16, see Common/Quantization.shader
+
+uniform mat4 u_ShadowMatrix; // Bias * LightProj * LightView
+
+void main()
+{
+    gl_Position = u_ShadowMatrix * vec4(DecodePosition(position), 1.0);
+}
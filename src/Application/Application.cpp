@@ -4,6 +4,7 @@
 #include "Scene/Screen.h"
 #include "AllTests.h"
 #include "Resources/ResourceManager.h"
+#include "Graphics/Buffers/PersistentRingBuffer.h"
 #include "Utilities/Logger.h"
 #include "Utilities/ProfilerMacros.h"
 
@@ -45,6 +46,7 @@ bool Application::Init() {
         testMenu_->RegisterTest("Flipbook", []() { return std::make_shared<TestFlipBookEffect>(); });
         testMenu_->RegisterTest("PBRHelmet", []() { return std::make_shared<TestDamagedHelmet>(); });
         testMenu_->RegisterTest("TestShadows", []() { return std::make_shared<TestShadows>(); });
+        testMenu_->RegisterTest("BatchBenchmark", []() { return std::make_shared<TestBatchBenchmark>(); });
         testManager_.RegisterTest("Test Menu", [this]() {
             return std::make_shared<TestMenuTest>(testMenu_);
             });
@@ -107,6 +109,7 @@ void Application::UpdateAndRenderFrame() {
 
     PROFILE_BLOCK("SwapBuffers", Blue);
     glfwSwapBuffers(window_);
+    graphics::PersistentRingBuffer::NextFrame();
 
     PROFILE_BLOCK("UpdateInputManager", Blue);
     inputManager_.Update();
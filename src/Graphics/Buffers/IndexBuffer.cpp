@@ -8,14 +8,39 @@ namespace graphics {
     IndexBuffer::IndexBuffer(std::span<const GLuint> data, GLenum usage)
         : count_(static_cast<GLsizei>(data.size())),
         size_(data.size_bytes()),
-        usage_(usage)
+        usage_(usage),
+        indexType_(GL_UNSIGNED_INT)
     {
+        Create(data.data());
+        Logger::GetLogger()->info("Created IndexBuffer (ID={}) with Count={}.", rendererId_, count_);
+    }
+
+    IndexBuffer::IndexBuffer(std::span<const GLushort> data, GLenum usage)
+        : count_(static_cast<GLsizei>(data.size())),
+        size_(data.size_bytes()),
+        usage_(usage),
+        indexType_(GL_UNSIGNED_SHORT)
+    {
+        Create(data.data());
+        Logger::GetLogger()->info("Created 16-bit IndexBuffer (ID={}) with Count={}.", rendererId_, count_);
+    }
+
+    IndexBuffer::IndexBuffer(std::size_t capacity, GLenum usage, GLenum indexType)
+        : count_(static_cast<GLsizei>(capacity)),
+        size_(capacity * (indexType == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint))),
+        usage_(usage),
+        indexType_(indexType)
+    {
+        Create(nullptr);
+        Logger::GetLogger()->info("Created IndexBuffer (ID={}) with Capacity={}.", rendererId_, count_);
+    }
+
+    void IndexBuffer::Create(const void* data) {
         GLCall(glCreateBuffers(1, &rendererId_));
         if (rendererId_ == 0) {
             throw std::runtime_error("Failed to create Index Buffer Object.");
         }
-        GLCall(glNamedBufferData(rendererId_, size_, data.data(), usage_));
-        Logger::GetLogger()->info("Created IndexBuffer (ID={}) with Count={}.", rendererId_, count_);
+        GLCall(glNamedBufferData(rendererId_, size_, data, usage_));
     }
 
     IndexBuffer::~IndexBuffer() {
@@ -29,7 +54,8 @@ namespace graphics {
         : rendererId_(other.rendererId_),
         count_(other.count_),
         size_(other.size_),
-        usage_(other.usage_)
+        usage_(other.usage_),
+        indexType_(other.indexType_)
     {
         other.rendererId_ = 0;
         other.count_ = 0;
@@ -45,6 +71,7 @@ namespace graphics {
             count_ = other.count_;
             size_ = other.size_;
             usage_ = other.usage_;
+            indexType_ = other.indexType_;
             other.rendererId_ = 0;
             other.count_ = 0;
             other.size_ = 0;
@@ -61,11 +88,37 @@ namespace graphics {
     }
 
     void IndexBuffer::UpdateData(std::span<const GLuint> data, GLintptr offset) {
-        if (offset + static_cast<GLintptr>(data.size_bytes()) > static_cast<GLintptr>(size_)) {
+        if (indexType_ != GL_UNSIGNED_INT) {
+            throw std::runtime_error("IndexBuffer::UpdateData: 32-bit data for a 16-bit buffer.");
+        }
+        Upload(data.data(), data.size_bytes(), offset);
+    }
+
+    void IndexBuffer::UpdateData(std::span<const GLushort> data, GLintptr offset) {
+        if (indexType_ != GL_UNSIGNED_SHORT) {
+            throw std::runtime_error("IndexBuffer::UpdateData: 16-bit data for a 32-bit buffer.");
+        }
+        Upload(data.data(), data.size_bytes(), offset);
+    }
+
+    void IndexBuffer::UpdateBytes(std::span<const std::byte> data, GLintptr offset) {
+        Upload(data.data(), data.size_bytes(), offset);
+    }
+
+    void IndexBuffer::Upload(const void* data, size_t bytes, GLintptr offset) {
+        if (offset + static_cast<GLintptr>(bytes) > static_cast<GLintptr>(size_)) {
             throw std::runtime_error("IndexBuffer::UpdateData: Data exceeds buffer size.");
         }
-        GLCall(glNamedBufferSubData(rendererId_, offset, data.size_bytes(), data.data()));
+        GLCall(glNamedBufferSubData(rendererId_, offset, bytes, data));
         Logger::GetLogger()->debug("Updated IndexBuffer (ID={}) at offset={} with new data.", rendererId_, offset);
     }
 
+    void IndexBuffer::CopyFrom(const IndexBuffer& source, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+        if (readOffset + size > static_cast<GLintptr>(source.size_) ||
+            writeOffset + size > static_cast<GLintptr>(size_)) {
+            throw std::runtime_error("IndexBuffer::CopyFrom: Range exceeds buffer size.");
+        }
+        GLCall(glCopyNamedBufferSubData(source.rendererId_, rendererId_, readOffset, writeOffset, size));
+    }
+
 } // namespace graphics
\ No newline at end of file
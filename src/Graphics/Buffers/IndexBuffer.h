@@ -8,11 +8,14 @@
 namespace graphics {
 
     /**
-     * @brief Encapsulates an OpenGL Index Buffer Object.
+     * @brief Encapsulates an OpenGL Index Buffer Object holding 32-bit or 16-bit indices.
      */
     class IndexBuffer {
     public:
         IndexBuffer(std::span<const GLuint> data, GLenum usage = GL_STATIC_DRAW);
+        IndexBuffer(std::span<const GLushort> data, GLenum usage = GL_STATIC_DRAW);
+        /// Allocates uninitialized storage for @p capacity indices (filled later via UpdateData/CopyFrom).
+        IndexBuffer(std::size_t capacity, GLenum usage, GLenum indexType = GL_UNSIGNED_INT);
         ~IndexBuffer();
 
         // Non-copyable.
@@ -25,16 +28,27 @@ namespace graphics {
         void Bind() const;
         void Unbind() const;
         void UpdateData(std::span<const GLuint> data, GLintptr offset = 0);
+        void UpdateData(std::span<const GLushort> data, GLintptr offset = 0);
+        /// Untyped write for buffers holding both 16- and 32-bit ranges (see renderer::GeometryArena).
+        void UpdateBytes(std::span<const std::byte> data, GLintptr offset);
+        /// GPU-side copy of @p size bytes from @p source (used when growing a buffer).
+        void CopyFrom(const IndexBuffer& source, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size);
 
         [[nodiscard]] GLuint GetRendererID() const { return rendererId_; }
         [[nodiscard]] GLsizei GetCount() const { return count_; }
         [[nodiscard]] size_t GetSize() const { return size_; }
+        [[nodiscard]] GLenum GetIndexType() const { return indexType_; }   ///< GL_UNSIGNED_INT or GL_UNSIGNED_SHORT.
+        [[nodiscard]] size_t GetIndexSize() const { return indexType_ == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint); }
 
     private:
+        void Create(const void* data);
+        void Upload(const void* data, size_t bytes, GLintptr offset);
+
         GLuint rendererId_{ 0 };
         GLsizei count_{ 0 };
         size_t size_{ 0 };
         GLenum usage_{ GL_STATIC_DRAW };
+        GLenum indexType_{ GL_UNSIGNED_INT };
     };
 
 } // namespace graphics
\ No newline at end of file
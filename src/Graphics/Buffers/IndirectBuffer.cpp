@@ -56,8 +56,6 @@ namespace graphics {
             throw std::runtime_error("IndirectBuffer::UpdateData: Data update exceeds buffer size.");
         }
         GLCall(glNamedBufferSubData(rendererId_, offset, data.size_bytes(), data.data()));
-        Logger::GetLogger()->debug("Updated IndirectBuffer ID={} Offset={} Size={} bytes.",
-            rendererId_, offset, data.size_bytes());
     }
 
 } // namespace graphics
\ No newline at end of file
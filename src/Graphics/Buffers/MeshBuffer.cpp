@@ -18,14 +18,11 @@ namespace graphics {
 
         vertexCount_ = static_cast<GLuint>(mesh.positions_.size());
 
+        const auto uvChannels = meshLayout_.GetUVChannels();
         size_t totalComponents = 0;
         if (meshLayout_.hasPositions_)  totalComponents += 3;
         if (meshLayout_.hasNormals_ && !mesh.normals_.empty()) totalComponents += 3;
-        for (size_t i = 0; i < meshLayout_.textureTypes_.size(); ++i) {
-            if (meshLayout_.textureTypes_.test(i)) {
-                totalComponents += 2;
-            }
-        }
+        totalComponents += 2 * uvChannels.count();
         if (meshLayout_.hasTangents_ && !mesh.tangents_.empty()) totalComponents += 3;
 
         std::vector<float> vertexData;
@@ -40,17 +37,10 @@ namespace graphics {
                 const auto& normal = mesh.normals_[i];
                 vertexData.insert(vertexData.end(), { normal.x, normal.y, normal.z });
             }
-            for (size_t j = 0; j < meshLayout_.textureTypes_.size(); ++j) {
-                if (meshLayout_.textureTypes_.test(j)) {
-                    TextureType texType = static_cast<TextureType>(j);
-                    const auto& uvIt = mesh.uvs_.at(texType);
-                    if (!uvIt.empty() && i < uvIt.size()) {
-                        const auto& uv = uvIt[i];
-                        vertexData.insert(vertexData.end(), { uv.x, uv.y });
-                    }
-                    else {
-                        vertexData.insert(vertexData.end(), { 0.f, 0.f });
-                    }
+            for (size_t c = 0; c < kMaxUVChannels; ++c) {
+                if (uvChannels.test(c)) {
+                    const glm::vec2 uv = mesh.GetUV(static_cast<uint32_t>(c), i);
+                    vertexData.insert(vertexData.end(), { uv.x, uv.y });
                 }
             }
             if (meshLayout_.hasTangents_ && !mesh.tangents_.empty()) {
@@ -76,8 +66,8 @@ namespace graphics {
         if (meshLayout_.hasNormals_ && !mesh.normals_.empty()) {
             bufferLayout.Push<float>(3, attributeIndex++);
         }
-        for (size_t j = 0; j < meshLayout_.textureTypes_.size(); ++j) {
-            if (meshLayout_.textureTypes_.test(j)) {
+        for (size_t c = 0; c < kMaxUVChannels; ++c) {
+            if (uvChannels.test(c)) {
                 bufferLayout.Push<float>(2, attributeIndex++);
             }
         }
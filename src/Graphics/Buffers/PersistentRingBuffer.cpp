@@ -0,0 +1,138 @@
+#include "PersistentRingBuffer.h"
+#include "Utilities/Logger.h"
+#include "Utilities/Utility.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace graphics {
+
+    namespace {
+        constexpr GLbitfield kMapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        constexpr GLsizeiptr kRegionAlignment = 256;   // Covers the usual UBO/SSBO offset alignments.
+        constexpr GLuint64 kFenceTimeoutNs = 1'000'000'000;
+
+        GLsizeiptr AlignRegion(GLsizeiptr size) {
+            return (std::max<GLsizeiptr>(size, 1) + kRegionAlignment - 1) / kRegionAlignment * kRegionAlignment;
+        }
+    }
+
+    PersistentRingBuffer::PersistentRingBuffer(GLsizeiptr regionSize, GLuint regionCount)
+        : ring_(static_cast<std::size_t>(AlignRegion(regionSize)), regionCount),
+        fences_(regionCount, nullptr),
+        lastWriteFrame_(currentFrame_)
+    {
+        const auto capacity = static_cast<GLsizeiptr>(ring_.GetCapacity());
+        GLCall(glCreateBuffers(1, &rendererId_));
+        if (rendererId_ == 0) {
+            Logger::GetLogger()->error("Failed to create PersistentRingBuffer.");
+            throw std::runtime_error("Failed to create PersistentRingBuffer.");
+        }
+        GLCall(glNamedBufferStorage(rendererId_, capacity, nullptr, kMapFlags));
+        GLCall(mapped_ = static_cast<std::byte*>(glMapNamedBufferRange(rendererId_, 0, capacity, kMapFlags)));
+        if (!mapped_) {
+            GLCall(glDeleteBuffers(1, &rendererId_));
+            Logger::GetLogger()->error("Failed to map PersistentRingBuffer (ID={}).", rendererId_);
+            throw std::runtime_error("Failed to map PersistentRingBuffer.");
+        }
+        Logger::GetLogger()->info("Created PersistentRingBuffer (ID={}) with {} region(s) of {} bytes.",
+            rendererId_, regionCount, ring_.GetRegionSize());
+    }
+
+    PersistentRingBuffer::~PersistentRingBuffer() {
+        for (GLsync fence : fences_) {
+            if (fence) {
+                glDeleteSync(fence);
+            }
+        }
+        if (rendererId_ != 0) {
+            GLCall(glUnmapNamedBuffer(rendererId_));
+            GLCall(glDeleteBuffers(1, &rendererId_));
+            Logger::GetLogger()->info("Deleted PersistentRingBuffer (ID={}).", rendererId_);
+        }
+    }
+
+    PersistentRingBuffer::Range PersistentRingBuffer::Write(std::span<const std::byte> data, std::size_t alignment) {
+        if (data.size_bytes() > ring_.GetRegionSize()) {
+            Logger::GetLogger()->error("PersistentRingBuffer::Write: {} bytes exceed the region size ({}).",
+                data.size_bytes(), ring_.GetRegionSize());
+            throw std::length_error("PersistentRingBuffer::Write: data larger than a region.");
+        }
+
+        // The previous frame's region is done being written: fence it and move on.
+        if (lastWriteFrame_ != currentFrame_) {
+            lastWriteFrame_ = currentFrame_;
+            if (ring_.GetUsed() > 0) {
+                AdvanceRegion();
+            }
+        }
+
+        std::size_t offset = ring_.Allocate(data.size_bytes(), alignment);
+        if (offset == RingAllocator::kInvalid) {
+            ++stats_.earlyAdvances_;
+            AdvanceRegion();
+            offset = ring_.Allocate(data.size_bytes(), alignment);
+        }
+
+        std::memcpy(mapped_ + offset, data.data(), data.size_bytes());   // Coherent: no flush needed.
+        ++stats_.writes_;
+        stats_.bytesWritten_ += data.size_bytes();
+        return { static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(data.size_bytes()) };
+    }
+
+    void PersistentRingBuffer::BindRange(GLenum target, GLuint bindingPoint, const Range& range) const {
+        GLCall(glBindBufferRange(target, bindingPoint, rendererId_, range.offset_, range.size_));
+    }
+
+    void PersistentRingBuffer::Bind(GLenum target) const {
+        GLCall(glBindBuffer(target, rendererId_));
+    }
+
+    std::size_t PersistentRingBuffer::GetOffsetAlignment(GLenum target) {
+        // Queried once per target; the values are fixed for the context.
+        static const std::size_t uniformAlignment = [] {
+            GLint alignment = 1;
+            glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+            return static_cast<std::size_t>(std::max(alignment, 1));
+            }();
+        static const std::size_t storageAlignment = [] {
+            GLint alignment = 1;
+            glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+            return static_cast<std::size_t>(std::max(alignment, 1));
+            }();
+        if (target == GL_UNIFORM_BUFFER) {
+            return uniformAlignment;
+        }
+        if (target == GL_SHADER_STORAGE_BUFFER) {
+            return storageAlignment;
+        }
+        return 1;
+    }
+
+    void PersistentRingBuffer::AdvanceRegion() {
+        const std::size_t current = ring_.GetRegion();
+        if (fences_[current]) {
+            glDeleteSync(fences_[current]);
+        }
+        fences_[current] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        const std::size_t next = ring_.Advance();
+        GLsync fence = fences_[next];
+        if (!fence) {
+            return; // Never written, or already known to be free.
+        }
+        GLenum status = glClientWaitSync(fence, 0, 0);
+        if (status == GL_TIMEOUT_EXPIRED) {
+            ++stats_.fenceWaits_;
+            do {
+                status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, kFenceTimeoutNs);
+            } while (status == GL_TIMEOUT_EXPIRED);
+        }
+        if (status == GL_WAIT_FAILED) {
+            Logger::GetLogger()->error("PersistentRingBuffer (ID={}): waiting for region {} failed.", rendererId_, next);
+        }
+        glDeleteSync(fence);
+        fences_[next] = nullptr;
+    }
+
+} // namespace graphics
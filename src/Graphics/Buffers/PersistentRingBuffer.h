@@ -0,0 +1,93 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "RingAllocator.h"
+
+namespace graphics {
+
+    /**
+     * @brief Persistently mapped buffer for data rewritten every frame (per-frame UBOs, indirect commands).
+     *
+     * Storage comes from glNamedBufferStorage with GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT and
+     * stays mapped, so a Write() is a memcpy with no driver call. The buffer is split into
+     * regionCount regions (three by default). The first Write() of a new frame (see NextFrame())
+     * fences the region the previous frame wrote and moves to the next one, waiting only if
+     * the GPU still reads that region. A frame that overflows its region moves on early.
+     *
+     * Callers bind the returned Range (BindRange, or an offset into GL_DRAW_INDIRECT_BUFFER)
+     * rather than the whole buffer.
+     *
+     * Used by the FrameCommonData UBO and Batch's cluster-culled indirect commands. Buffers
+     * written only on change (LightManager's SSBO, per-object draw commands) keep their own
+     * storage: a ring would force them to be rewritten every frame.
+     */
+    class PersistentRingBuffer {
+    public:
+        static constexpr GLuint kDefaultRegionCount = 3;
+
+        /// Byte range of one Write() inside the buffer.
+        struct Range {
+            GLintptr offset_ = 0;
+            GLsizeiptr size_ = 0;
+        };
+
+        struct Stats {
+            std::size_t writes_ = 0;
+            std::size_t bytesWritten_ = 0;
+            std::size_t fenceWaits_ = 0;        ///< Region switches that had to wait for the GPU.
+            std::size_t earlyAdvances_ = 0;     ///< Region switches caused by a full region mid-frame.
+        };
+
+        /**
+         * @param regionSize Bytes one frame may write (rounded up to 256 so every region is bindable).
+         * @throws std::runtime_error if buffer creation or mapping fails.
+         */
+        explicit PersistentRingBuffer(GLsizeiptr regionSize, GLuint regionCount = kDefaultRegionCount);
+        ~PersistentRingBuffer();
+
+        PersistentRingBuffer(const PersistentRingBuffer&) = delete;
+        PersistentRingBuffer& operator=(const PersistentRingBuffer&) = delete;
+        PersistentRingBuffer(PersistentRingBuffer&&) = delete;
+        PersistentRingBuffer& operator=(PersistentRingBuffer&&) = delete;
+
+        /**
+         * @brief Copies @p data into the current region.
+         * @param alignment Offset alignment, e.g. GetOffsetAlignment(GL_UNIFORM_BUFFER) for ranges bound as UBOs.
+         * @throws std::length_error if @p data is larger than a region.
+         */
+        Range Write(std::span<const std::byte> data, std::size_t alignment = 1);
+
+        /// glBindBufferRange on an indexed target (GL_UNIFORM_BUFFER, GL_SHADER_STORAGE_BUFFER).
+        void BindRange(GLenum target, GLuint bindingPoint, const Range& range) const;
+        /// glBindBuffer on a non-indexed target (e.g. GL_DRAW_INDIRECT_BUFFER); draw with range.offset_.
+        void Bind(GLenum target) const;
+
+        [[nodiscard]] GLuint GetRendererID() const { return rendererId_; }
+        [[nodiscard]] GLsizeiptr GetRegionSize() const { return static_cast<GLsizeiptr>(ring_.GetRegionSize()); }
+        [[nodiscard]] const Stats& GetStats() const { return stats_; }
+
+        /// Offset alignment the driver requires for ranges bound to @p target (1 for non-indexed targets).
+        static std::size_t GetOffsetAlignment(GLenum target);
+
+        /// Starts a new frame for every ring buffer; call once per frame after the buffer swap.
+        static void NextFrame() { ++currentFrame_; }
+
+    private:
+        void AdvanceRegion();
+
+        GLuint rendererId_{ 0 };
+        std::byte* mapped_{ nullptr };
+        RingAllocator ring_;
+        std::vector<GLsync> fences_;    ///< Per region; set when the ring moves past it.
+        uint64_t lastWriteFrame_{ 0 };
+        Stats stats_;
+
+        static inline uint64_t currentFrame_ = 0;
+    };
+
+} // namespace graphics
@@ -0,0 +1,35 @@
+#include "RingAllocator.h"
+
+#include <stdexcept>
+
+namespace graphics {
+
+    RingAllocator::RingAllocator(std::size_t regionSize, std::size_t regionCount)
+        : regionSize_(regionSize), regionCount_(regionCount)
+    {
+        if (regionSize_ == 0 || regionCount_ == 0) {
+            throw std::invalid_argument("RingAllocator: region size and count must be non-zero.");
+        }
+    }
+
+    std::size_t RingAllocator::Allocate(std::size_t size, std::size_t alignment) {
+        if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+            throw std::invalid_argument("RingAllocator::Allocate: alignment must be a power of two.");
+        }
+        // Regions start at multiples of regionSize_, so align the absolute offset.
+        const std::size_t base = GetRegionOffset(region_);
+        const std::size_t aligned = ((base + head_ + alignment - 1) & ~(alignment - 1)) - base;
+        if (aligned > regionSize_ || size > regionSize_ - aligned) {
+            return kInvalid;
+        }
+        head_ = aligned + size;
+        return base + aligned;
+    }
+
+    std::size_t RingAllocator::Advance() {
+        region_ = (region_ + 1) % regionCount_;
+        head_ = 0;
+        return region_;
+    }
+
+} // namespace graphics
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+
+namespace graphics {
+
+    /**
+     * @brief Bump allocator over a buffer split into regionCount equal regions, used round-robin.
+     *
+     * Pure bookkeeping with no GL calls: PersistentRingBuffer pairs each region with a fence and
+     * only calls Advance() once the GPU has finished reading the region it moves to.
+     * Offsets are absolute byte offsets into the whole buffer.
+     */
+    class RingAllocator {
+    public:
+        static constexpr std::size_t kInvalid = static_cast<std::size_t>(-1);
+
+        /// @throws std::invalid_argument if @p regionSize or @p regionCount is zero.
+        RingAllocator(std::size_t regionSize, std::size_t regionCount);
+
+        /**
+         * @brief Reserves @p size bytes in the current region, aligned to @p alignment (a power of two).
+         * @return the absolute offset, or kInvalid if the current region has no room left.
+         */
+        std::size_t Allocate(std::size_t size, std::size_t alignment = 1);
+
+        /// Moves to the next region (wrapping) and empties it. @return the new region index.
+        std::size_t Advance();
+
+        std::size_t GetRegion() const { return region_; }
+        std::size_t GetRegionSize() const { return regionSize_; }
+        std::size_t GetRegionCount() const { return regionCount_; }
+        std::size_t GetCapacity() const { return regionSize_ * regionCount_; }
+        std::size_t GetRegionOffset(std::size_t region) const { return region * regionSize_; }
+        /// Bytes used in the current region, including alignment padding.
+        std::size_t GetUsed() const { return head_; }
+
+    private:
+        std::size_t regionSize_;
+        std::size_t regionCount_;
+        std::size_t region_ = 0;
+        std::size_t head_ = 0;      ///< Relative to the current region.
+    };
+
+} // namespace graphics
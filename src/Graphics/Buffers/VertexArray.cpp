@@ -66,6 +66,16 @@ namespace graphics {
             vertexBuffer.GetRendererID(), rendererId_, bindingIndex);
     }
 
+    void VertexArray::SetVertexBuffer(const VertexBuffer& vertexBuffer, GLsizei stride, GLuint bindingIndex) {
+        if (std::find(bindingIndices_.begin(), bindingIndices_.end(), bindingIndex) == bindingIndices_.end()) {
+            Logger::GetLogger()->error("Binding index={} is not used in VertexArray (ID={}).", bindingIndex, rendererId_);
+            throw std::invalid_argument("Unknown binding index in VertexArray::SetVertexBuffer");
+        }
+        GLCall(glVertexArrayVertexBuffer(rendererId_, bindingIndex, vertexBuffer.GetRendererID(), 0, stride));
+        Logger::GetLogger()->info("Rebound VertexBuffer (ID={}) to VertexArray (ID={}) at binding index={}.",
+            vertexBuffer.GetRendererID(), rendererId_, bindingIndex);
+    }
+
     void VertexArray::SetIndexBuffer(const IndexBuffer& indexBuffer) {
         GLCall(glVertexArrayElementBuffer(rendererId_, indexBuffer.GetRendererID()));
         Logger::GetLogger()->info("Set IndexBuffer (ID={}) to VertexArray (ID={}).", indexBuffer.GetRendererID(), rendererId_);
@@ -41,6 +41,12 @@ namespace graphics {
             const VertexBufferLayout& layout,
             GLuint bindingIndex = 0);
 
+        /**
+         * @brief Points an already added binding index at another vertex buffer with the same layout
+         *        (e.g. after the buffer was reallocated to grow).
+         */
+        void SetVertexBuffer(const VertexBuffer& vertexBuffer, GLsizei stride, GLuint bindingIndex = 0);
+
         /**
          * @brief Associates an IndexBuffer (element buffer) with this VAO.
          */
@@ -16,6 +16,17 @@ namespace graphics {
         Logger::GetLogger()->info("Created VertexBuffer (ID={}) with size={} bytes.", rendererId_, size_);
     }
 
+    VertexBuffer::VertexBuffer(std::size_t sizeBytes, GLenum usage)
+        : size_{ sizeBytes }, usage_{ usage }
+    {
+        GLCall(glCreateBuffers(1, &rendererId_));
+        if (rendererId_ == 0) {
+            throw std::runtime_error("Failed to create Vertex Buffer Object.");
+        }
+        GLCall(glNamedBufferData(rendererId_, size_, nullptr, usage_));
+        Logger::GetLogger()->info("Created VertexBuffer (ID={}) with capacity={} bytes.", rendererId_, size_);
+    }
+
     VertexBuffer::~VertexBuffer() {
         if (rendererId_ != 0) {
             GLCall(glDeleteBuffers(1, &rendererId_));
@@ -62,4 +73,12 @@ namespace graphics {
         Logger::GetLogger()->debug("Updated VertexBuffer (ID={}) offset={} size={} bytes.", rendererId_, offset, data.size_bytes());
     }
 
+    void VertexBuffer::CopyFrom(const VertexBuffer& source, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+        if (readOffset + size > static_cast<GLintptr>(source.size_) ||
+            writeOffset + size > static_cast<GLintptr>(size_)) {
+            throw std::runtime_error("VertexBuffer::CopyFrom: Range exceeds buffer size.");
+        }
+        GLCall(glCopyNamedBufferSubData(source.rendererId_, rendererId_, readOffset, writeOffset, size));
+    }
+
 } // namespace graphics
\ No newline at end of file
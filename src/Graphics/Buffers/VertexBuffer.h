@@ -23,6 +23,9 @@ namespace graphics {
          */
         explicit VertexBuffer(std::span<const std::byte> data, GLenum usage = GL_STATIC_DRAW);
 
+        /// Allocates uninitialized storage of @p sizeBytes (filled later via UpdateData/CopyFrom).
+        VertexBuffer(std::size_t sizeBytes, GLenum usage);
+
         ~VertexBuffer();
 
         VertexBuffer(const VertexBuffer&) = delete;
@@ -40,6 +43,9 @@ namespace graphics {
 
         void UpdateData(std::span<const std::byte> data, GLintptr offset = 0);
 
+        /// GPU-side copy of @p size bytes from @p source (used when growing a buffer).
+        void CopyFrom(const VertexBuffer& source, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size);
+
         [[nodiscard]] size_t GetSize() const { return size_; }
         [[nodiscard]] GLuint GetRendererID() const { return rendererId_; }
 
@@ -23,7 +23,9 @@ namespace graphics {
     template <typename T>
     concept SupportedVertexType = std::is_same_v<T, float> ||
         std::is_same_v<T, GLuint> ||
-        std::is_same_v<T, GLubyte>;
+        std::is_same_v<T, GLubyte> ||
+        std::is_same_v<T, GLushort> ||
+        std::is_same_v<T, GLshort>;
 
     /**
      * @brief Manages a collection of vertex attributes and calculates the stride.
@@ -68,6 +70,16 @@ namespace graphics {
             offset_ += count * sizeof(GLubyte);
             stride_ += count * sizeof(GLubyte);
         }
+        else if constexpr (std::is_same_v<T, GLushort>) {
+            elements_.push_back({ attributeIndex, count, GL_UNSIGNED_SHORT, GL_TRUE, offset_ });
+            offset_ += count * sizeof(GLushort);
+            stride_ += count * sizeof(GLushort);
+        }
+        else if constexpr (std::is_same_v<T, GLshort>) {
+            elements_.push_back({ attributeIndex, count, GL_SHORT, GL_TRUE, offset_ });
+            offset_ += count * sizeof(GLshort);
+            stride_ += count * sizeof(GLshort);
+        }
     }
 
 } // namespace graphics
\ No newline at end of file
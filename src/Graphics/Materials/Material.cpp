@@ -186,6 +186,20 @@ namespace graphics {
         customTextures_[uniformName] = texture;
     }
 
+    AlphaMode Material::GetAlphaMode() const {
+        if (alphaMode_.has_value()) {
+            return alphaMode_.value();
+        }
+        if (packedParams_.Opacity() < 1.0f) {
+            return AlphaMode::Blend;
+        }
+        auto it = textures_.find(TextureType::Diffuse);
+        if (it != textures_.end() && it->second && it->second->HasAlpha()) {
+            return AlphaMode::Mask;
+        }
+        return AlphaMode::Opaque;
+    }
+
     void Material::Bind(const std::shared_ptr<BaseShader>& shader) const {
         if (!shader) {
             Logger::GetLogger()->error("[Material: {}] Bind: No shader provided.", name_);
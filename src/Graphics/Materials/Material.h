@@ -4,6 +4,7 @@
 #include <unordered_map>
 #include <string>
 #include <memory>
+#include <optional>
 #include <glm/glm.hpp>
 #include "MaterialParamType.h"
 #include "MaterialLayout.h"
@@ -40,6 +41,13 @@ namespace graphics {
         inline float Illumination() const { return mtl3_.w; }
     };
 
+    /// How a material's alpha is resolved; selects the render queue of its batches.
+    enum class AlphaMode : uint8_t {
+        Opaque,
+        Mask,   ///< Alpha-tested: the diffuse texture cuts out texels (shaders discard them).
+        Blend   ///< Opacity below 1: alpha-blended, drawn back to front after the opaque geometry.
+    };
+
     /**
      * @brief Material class storing both standard and custom parameters/textures.
      */
@@ -70,6 +78,10 @@ namespace graphics {
         void Bind(const std::shared_ptr<BaseShader>& shader) const;
         void Unbind() const;
 
+        /// Derived from the opacity and the diffuse texture's alpha unless set explicitly.
+        AlphaMode GetAlphaMode() const;
+        void SetAlphaMode(AlphaMode mode) { alphaMode_ = mode; }
+
     private:
         std::size_t id_ = 0;
         std::string name_;
@@ -79,6 +91,7 @@ namespace graphics {
         std::unordered_map<TextureType, std::shared_ptr<ITexture>> textures_;
         std::unordered_map<std::string, std::shared_ptr<ITexture>> customTextures_;
         uint32_t textureUsage_ = 0;
+        std::optional<AlphaMode> alphaMode_;
     };
 
 } // namespace graphics
\ No newline at end of file
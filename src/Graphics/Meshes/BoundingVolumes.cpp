@@ -0,0 +1,213 @@
+#include "BoundingVolumes.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace graphics {
+
+    namespace {
+        /// Visits every enclosed point: all vertices, or only the indexed ones.
+        template <typename Fn>
+        void ForEachPoint(std::span<const float> positions3f, std::span<const uint32_t> indices, Fn&& fn) {
+            const std::size_t vertexCount = positions3f.size() / 3;
+            auto point = [&](std::size_t v) {
+                return glm::vec3(positions3f[v * 3], positions3f[v * 3 + 1], positions3f[v * 3 + 2]);
+                };
+            if (indices.empty()) {
+                for (std::size_t v = 0; v < vertexCount; ++v) {
+                    fn(point(v));
+                }
+                return;
+            }
+            for (uint32_t index : indices) {
+                if (index < vertexCount) {
+                    fn(point(index));
+                }
+            }
+        }
+
+        /// Ritter's growth step: the smallest sphere enclosing @p sphere and @p p.
+        void Grow(BoundingSphere& sphere, const glm::vec3& p) {
+            const glm::vec3 d = p - sphere.center_;
+            const float dist2 = glm::dot(d, d);
+            if (dist2 <= sphere.radius_ * sphere.radius_) {
+                return;
+            }
+            const float dist = std::sqrt(dist2);
+            const float radius = 0.5f * (sphere.radius_ + dist);
+            sphere.center_ += d * ((radius - sphere.radius_) / dist);
+            sphere.radius_ = radius;
+        }
+
+        BoundingSphere SphereFromPair(const glm::vec3& a, const glm::vec3& b) {
+            return { 0.5f * (a + b), 0.5f * glm::length(b - a) };
+        }
+
+        /// Eigen-decomposition of a symmetric 3x3 matrix by cyclic Jacobi rotations.
+        void JacobiEigenvectors(glm::mat3 a, glm::mat3& vectors) {
+            vectors = glm::mat3(1.0f);
+            for (int sweep = 0; sweep < 32; ++sweep) {
+                const float off = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+                if (off < 1e-12f) {
+                    break;
+                }
+                for (int p = 0; p < 2; ++p) {
+                    for (int q = p + 1; q < 3; ++q) {
+                        if (std::abs(a[p][q]) < 1e-12f) {
+                            continue;
+                        }
+                        const float theta = (a[q][q] - a[p][p]) / (2.0f * a[p][q]);
+                        const float t = (theta >= 0.0f ? 1.0f : -1.0f) / (std::abs(theta) + std::sqrt(theta * theta + 1.0f));
+                        const float c = 1.0f / std::sqrt(t * t + 1.0f);
+                        const float s = t * c;
+                        glm::mat3 rotation(1.0f);
+                        rotation[p][p] = c;
+                        rotation[q][q] = c;
+                        rotation[q][p] = s;     // glm is column-major: [column][row].
+                        rotation[p][q] = -s;
+                        a = glm::transpose(rotation) * a * rotation;
+                        vectors = vectors * rotation;
+                    }
+                }
+            }
+        }
+
+        OrientedBox FitBox(std::span<const float> positions3f, const glm::vec3 axes[3]) {
+            glm::vec3 lo(FLT_MAX), hi(-FLT_MAX);
+            ForEachPoint(positions3f, {}, [&](const glm::vec3& p) {
+                const glm::vec3 projected(glm::dot(p, axes[0]), glm::dot(p, axes[1]), glm::dot(p, axes[2]));
+                lo = glm::min(lo, projected);
+                hi = glm::max(hi, projected);
+                });
+            OrientedBox box;
+            const glm::vec3 mid = 0.5f * (lo + hi);
+            for (int i = 0; i < 3; ++i) {
+                box.axes_[i] = axes[i];
+            }
+            box.center_ = mid.x * axes[0] + mid.y * axes[1] + mid.z * axes[2];
+            box.halfExtents_ = 0.5f * (hi - lo);
+            return box;
+        }
+    }
+
+    // ––– ComputeBoundingSphere –––
+    BoundingSphere ComputeBoundingSphere(std::span<const float> positions3f,
+        std::span<const uint32_t> indices,
+        SphereFit fit)
+    {
+        BoundingSphere sphere;
+        if (positions3f.size() < 3) {
+            return sphere;
+        }
+
+        if (fit == SphereFit::BoxDiagonal) {
+            glm::vec3 lo(FLT_MAX), hi(-FLT_MAX);
+            ForEachPoint(positions3f, indices, [&](const glm::vec3& p) {
+                lo = glm::min(lo, p);
+                hi = glm::max(hi, p);
+                });
+            return lo.x <= hi.x ? SphereFromPair(lo, hi) : sphere;
+        }
+
+        if (fit == SphereFit::Ritter) {
+            // Farthest point from an arbitrary one, then the farthest from that: a near-diameter.
+            bool first = true;
+            glm::vec3 start(0.0f);
+            ForEachPoint(positions3f, indices, [&](const glm::vec3& p) {
+                if (first) { start = p; first = false; }
+                });
+            auto farthestFrom = [&](const glm::vec3& from) {
+                glm::vec3 best = from;
+                float bestDist2 = -1.0f;
+                ForEachPoint(positions3f, indices, [&](const glm::vec3& p) {
+                    const float d2 = glm::dot(p - from, p - from);
+                    if (d2 > bestDist2) { bestDist2 = d2; best = p; }
+                    });
+                return best;
+                };
+            const glm::vec3 a = farthestFrom(start);
+            const glm::vec3 b = farthestFrom(a);
+            sphere = SphereFromPair(a, b);
+        }
+        else {
+            // EPOS: extremal points along 13 fixed directions (the EPOS-26 set).
+            static const glm::vec3 kDirections[13] = {
+                { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 },
+                { 1, 1, 1 }, { 1, 1, -1 }, { 1, -1, 1 }, { 1, -1, -1 },
+                { 1, 1, 0 }, { 1, -1, 0 }, { 1, 0, 1 }, { 1, 0, -1 }, { 0, 1, 1 }, { 0, 1, -1 } };
+            glm::vec3 minPoint[13], maxPoint[13];
+            float minProj[13], maxProj[13];
+            std::fill(std::begin(minProj), std::end(minProj), FLT_MAX);
+            std::fill(std::begin(maxProj), std::end(maxProj), -FLT_MAX);
+            ForEachPoint(positions3f, indices, [&](const glm::vec3& p) {
+                for (int d = 0; d < 13; ++d) {
+                    const float proj = glm::dot(p, kDirections[d]);
+                    if (proj < minProj[d]) { minProj[d] = proj; minPoint[d] = p; }
+                    if (proj > maxProj[d]) { maxProj[d] = proj; maxPoint[d] = p; }
+                }
+                });
+            if (minProj[0] > maxProj[0]) {
+                return sphere;  // No referenced points.
+            }
+            // Seed with the most distant extremal pair, then enclose the other extremal points.
+            int widest = 0;
+            float widestDist2 = -1.0f;
+            for (int d = 0; d < 13; ++d) {
+                const float d2 = glm::dot(maxPoint[d] - minPoint[d], maxPoint[d] - minPoint[d]);
+                if (d2 > widestDist2) { widestDist2 = d2; widest = d; }
+            }
+            sphere = SphereFromPair(minPoint[widest], maxPoint[widest]);
+            for (int d = 0; d < 13; ++d) {
+                Grow(sphere, minPoint[d]);
+                Grow(sphere, maxPoint[d]);
+            }
+        }
+
+        // Final pass: grow over every point so the sphere is conservative.
+        ForEachPoint(positions3f, indices, [&](const glm::vec3& p) { Grow(sphere, p); });
+        return sphere;
+    }
+
+    // ––– ComputeOrientedBox –––
+    OrientedBox ComputeOrientedBox(std::span<const float> positions3f)
+    {
+        const std::size_t vertexCount = positions3f.size() / 3;
+        const glm::vec3 worldAxes[3] = { glm::vec3(1, 0, 0), glm::vec3(0, 1, 0), glm::vec3(0, 0, 1) };
+        if (vertexCount == 0) {
+            return {};
+        }
+        const OrientedBox aabb = FitBox(positions3f, worldAxes);
+        if (vertexCount < 4) {
+            return aabb;
+        }
+
+        // Covariance of the positions.
+        glm::vec3 mean(0.0f);
+        ForEachPoint(positions3f, {}, [&](const glm::vec3& p) { mean += p; });
+        mean /= static_cast<float>(vertexCount);
+        float xx = 0.0f, xy = 0.0f, xz = 0.0f, yy = 0.0f, yz = 0.0f, zz = 0.0f;
+        ForEachPoint(positions3f, {}, [&](const glm::vec3& p) {
+            const glm::vec3 d = p - mean;
+            xx += d.x * d.x; xy += d.x * d.y; xz += d.x * d.z;
+            yy += d.y * d.y; yz += d.y * d.z; zz += d.z * d.z;
+            });
+        const float inv = 1.0f / static_cast<float>(vertexCount);
+        const glm::mat3 covariance(glm::vec3(xx, xy, xz) * inv,
+            glm::vec3(xy, yy, yz) * inv,
+            glm::vec3(xz, yz, zz) * inv);
+
+        glm::mat3 eigenvectors;
+        JacobiEigenvectors(covariance, eigenvectors);
+        glm::vec3 axes[3] = { glm::normalize(eigenvectors[0]), glm::normalize(eigenvectors[1]), glm::vec3(0.0f) };
+        axes[1] = glm::normalize(axes[1] - glm::dot(axes[1], axes[0]) * axes[0]);
+        axes[2] = glm::cross(axes[0], axes[1]);
+        if (!std::isfinite(axes[2].x) || glm::dot(axes[2], axes[2]) < 0.5f) {
+            return aabb;
+        }
+
+        const OrientedBox pca = FitBox(positions3f, axes);
+        return pca.Volume() < aabb.Volume() ? pca : aabb;
+    }
+
+} // namespace graphics
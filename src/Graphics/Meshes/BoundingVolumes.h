@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <glm/glm.hpp>
+
+namespace graphics {
+
+    struct BoundingSphere {
+        glm::vec3 center_ = glm::vec3(0.0f);
+        float radius_ = 0.0f;
+
+        float Volume() const { return 4.18879020f * radius_ * radius_ * radius_; }   // 4/3 pi r^3
+    };
+
+    /// Box with orthonormal axes; halfExtents_ are along axes_[0..2]. Invalid until fitted.
+    struct OrientedBox {
+        glm::vec3 center_ = glm::vec3(0.0f);
+        glm::vec3 axes_[3] = { glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f) };
+        glm::vec3 halfExtents_ = glm::vec3(-1.0f);
+
+        bool IsValid() const { return halfExtents_.x >= 0.0f; }
+        float Volume() const { return IsValid() ? 8.0f * halfExtents_.x * halfExtents_.y * halfExtents_.z : 0.0f; }
+    };
+
+    /// How bounding spheres are fitted to a point set.
+    enum class SphereFit : uint8_t {
+        BoxDiagonal,    ///< AABB center and half-diagonal (the old behaviour; loose on thin geometry).
+        Ritter,         ///< Ritter's two-pass sphere, typically within 5-20% of the minimal radius.
+        EPOS            ///< Extremal points along 13 directions seed Ritter's growth pass; usually a few % off minimal.
+    };
+
+    /// Which volumes ModelLoader fits to every mesh (see graphics::Mesh::ComputeBounds).
+    struct BoundsSettings {
+        SphereFit sphereFit_ = SphereFit::EPOS;
+        bool orientedBoxes_ = true;     ///< PCA-fitted OBB per mesh.
+        bool perLODSpheres_ = true;     ///< A sphere per LOD over the vertices that LOD references.
+    };
+
+    /**
+     * @brief Fits a sphere to flattened xyz positions.
+     * @param indices If not empty, only the vertices referenced by these indices are enclosed.
+     */
+    BoundingSphere ComputeBoundingSphere(std::span<const float> positions3f,
+        std::span<const uint32_t> indices,
+        SphereFit fit);
+
+    /**
+     * @brief PCA-fitted oriented box: axes are the eigenvectors of the position covariance.
+     *        Returns the axis-aligned box instead whenever that one is smaller.
+     */
+    OrientedBox ComputeOrientedBox(std::span<const float> positions3f);
+
+} // namespace graphics
@@ -17,8 +17,9 @@ namespace graphics {
             { -0.5f,  0.5f,  0.5f }
         };
 
-        // Provide UVs for one texture type (Albedo).
-        uvs_[TextureType::Diffuse] = {
+        // Provide UV channel 0 (shared by every texture type).
+        uvs_.resize(1);
+        uvs_[0] = {
             { 0.0f, 0.0f },
             { 1.0f, 0.0f },
             { 1.0f, 1.0f },
@@ -0,0 +1,562 @@
+#include "GltfImporter.h"
+
+#include <chrono>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <nlohmann/json.hpp>
+
+#include "Utilities/Logger.h"
+
+namespace StaticLoader {
+
+    namespace {
+        using json = nlohmann::json;
+
+        constexpr uint32_t kGlbMagic = 0x46546C67;      // "glTF"
+        constexpr uint32_t kGlbJsonChunk = 0x4E4F534A;  // "JSON"
+        constexpr uint32_t kGlbBinChunk = 0x004E4942;   // "BIN\0"
+
+        constexpr int kModeTriangles = 4;
+        constexpr int kModeTriangleStrip = 5;
+        constexpr int kModeTriangleFan = 6;
+
+        /// A resolved accessor: where its first element lives and how to step through it.
+        struct Accessor {
+            const std::byte* data_ = nullptr;
+            std::size_t stride_ = 0;
+            std::size_t count_ = 0;
+            ComponentType component_ = ComponentType::Float;
+            std::size_t components_ = 0;
+            bool normalized_ = false;
+        };
+
+        std::size_t ComponentSize(ComponentType type) {
+            switch (type) {
+            case ComponentType::Int8:
+            case ComponentType::UInt8:  return 1;
+            case ComponentType::Int16:
+            case ComponentType::UInt16: return 2;
+            case ComponentType::UInt32:
+            case ComponentType::Float:  return 4;
+            }
+            return 0;
+        }
+
+        std::size_t ComponentCount(const std::string& type) {
+            if (type == "SCALAR") return 1;
+            if (type == "VEC2") return 2;
+            if (type == "VEC3") return 3;
+            if (type == "VEC4") return 4;
+            if (type == "MAT4") return 16;
+            return 0;
+        }
+
+        bool IsKnownComponentType(int value) {
+            return value == 5120 || value == 5121 || value == 5122 || value == 5123 || value == 5125 || value == 5126;
+        }
+
+        /// Resolves accessor @p index against the loaded buffers (bounds-checked; no sparse accessors).
+        bool ResolveAccessor(const json& doc, const std::vector<std::span<const std::byte>>& buffers,
+            std::size_t index, Accessor& out)
+        {
+            const json& accessors = doc.at("accessors");
+            if (index >= accessors.size()) {
+                return false;
+            }
+            const json& accessor = accessors[index];
+            const int componentType = accessor.at("componentType").get<int>();
+            if (accessor.contains("sparse") || !accessor.contains("bufferView") || !IsKnownComponentType(componentType)) {
+                return false;
+            }
+            const json& view = doc.at("bufferViews").at(accessor.at("bufferView").get<std::size_t>());
+            const std::size_t bufferIndex = view.at("buffer").get<std::size_t>();
+            if (bufferIndex >= buffers.size()) {
+                return false;
+            }
+
+            out.component_ = static_cast<ComponentType>(componentType);
+            out.components_ = ComponentCount(accessor.at("type").get<std::string>());
+            out.count_ = accessor.at("count").get<std::size_t>();
+            out.normalized_ = accessor.value("normalized", false);
+            const std::size_t elementSize = ComponentSize(out.component_) * out.components_;
+            out.stride_ = view.value("byteStride", elementSize);
+
+            const std::size_t viewOffset = view.value("byteOffset", std::size_t{ 0 });
+            const std::size_t viewLength = view.at("byteLength").get<std::size_t>();
+            const std::size_t offset = accessor.value("byteOffset", std::size_t{ 0 });
+            const auto buffer = buffers[bufferIndex];
+            if (elementSize == 0 || viewOffset + viewLength > buffer.size() ||
+                (out.count_ > 0 && offset + out.stride_ * (out.count_ - 1) + elementSize > viewLength))
+            {
+                return false;
+            }
+            out.data_ = buffer.data() + viewOffset + offset;
+            return true;
+        }
+
+        template <typename T>
+        AttributeView<T> MakeView(const Accessor& accessor) {
+            return AttributeView<T>(accessor.data_, accessor.stride_, accessor.component_, accessor.normalized_);
+        }
+
+        bool ReadIndices(const Accessor& accessor, std::vector<uint32_t>& out) {
+            out.resize(accessor.count_);
+            for (std::size_t i = 0; i < accessor.count_; ++i) {
+                const std::byte* element = accessor.data_ + i * accessor.stride_;
+                switch (accessor.component_) {
+                case ComponentType::UInt8: {
+                    uint8_t v; std::memcpy(&v, element, 1); out[i] = v;
+                    break;
+                }
+                case ComponentType::UInt16: {
+                    uint16_t v; std::memcpy(&v, element, 2); out[i] = v;
+                    break;
+                }
+                case ComponentType::UInt32: {
+                    std::memcpy(&out[i], element, 4);
+                    break;
+                }
+                default:
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// Rewrites strip/fan index lists as triangle lists (winding preserved).
+        std::vector<uint32_t> ToTriangleList(const std::vector<uint32_t>& indices, int mode) {
+            std::vector<uint32_t> triangles;
+            if (indices.size() < 3) {
+                return triangles;
+            }
+            triangles.reserve((indices.size() - 2) * 3);
+            for (std::size_t i = 2; i < indices.size(); ++i) {
+                if (mode == kModeTriangleFan) {
+                    triangles.insert(triangles.end(), { indices[0], indices[i - 1], indices[i] });
+                }
+                else if (i % 2 == 0) {
+                    triangles.insert(triangles.end(), { indices[i - 2], indices[i - 1], indices[i] });
+                }
+                else {
+                    triangles.insert(triangles.end(), { indices[i - 1], indices[i - 2], indices[i] });
+                }
+            }
+            return triangles;
+        }
+
+        glm::mat4 NodeTransform(const json& node) {
+            glm::mat4 m(1.0f);
+            if (node.contains("matrix")) {
+                const auto values = node["matrix"].get<std::vector<float>>();
+                if (values.size() == 16) {
+                    for (int c = 0; c < 4; ++c) {
+                        for (int r = 0; r < 4; ++r) {
+                            m[c][r] = values[c * 4 + r];   // Column-major, like glm.
+                        }
+                    }
+                }
+                return m;
+            }
+            const auto t = node.value("translation", std::vector<float>{ 0.0f, 0.0f, 0.0f });
+            const auto q = node.value("rotation", std::vector<float>{ 0.0f, 0.0f, 0.0f, 1.0f });
+            const auto s = node.value("scale", std::vector<float>{ 1.0f, 1.0f, 1.0f });
+            if (t.size() != 3 || q.size() != 4 || s.size() != 3) {
+                return m;
+            }
+            // T * R * S, with R from the unit quaternion (x, y, z, w).
+            const float x = q[0], y = q[1], z = q[2], w = q[3];
+            m[0] = glm::vec4(1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y + z * w), 2.0f * (x * z - y * w), 0.0f) * s[0];
+            m[1] = glm::vec4(2.0f * (x * y - z * w), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z + x * w), 0.0f) * s[1];
+            m[2] = glm::vec4(2.0f * (x * z + y * w), 2.0f * (y * z - x * w), 1.0f - 2.0f * (x * x + y * y), 0.0f) * s[2];
+            m[3] = glm::vec4(t[0], t[1], t[2], 1.0f);
+            return m;
+        }
+
+        std::vector<std::byte> DecodeBase64(std::string_view text) {
+            auto value = [](char c) -> int {
+                if (c >= 'A' && c <= 'Z') return c - 'A';
+                if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+                if (c >= '0' && c <= '9') return c - '0' + 52;
+                if (c == '+') return 62;
+                if (c == '/') return 63;
+                return -1;
+                };
+            std::vector<std::byte> out;
+            out.reserve(text.size() / 4 * 3);
+            uint32_t bits = 0;
+            int bitCount = 0;
+            for (char c : text) {
+                const int v = value(c);
+                if (v < 0) {
+                    continue;   // Padding and whitespace.
+                }
+                bits = (bits << 6) | static_cast<uint32_t>(v);
+                bitCount += 6;
+                if (bitCount >= 8) {
+                    bitCount -= 8;
+                    out.push_back(static_cast<std::byte>((bits >> bitCount) & 0xFF));
+                }
+            }
+            return out;
+        }
+
+        /// URIs are percent-encoded ("my%20texture.png").
+        std::string DecodeUri(const std::string& uri) {
+            std::string out;
+            out.reserve(uri.size());
+            for (std::size_t i = 0; i < uri.size(); ++i) {
+                if (uri[i] == '%' && i + 2 < uri.size()) {
+                    out.push_back(static_cast<char>(std::stoi(uri.substr(i + 1, 2), nullptr, 16)));
+                    i += 2;
+                }
+                else {
+                    out.push_back(uri[i]);
+                }
+            }
+            return out;
+        }
+
+        /// Path of the image behind textureInfo @p info, or "" for embedded/missing images.
+        std::string TexturePath(const json& doc, const json& info) {
+            const std::size_t textureIndex = info.value("index", std::size_t{ 0 });
+            if (!doc.contains("textures") || textureIndex >= doc["textures"].size()) {
+                return {};
+            }
+            const json& texture = doc["textures"][textureIndex];
+            if (!texture.contains("source") || !doc.contains("images")) {
+                return {};
+            }
+            const json& image = doc["images"].at(texture["source"].get<std::size_t>());
+            const std::string uri = image.value("uri", std::string());
+            if (uri.empty() || uri.rfind("data:", 0) == 0) {
+                return {};
+            }
+            return DecodeUri(uri);
+        }
+
+        SourceMaterial ReadMaterial(const json& doc, const json& material, std::size_t index) {
+            SourceMaterial out;
+            out.name_ = material.value("name", "GltfMat_" + std::to_string(index));
+            out.ambient_ = glm::vec3(0.0f);
+            out.diffuse_ = glm::vec3(1.0f);
+            auto addTexture = [&](const json& parent, const char* key, TextureType type) {
+                if (parent.contains(key)) {
+                    const std::string path = TexturePath(doc, parent[key]);
+                    if (!path.empty()) {
+                        out.typedTextures_.emplace_back(type, path);
+                    }
+                    else {
+                        Logger::GetLogger()->warn("GltfImporter: Embedded or missing image for '{}' of '{}' is not supported.",
+                            key, out.name_);
+                    }
+                }
+                };
+
+            float roughness = 1.0f;
+            if (material.contains("pbrMetallicRoughness")) {
+                const json& pbr = material["pbrMetallicRoughness"];
+                const auto baseColor = pbr.value("baseColorFactor", std::vector<float>{ 1.0f, 1.0f, 1.0f, 1.0f });
+                if (baseColor.size() == 4) {
+                    out.diffuse_ = glm::vec3(baseColor[0], baseColor[1], baseColor[2]);
+                    out.opacity_ = baseColor[3];
+                }
+                roughness = pbr.value("roughnessFactor", 1.0f);
+                addTexture(pbr, "baseColorTexture", TextureType::Diffuse);
+                addTexture(pbr, "metallicRoughnessTexture", TextureType::MetalRoughness);
+            }
+            // Same roughness -> shininess conversion as Assimp's glTF2 importer.
+            out.shininess_ = (1.0f - roughness) * 1000.0f;
+            const auto emissive = material.value("emissiveFactor", std::vector<float>{ 0.0f, 0.0f, 0.0f });
+            if (emissive.size() == 3) {
+                out.emissive_ = glm::vec3(emissive[0], emissive[1], emissive[2]);
+            }
+            addTexture(material, "normalTexture", TextureType::Normal);
+            addTexture(material, "occlusionTexture", TextureType::AO);
+            addTexture(material, "emissiveTexture", TextureType::Emissive);
+            return out;
+        }
+
+        /// The JSON text and, for .glb, the BIN chunk of a mapped glTF file.
+        struct GltfChunks {
+            std::string_view json_;
+            std::span<const std::byte> bin_;
+        };
+
+        GltfChunks SplitChunks(std::span<const std::byte> file) {
+            const std::byte* bytes = file.data();
+            const std::size_t size = file.size();
+            GltfChunks chunks{ std::string_view(reinterpret_cast<const char*>(bytes), size), {} };
+            uint32_t header[3] = {};
+            if (size >= sizeof(header)) {
+                std::memcpy(header, bytes, sizeof(header));
+            }
+            if (header[0] == kGlbMagic) {
+                std::size_t offset = sizeof(header);
+                chunks.json_ = {};
+                while (offset + 8 <= size) {
+                    uint32_t chunk[2];
+                    std::memcpy(chunk, bytes + offset, sizeof(chunk));
+                    offset += sizeof(chunk);
+                    if (offset + chunk[0] > size) {
+                        break;
+                    }
+                    if (chunk[1] == kGlbJsonChunk) {
+                        chunks.json_ = std::string_view(reinterpret_cast<const char*>(bytes + offset), chunk[0]);
+                    }
+                    else if (chunk[1] == kGlbBinChunk) {
+                        chunks.bin_ = std::span<const std::byte>(bytes + offset, chunk[0]);
+                    }
+                    offset += chunk[0];
+                }
+            }
+            return chunks;
+        }
+    }
+
+    // ––– ReferencedFiles –––
+    std::vector<std::filesystem::path> GltfImporter::ReferencedFiles(const std::filesystem::path& path,
+        std::span<const std::byte> bytes)
+    {
+        std::vector<std::filesystem::path> files;
+        const std::string_view jsonText = SplitChunks(bytes).json_;
+        const json doc = json::parse(jsonText.begin(), jsonText.end(), nullptr, false);
+        if (doc.is_discarded() || !doc.contains("buffers") || !doc["buffers"].is_array()) {
+            return files;
+        }
+        for (const auto& buffer : doc["buffers"]) {
+            const std::string uri = buffer.is_object() ? buffer.value("uri", std::string()) : std::string();
+            if (!uri.empty() && uri.rfind("data:", 0) != 0) {
+                files.push_back(path.parent_path() / DecodeUri(uri));
+            }
+        }
+        return files;
+    }
+
+    // ––– Import –––
+    bool GltfImporter::Import(const std::filesystem::path& path, GltfModel& outModel)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        outModel = {};
+        if (!outModel.document_.Open(path)) {
+            Logger::GetLogger()->error("GltfImporter: Could not map '{}'.", path.string());
+            return false;
+        }
+
+        // 1) JSON (directly, or from the first GLB chunk) and the GLB BIN chunk if present.
+        const GltfChunks chunks = SplitChunks(outModel.document_.Bytes());
+        const std::string_view jsonText = chunks.json_;
+        const std::span<const std::byte> glbBin = chunks.bin_;
+
+        try {
+            const json doc = json::parse(jsonText.begin(), jsonText.end());
+            if (doc.at("asset").value("version", std::string()).rfind("2.", 0) != 0) {
+                Logger::GetLogger()->error("GltfImporter: '{}' is not glTF 2.x.", path.string());
+                return false;
+            }
+
+            // 2) Buffers: map external files, decode data URIs, point at the GLB chunk.
+            std::vector<std::span<const std::byte>> buffers;
+            const json emptyArray = json::array();
+            const json& bufferList = doc.contains("buffers") ? doc["buffers"] : emptyArray;
+            outModel.mappedBuffers_.reserve(bufferList.size());
+            outModel.decodedBuffers_.reserve(bufferList.size());
+            for (const auto& buffer : bufferList) {
+                const std::string uri = buffer.value("uri", std::string());
+                if (uri.empty()) {
+                    buffers.push_back(glbBin);
+                }
+                else if (uri.rfind("data:", 0) == 0) {
+                    const std::size_t comma = uri.find(',');
+                    outModel.decodedBuffers_.push_back(DecodeBase64(std::string_view(uri).substr(comma == std::string::npos ? uri.size() : comma + 1)));
+                    buffers.push_back(outModel.decodedBuffers_.back());
+                }
+                else {
+                    MappedFile& mapped = outModel.mappedBuffers_.emplace_back();
+                    const auto bufferPath = path.parent_path() / DecodeUri(uri);
+                    if (!mapped.Open(bufferPath)) {
+                        Logger::GetLogger()->error("GltfImporter: Could not map buffer '{}'.", bufferPath.string());
+                        return false;
+                    }
+                    buffers.push_back(mapped.Bytes());
+                }
+                if (buffers.back().size() < buffer.value("byteLength", std::size_t{ 0 })) {
+                    Logger::GetLogger()->error("GltfImporter: Buffer '{}' is shorter than its byteLength.", uri);
+                    return false;
+                }
+            }
+
+            // 3) Materials (a default one is appended for primitives without a material).
+            const json& materials = doc.contains("materials") ? doc["materials"] : emptyArray;
+            for (std::size_t i = 0; i < materials.size(); ++i) {
+                outModel.materials_.push_back(ReadMaterial(doc, materials[i], i));
+            }
+            std::optional<uint32_t> defaultMaterial;
+
+            // 4) Primitives; views read the buffers in place.
+            const json& meshes = doc.contains("meshes") ? doc["meshes"] : emptyArray;
+            std::size_t primitiveTotal = 0;
+            for (const auto& mesh : meshes) {
+                primitiveTotal += mesh.at("primitives").size();
+            }
+            outModel.primitives_.reserve(primitiveTotal);   // Generated attribute storage must not move.
+            std::vector<std::vector<uint32_t>> meshPrimitives(meshes.size());
+            for (std::size_t m = 0; m < meshes.size(); ++m) {
+                const json& primitives = meshes[m].at("primitives");
+                for (std::size_t p = 0; p < primitives.size(); ++p) {
+                    const json& primitive = primitives[p];
+                    const json& attributes = primitive.at("attributes");
+                    const int mode = primitive.value("mode", kModeTriangles);
+                    Accessor position;
+                    if (mode < kModeTriangles || !attributes.contains("POSITION") ||
+                        !ResolveAccessor(doc, buffers, attributes["POSITION"].get<std::size_t>(), position) ||
+                        position.components_ < 3)
+                    {
+                        Logger::GetLogger()->warn("GltfImporter: Skipping primitive {} of mesh {} (no triangles or no usable POSITION).", p, m);
+                        continue;
+                    }
+
+                    GltfPrimitive& out = outModel.primitives_.emplace_back();
+                    SourceMesh& source = out.source_;
+                    out.name_ = meshes[m].value("name", "mesh_" + std::to_string(m));
+                    source.vertexCount_ = position.count_;
+                    source.positions_ = MakeView<glm::vec3>(position);
+
+                    auto readOptional = [&](const char* name, std::size_t minComponents, Accessor& accessor) {
+                        return attributes.contains(name) &&
+                            ResolveAccessor(doc, buffers, attributes[name].get<std::size_t>(), accessor) &&
+                            accessor.components_ >= minComponents && accessor.count_ >= source.vertexCount_;
+                        };
+                    Accessor accessor;
+                    if (readOptional("NORMAL", 3, accessor)) {
+                        source.normals_ = MakeView<glm::vec3>(accessor);
+                    }
+                    if (readOptional("TANGENT", 3, accessor)) {
+                        source.tangents_ = MakeView<glm::vec3>(accessor);   // xyz of the vec4; w (handedness) is unused.
+                    }
+                    AttributeView<glm::vec2> texcoords[kMaxUVChannels];
+                    for (uint32_t c = 0; c < kMaxUVChannels; ++c) {
+                        if (readOptional(("TEXCOORD_" + std::to_string(c)).c_str(), 2, accessor)) {
+                            texcoords[c] = MakeView<glm::vec2>(accessor);
+                        }
+                    }
+                    for (uint32_t c = 0; c < kMaxUVChannels; ++c) {
+                        source.uvs_[c] = texcoords[c] ? texcoords[c] : texcoords[0];
+                    }
+
+                    if (primitive.contains("indices")) {
+                        Accessor indices;
+                        if (!ResolveAccessor(doc, buffers, primitive["indices"].get<std::size_t>(), indices) ||
+                            !ReadIndices(indices, source.indices_))
+                        {
+                            Logger::GetLogger()->error("GltfImporter: Unsupported index accessor in mesh {}.", m);
+                            return false;
+                        }
+                    }
+                    else {
+                        source.indices_.resize(source.vertexCount_);
+                        for (std::size_t i = 0; i < source.vertexCount_; ++i) {
+                            source.indices_[i] = static_cast<uint32_t>(i);
+                        }
+                    }
+                    if (mode != kModeTriangles) {
+                        source.indices_ = ToTriangleList(source.indices_, mode);
+                    }
+                    source.indices_.resize(source.indices_.size() - source.indices_.size() % 3);
+                    for (uint32_t index : source.indices_) {
+                        if (index >= source.vertexCount_) {
+                            Logger::GetLogger()->error("GltfImporter: Index {} out of range in mesh {}.", index, m);
+                            return false;
+                        }
+                    }
+
+                    if (!source.normals_ && settings_.generateNormals_) {
+                        out.generatedNormals_ = ComputeVertexNormals(source.vertexCount_, source.positions_, source.indices_);
+                        source.normals_ = AttributeView<glm::vec3>(out.generatedNormals_.data(), sizeof(glm::vec3));
+                    }
+                    if (!source.tangents_ && settings_.generateTangents_ && source.uvs_[0]) {
+                        out.generatedTangents_ = ComputeVertexTangents(source.vertexCount_, source.positions_,
+                            source.uvs_[0], source.normals_, source.indices_);
+                        source.tangents_ = AttributeView<glm::vec3>(out.generatedTangents_.data(), sizeof(glm::vec3));
+                    }
+
+                    const std::size_t material = primitive.value("material", materials.size());
+                    if (material < materials.size()) {
+                        out.materialSlot_ = static_cast<uint32_t>(material);
+                    }
+                    else {
+                        if (!defaultMaterial) {
+                            defaultMaterial = static_cast<uint32_t>(outModel.materials_.size());
+                            SourceMaterial fallback;
+                            fallback.name_ = "DefaultMaterial";
+                            outModel.materials_.push_back(std::move(fallback));
+                        }
+                        out.materialSlot_ = *defaultMaterial;
+                    }
+                    meshPrimitives[m].push_back(static_cast<uint32_t>(outModel.primitives_.size() - 1));
+                }
+            }
+
+            // 5) Place primitives by walking the default scene (or every root node).
+            const json& nodes = doc.contains("nodes") ? doc["nodes"] : emptyArray;
+            std::vector<std::size_t> roots;
+            if (doc.contains("scenes") && !doc["scenes"].empty()) {
+                const std::size_t scene = doc.value("scene", std::size_t{ 0 });
+                roots = doc["scenes"].at(scene).value("nodes", std::vector<std::size_t>{});
+            }
+            else {
+                std::vector<bool> isChild(nodes.size(), false);
+                for (const auto& node : nodes) {
+                    for (std::size_t child : node.value("children", std::vector<std::size_t>{})) {
+                        if (child < isChild.size()) {
+                            isChild[child] = true;
+                        }
+                    }
+                }
+                for (std::size_t n = 0; n < nodes.size(); ++n) {
+                    if (!isChild[n]) {
+                        roots.push_back(n);
+                    }
+                }
+            }
+            std::vector<std::pair<std::size_t, glm::mat4>> stack;
+            for (auto it = roots.rbegin(); it != roots.rend(); ++it) {
+                stack.push_back({ *it, glm::mat4(1.0f) });
+            }
+            std::size_t visited = 0;
+            while (!stack.empty()) {
+                auto [nodeIndex, parent] = stack.back();
+                stack.pop_back();
+                if (nodeIndex >= nodes.size() || ++visited > nodes.size() * 4 + 16) {
+                    continue;   // Invalid index or a cycle in a malformed file.
+                }
+                const json& node = nodes[nodeIndex];
+                const glm::mat4 world = parent * NodeTransform(node);
+                if (node.contains("mesh")) {
+                    const std::size_t mesh = node["mesh"].get<std::size_t>();
+                    if (mesh < meshPrimitives.size()) {
+                        for (uint32_t primitive : meshPrimitives[mesh]) {
+                            outModel.placements_.push_back({ primitive, world });
+                        }
+                    }
+                }
+                const auto children = node.value("children", std::vector<std::size_t>{});
+                for (auto it = children.rbegin(); it != children.rend(); ++it) {
+                    stack.push_back({ *it, world });
+                }
+            }
+        }
+        catch (const std::exception& e) {
+            Logger::GetLogger()->error("GltfImporter: Failed to parse '{}': {}", path.string(), e.what());
+            return false;
+        }
+
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        Logger::GetLogger()->info("GltfImporter: '{}' => {} primitives, {} placements, {} materials, {} mapped buffer(s) in {:.1f} ms.",
+            path.string(), outModel.primitives_.size(), outModel.placements_.size(), outModel.materials_.size(),
+            outModel.mappedBuffers_.size(), elapsed.count());
+        return !outModel.placements_.empty();
+    }
+
+} // namespace StaticLoader
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "Graphics/Meshes/SourceMesh.h"
+#include "Utilities/MappedFile.h"
+
+namespace StaticLoader {
+
+    /// One glTF primitive whose attribute views read the mapped buffers in place.
+    struct GltfPrimitive {
+        std::string name_;
+        uint32_t materialSlot_ = 0;                 ///< Index into GltfModel::materials_.
+        SourceMesh source_;
+        std::vector<glm::vec3> generatedNormals_;   ///< Backing store when the primitive has no NORMAL.
+        std::vector<glm::vec3> generatedTangents_;  ///< Backing store when the primitive has no TANGENT.
+    };
+
+    /// A primitive placed by the world transform of a node referencing its mesh.
+    struct GltfPlacement {
+        uint32_t primitive_ = 0;
+        glm::mat4 transform_ = glm::mat4(1.0f);
+    };
+
+    /**
+     * @brief Everything GltfImporter produces. Owns the mapped files the primitives point
+     *        into, so it must outlive every use of GltfPrimitive::source_.
+     */
+    struct GltfModel {
+        std::vector<SourceMaterial> materials_;
+        std::vector<GltfPrimitive> primitives_;     ///< One per (mesh, primitive) of the file.
+        std::vector<GltfPlacement> placements_;     ///< In scene traversal order.
+
+        MappedFile document_;                       ///< The .gltf/.glb itself (GLB BIN chunk lives here).
+        std::vector<MappedFile> mappedBuffers_;     ///< External .bin buffers.
+        std::vector<std::vector<std::byte>> decodedBuffers_;   ///< base64 data: URIs.
+    };
+
+    struct GltfImportSettings {
+        bool generateNormals_ = true;       ///< Area-weighted normals for primitives without NORMAL.
+        bool generateTangents_ = false;     ///< Tangents for primitives without TANGENT (needs TEXCOORD_0).
+    };
+
+    /**
+     * @brief Native glTF 2.0 importer (.gltf + .bin, or .glb).
+     *
+     * The JSON is parsed with nlohmann/json and every buffer is memory-mapped. Accessors are
+     * not decoded: vertex attributes become strided AttributeViews over the mapped bytes
+     * (float or normalized/unnormalized integer components), so ModelLoader reads them
+     * straight into graphics::Mesh storage. Only indices are widened to 32 bits. PBR slots
+     * map directly to TextureType (baseColor -> Diffuse, metallicRoughness -> MetalRoughness,
+     * normal -> Normal, occlusion -> AO, emissive -> Emissive).
+     *
+     * Sparse accessors, embedded images and non-triangle modes other than strips/fans are
+     * rejected or skipped (the caller falls back to Assimp when Import fails).
+     */
+    class GltfImporter {
+    public:
+        explicit GltfImporter(const GltfImportSettings& settings = {}) : settings_(settings) {}
+
+        /// @return false if the file cannot be read or uses unsupported features.
+        bool Import(const std::filesystem::path& path, GltfModel& outModel);
+
+        /// External buffers (not data URIs or the GLB chunk) of the .gltf/.glb @p bytes at @p path.
+        static std::vector<std::filesystem::path> ReferencedFiles(const std::filesystem::path& path,
+            std::span<const std::byte> bytes);
+
+    private:
+        GltfImportSettings settings_;
+    };
+
+} // namespace StaticLoader
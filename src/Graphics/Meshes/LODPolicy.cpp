@@ -0,0 +1,124 @@
+#include "LODPolicy.h"
+
+#include <algorithm>
+#include <meshoptimizer.h>
+
+#include "Utilities/Logger.h"
+
+namespace StaticLoader {
+
+    // ––– GatherLODAttributes –––
+    LODAttributes GatherLODAttributes(const graphics::Mesh& mesh, const LODPolicy& policy)
+    {
+        LODAttributes out;
+        const bool packed = mesh.IsPacked();
+        const bool hasNormals = policy.normalWeight_ > 0.0f &&
+            (packed ? mesh.vertexFormat_.normalOffset_ != graphics::VertexFormat::kAbsent : !mesh.normals_.empty());
+        const bool hasUVs = policy.uvWeight_ > 0.0f &&
+            (packed ? mesh.vertexFormat_.uvOffsets_[0] != graphics::VertexFormat::kAbsent
+                : !mesh.uvs_.empty() && !mesh.uvs_[0].empty());
+        if (hasNormals) {
+            out.weights_.insert(out.weights_.end(), 3, policy.normalWeight_);
+        }
+        if (hasUVs) {
+            out.weights_.insert(out.weights_.end(), 2, policy.uvWeight_);
+        }
+        out.floatsPerVertex_ = out.weights_.size();
+        if (out.floatsPerVertex_ == 0) {
+            return out;
+        }
+
+        const std::size_t vertexCount = mesh.GetVertexCount();
+        out.data_.reserve(vertexCount * out.floatsPerVertex_);
+        for (std::size_t i = 0; i < vertexCount; ++i) {
+            if (hasNormals) {
+                const glm::vec3 n = mesh.GetNormal(i);
+                out.data_.insert(out.data_.end(), { n.x, n.y, n.z });
+            }
+            if (hasUVs) {
+                const glm::vec2 uv = mesh.GetUV(0, i);
+                out.data_.insert(out.data_.end(), { uv.x, uv.y });
+            }
+        }
+        return out;
+    }
+
+    // ––– GenerateLODChain –––
+    std::vector<LODLevel> GenerateLODChain(std::vector<uint32_t> lod0,
+        const std::vector<float>& positions3f,
+        const LODAttributes& attributes,
+        const LODPolicy& policy)
+    {
+        std::vector<LODLevel> chain;
+        const std::size_t vertexCount = positions3f.size() / 3;
+        const std::size_t minIndices = static_cast<std::size_t>(policy.minTriangles_) * 3;
+        const bool simplifiable = !lod0.empty() && vertexCount > 0 && lod0.size() > minIndices;
+        chain.push_back({ std::move(lod0), 0.0f });
+        if (!simplifiable) {
+            return chain;
+        }
+
+        // meshoptimizer errors are relative to the mesh extent.
+        const float scale = meshopt_simplifyScale(positions3f.data(), vertexCount, sizeof(float) * 3);
+        if (scale <= 0.0f) {
+            return chain;
+        }
+        const bool withAttributes = attributes.floatsPerVertex_ > 0 &&
+            attributes.data_.size() == vertexCount * attributes.floatsPerVertex_;
+        const unsigned options = policy.lockBorder_ ? meshopt_SimplifyLockBorder : 0u;
+
+        float budget = policy.firstLevelError_;
+        std::vector<uint32_t> simplified;
+        while (chain.size() < policy.maxLevels_ && budget / scale <= policy.maxRelativeError_) {
+            const LODLevel& previous = chain.back();
+            if (previous.indices_.size() <= minIndices) {
+                break;
+            }
+
+            // The step may use whatever the budget has left after the previous levels.
+            const float stepError = std::max(budget - previous.error_, 0.0f) / scale;
+            const std::size_t maxIndices = static_cast<std::size_t>(previous.indices_.size() * policy.maxTriangleRatio_) / 3 * 3;
+            simplified.resize(previous.indices_.size());
+            float resultError = 0.0f;
+            std::size_t count = withAttributes
+                ? meshopt_simplifyWithAttributes(simplified.data(), previous.indices_.data(), previous.indices_.size(),
+                    positions3f.data(), vertexCount, sizeof(float) * 3,
+                    attributes.data_.data(), sizeof(float) * attributes.floatsPerVertex_,
+                    attributes.weights_.data(), attributes.floatsPerVertex_, nullptr,
+                    minIndices, stepError, options, &resultError)
+                : meshopt_simplify(simplified.data(), previous.indices_.data(), previous.indices_.size(),
+                    positions3f.data(), vertexCount, sizeof(float) * 3,
+                    minIndices, stepError, options, &resultError);
+
+            bool sloppy = false;
+            if (count > maxIndices && policy.sloppyFallback_ && chain.size() > 1) {
+                // Topology (seams, borders) stalls the regular simplifier; trade quality for reduction.
+                float sloppyError = 0.0f;
+                const std::size_t sloppyCount = meshopt_simplifySloppy(simplified.data(), previous.indices_.data(),
+                    previous.indices_.size(), positions3f.data(), vertexCount, sizeof(float) * 3,
+                    minIndices, stepError, &sloppyError);
+                if (sloppyCount > 0 && sloppyCount <= maxIndices) {
+                    count = sloppyCount;
+                    resultError = sloppyError;
+                    sloppy = true;
+                }
+            }
+
+            if (count == 0 || count > maxIndices) {
+                // Not enough reduction for this budget: reject and retry with a larger one.
+                budget *= policy.errorGrowth_;
+                continue;
+            }
+
+            simplified.resize(count);
+            meshopt_optimizeVertexCache(simplified.data(), simplified.data(), count, vertexCount);
+            const float error = previous.error_ + resultError * scale;
+            Logger::GetLogger()->debug("LOD{} => {} indices, error {:.4g} (budget {:.4g}){}",
+                chain.size(), count, error, budget, sloppy ? " [sloppy]" : "");
+            chain.push_back({ simplified, error });
+            budget = std::max(budget, error) * policy.errorGrowth_;
+        }
+        return chain;
+    }
+
+} // namespace StaticLoader
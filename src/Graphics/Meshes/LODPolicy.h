@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Graphics/Meshes/Mesh.h"
+
+namespace StaticLoader {
+
+    /**
+     * @brief How ModelLoader builds the LOD chain of a mesh.
+     *
+     * Levels are driven by geometric error rather than by a fixed index ratio: LOD n may
+     * deviate from LOD0 by up to firstLevelError_ * errorGrowth_^(n-1) world units (mesh
+     * units for instanced layouts), converted to meshoptimizer's relative error through
+     * meshopt_simplifyScale. A candidate that keeps more than maxTriangleRatio_ of the
+     * previous level's triangles is rejected and the next, larger budget is tried instead,
+     * so tiny props get few levels and large meshes keep simplifying.
+     */
+    struct LODPolicy {
+        uint8_t maxLevels_ = 8;             ///< Including LOD0.
+        float firstLevelError_ = 0.005f;    ///< World-space error budget of LOD1.
+        float errorGrowth_ = 2.0f;          ///< Budget multiplier from one level (or rejected attempt) to the next.
+        float maxRelativeError_ = 0.5f;     ///< Stop once the budget exceeds this fraction of the mesh extent.
+        float maxTriangleRatio_ = 0.75f;    ///< A level must keep at most this share of the previous level's triangles.
+        uint32_t minTriangles_ = 64;        ///< Meshes (or levels) at or below this are not simplified further.
+        bool lockBorder_ = false;           ///< Keep open-boundary vertices (meshopt_SimplifyLockBorder), avoids cracks between sub-meshes.
+        bool sloppyFallback_ = true;        ///< Try meshopt_simplifySloppy when topology blocks the regular simplifier.
+
+        /// Attribute-aware simplification (meshopt_simplifyWithAttributes); a zero weight disables the attribute.
+        float normalWeight_ = 0.5f;
+        float uvWeight_ = 0.0f;             ///< Channel 0 only; errors are in UV units, so keep it small.
+
+        bool UsesAttributes() const { return normalWeight_ > 0.0f || uvWeight_ > 0.0f; }
+    };
+
+    /// One level of a LOD chain: indices local to the mesh vertices plus the error bound to LOD0.
+    struct LODLevel {
+        std::vector<uint32_t> indices_;
+        float error_ = 0.0f;                ///< World (mesh) units; 0 for LOD0.
+        graphics::BoundingSphere bounds_;   ///< Filled by the caller if it wants per-LOD spheres.
+    };
+
+    /// Interleaved attribute stream fed to meshopt_simplifyWithAttributes.
+    struct LODAttributes {
+        std::vector<float> data_;
+        std::vector<float> weights_;        ///< One per float of a vertex.
+        std::size_t floatsPerVertex_ = 0;   ///< 0 when the mesh has none of the weighted attributes.
+    };
+
+    /// Gathers the attributes @p policy weights (normals, UV channel 0) that @p mesh actually has.
+    LODAttributes GatherLODAttributes(const graphics::Mesh& mesh, const LODPolicy& policy);
+
+    /**
+     * @brief Builds the LOD chain of @p lod0 (kept as level 0).
+     *
+     * Each level is simplified from the previous one; its error_ is the sum of the
+     * per-step errors, an upper bound of the deviation from LOD0. Levels are vertex
+     * cache optimized.
+     *
+     * @param positions3f Flattened mesh positions.
+     * @param attributes  Optional attribute stream (see GatherLODAttributes).
+     */
+    std::vector<LODLevel> GenerateLODChain(std::vector<uint32_t> lod0,
+        const std::vector<float>& positions3f,
+        const LODAttributes& attributes,
+        const LODPolicy& policy);
+
+} // namespace StaticLoader
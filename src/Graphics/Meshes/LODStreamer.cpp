@@ -0,0 +1,89 @@
+#include "LODStreamer.h"
+
+#include "Utilities/Logger.h"
+#include "Utilities/ThreadPool.h"
+
+namespace StaticLoader {
+
+    LODStreamer& LODStreamer::GetInstance() {
+        static LODStreamer instance;
+        return instance;
+    }
+
+    void LODStreamer::Submit(std::vector<std::shared_ptr<graphics::Mesh>> meshes,
+        Generator generator,
+        std::function<void()> onComplete)
+    {
+        if (meshes.empty()) {
+            if (onComplete) {
+                onComplete();
+            }
+            return;
+        }
+
+        auto group = std::make_shared<Group>();
+        group->remaining_ = meshes.size();
+        group->onComplete_ = std::move(onComplete);
+        auto sharedGenerator = std::make_shared<Generator>(std::move(generator));
+
+        pending_ += meshes.size();
+        for (auto& mesh : meshes) {
+            // Background: threads waiting on loads or ParallelFor must not pick up a whole LOD build.
+            ThreadPool::GetInstance().SubmitBackground([this, mesh, group, sharedGenerator]() {
+                LODChain lods;
+                try {
+                    lods = (*sharedGenerator)(*mesh);
+                }
+                catch (const std::exception& e) {
+                    // The mesh simply stays at LOD0.
+                    Logger::GetLogger()->error("LODStreamer: LOD generation failed: {}", e.what());
+                }
+                std::lock_guard<std::mutex> lock(finishedMutex_);
+                finished_.push_back({ mesh, std::move(lods), group });
+                });
+        }
+    }
+
+    std::vector<std::shared_ptr<graphics::Mesh>> LODStreamer::PublishCompleted() {
+        std::vector<Finished> ready;
+        {
+            std::lock_guard<std::mutex> lock(finishedMutex_);
+            ready.swap(finished_);
+        }
+        if (ready.empty()) {
+            return {};
+        }
+
+        std::vector<std::shared_ptr<graphics::Mesh>> published;
+        published.reserve(ready.size());
+        for (auto& item : ready) {
+            auto& mesh = *item.mesh_;
+            mesh.EnsureResident();      // The chain extends Mesh::indices_.
+            for (auto& level : item.lods_) {
+                graphics::MeshLOD lod;
+                lod.indexOffset_ = static_cast<uint32_t>(mesh.indices_.size());
+                lod.indexCount_ = static_cast<uint32_t>(level.indices_.size());
+                lod.error_ = level.error_;
+                lod.center_ = level.bounds_.center_;
+                lod.radius_ = level.bounds_.radius_;
+                mesh.indices_.insert(mesh.indices_.end(), level.indices_.begin(), level.indices_.end());
+                mesh.lods_.push_back(lod);
+            }
+            if (!item.lods_.empty()) {
+                published.push_back(item.mesh_);
+            }
+            --pending_;
+            if (--item.group_->remaining_ == 0 && item.group_->onComplete_) {
+                item.group_->onComplete_();
+            }
+        }
+
+        if (!published.empty()) {
+            ++publishCount_;
+        }
+        Logger::GetLogger()->info("LODStreamer: Published coarse LODs for {} mesh(es), {} pending.",
+            published.size(), pending_.load());
+        return published;
+    }
+
+} // namespace StaticLoader
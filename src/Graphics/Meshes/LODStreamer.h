@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Graphics/Meshes/Mesh.h"
+#include "Graphics/Meshes/LODPolicy.h"
+
+namespace StaticLoader {
+
+    /**
+     * @brief Generates coarse LODs on background workers and hands them to the main thread.
+     *
+     * Meshes are published with LOD0 only; the generator runs as background work on the
+     * shared ThreadPool (see ThreadPool::SubmitBackground) and must only read the mesh. Results are appended to Mesh::indices_/lods_ exclusively from
+     * PublishCompleted(), which the render thread calls once per frame, so the mesh is never
+     * written while a renderer reads it.
+     */
+    class LODStreamer {
+    public:
+        /// Coarse LODs (LOD1, LOD2, ...) with their errors, indices local to the mesh vertex range.
+        using LODChain = std::vector<LODLevel>;
+        using Generator = std::function<LODChain(const graphics::Mesh&)>;
+
+        static LODStreamer& GetInstance();
+
+        /**
+         * @brief Queues LOD generation for a set of meshes.
+         * @param onComplete Invoked on the main thread (inside PublishCompleted) after the
+         *                   last mesh of this set has been published.
+         */
+        void Submit(std::vector<std::shared_ptr<graphics::Mesh>> meshes,
+            Generator generator,
+            std::function<void()> onComplete = {});
+
+        /**
+         * @brief Moves finished LOD chains into their meshes. Main thread only.
+         * @return The meshes that gained LODs during this call.
+         */
+        std::vector<std::shared_ptr<graphics::Mesh>> PublishCompleted();
+
+        /**
+         * @brief Number of PublishCompleted() calls that added LODs. Main thread only.
+         *
+         * Meshes are shared between scenes while only one of them drains the streamer, so
+         * renderers compare this counter instead of relying on the returned mesh list.
+         */
+        std::uint64_t GetPublishCount() const { return publishCount_; }
+
+        /// Number of meshes whose LODs are still being generated or awaiting publication.
+        std::size_t GetPendingCount() const { return pending_.load(); }
+
+    private:
+        LODStreamer() = default;
+
+        struct Group {
+            std::size_t remaining_ = 0;
+            std::function<void()> onComplete_;
+        };
+
+        struct Finished {
+            std::shared_ptr<graphics::Mesh> mesh_;
+            LODChain lods_;
+            std::shared_ptr<Group> group_;
+        };
+
+        std::mutex finishedMutex_;
+        std::vector<Finished> finished_;
+        std::atomic<std::size_t> pending_{ 0 };
+        std::uint64_t publishCount_ = 0;
+    };
+
+} // namespace StaticLoader
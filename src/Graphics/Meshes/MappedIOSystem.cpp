@@ -0,0 +1,132 @@
+#include "MappedIOSystem.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+#include "Utilities/Logger.h"
+
+namespace StaticLoader {
+
+    // ––– MappedIOStream –––
+    MappedIOStream::MappedIOStream(std::shared_ptr<const MappedFile> file, ImportIOStats& stats)
+        : file_(std::move(file)),
+        stats_(stats)
+    {
+        if (file_) {
+            data_ = file_->Data();
+            size_ = file_->Size();
+        }
+    }
+
+    size_t MappedIOStream::Read(void* buffer, size_t size, size_t count) {
+        if (size == 0 || count == 0 || position_ >= size_) {
+            return 0;
+        }
+        // Like fread: only whole elements are returned.
+        const std::size_t elements = std::min(count, (size_ - position_) / size);
+        const std::size_t bytes = elements * size;
+        const auto start = std::chrono::steady_clock::now();
+        std::memcpy(buffer, data_ + position_, bytes);
+        stats_.ioMilliseconds_ += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        stats_.bytesRead_ += bytes;
+        position_ += bytes;
+        return elements;
+    }
+
+    size_t MappedIOStream::Write(const void*, size_t, size_t) {
+        return 0;
+    }
+
+    aiReturn MappedIOStream::Seek(size_t offset, aiOrigin origin) {
+        std::size_t target = 0;
+        switch (origin) {
+        case aiOrigin_SET: target = offset; break;
+        case aiOrigin_CUR: target = position_ + offset; break;
+        case aiOrigin_END: target = size_ - offset; break;
+        default: return aiReturn_FAILURE;
+        }
+        if (target > size_) {
+            return aiReturn_FAILURE;
+        }
+        position_ = target;
+        return aiReturn_SUCCESS;
+    }
+
+    // ––– MappedIOSystem –––
+    bool MappedIOSystem::Exists(const char* file) const {
+        std::error_code ec;
+        return file && std::filesystem::is_regular_file(file, ec);
+    }
+
+    char MappedIOSystem::getOsSeparator() const {
+#ifdef _WIN32
+        return '\\';
+#else
+        return '/';
+#endif
+    }
+
+    Assimp::IOStream* MappedIOSystem::Open(const char* file, const char* mode) {
+        if (!file || (mode && (std::strchr(mode, 'w') || std::strchr(mode, 'a') || std::strchr(mode, '+')))) {
+            Logger::GetLogger()->warn("MappedIOSystem: Refusing to open '{}' with mode '{}' (read-only).",
+                file ? file : "", mode ? mode : "");
+            return nullptr;
+        }
+
+        std::error_code ec;
+        const auto fileSize = std::filesystem::file_size(file, ec);
+        if (ec) {
+            return nullptr;
+        }
+
+        std::shared_ptr<const MappedFile> mapped;
+        if (fileSize > 0) {
+            mapped = Map(file);
+            if (!mapped) {
+                Logger::GetLogger()->error("MappedIOSystem: Could not map '{}'.", file);
+                return nullptr;
+            }
+        }
+        ++stats_.filesOpened_;
+        return new MappedIOStream(std::move(mapped), stats_);
+    }
+
+    void MappedIOSystem::Close(Assimp::IOStream* file) {
+        delete file;
+    }
+
+    std::shared_ptr<const MappedFile> MappedIOSystem::Map(const std::string& path) {
+        std::error_code ec;
+        std::string key = std::filesystem::weakly_canonical(path, ec).string();
+        if (ec) {
+            key = path;
+        }
+
+        auto it = std::find_if(cache_.begin(), cache_.end(), [&](const auto& entry) { return entry.first == key; });
+        if (it != cache_.end()) {
+            cache_.splice(cache_.begin(), cache_, it);
+            ++stats_.cacheHits_;
+            return cache_.front().second;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        auto mapped = std::make_shared<MappedFile>();
+        if (!mapped->Open(path)) {
+            return nullptr;
+        }
+        stats_.ioMilliseconds_ += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        stats_.bytesMapped_ += mapped->Size();
+
+        if (cacheCapacity_ > 0) {
+            cache_.emplace_front(std::move(key), mapped);
+            if (cache_.size() > cacheCapacity_) {
+                cache_.pop_back();  // Open streams keep their own reference.
+            }
+        }
+        return mapped;
+    }
+
+} // namespace StaticLoader
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
+
+#include "Utilities/MappedFile.h"
+
+namespace StaticLoader {
+
+    /// I/O counters of one Assimp import served by MappedIOSystem.
+    struct ImportIOStats {
+        uint32_t filesOpened_ = 0;          ///< Open() calls that returned a stream.
+        uint32_t cacheHits_ = 0;            ///< Opens served from an already mapped file.
+        uint64_t bytesMapped_ = 0;          ///< Size of all files mapped (each file counted once).
+        uint64_t bytesRead_ = 0;            ///< Bytes copied out through IOStream::Read.
+        double ioMilliseconds_ = 0.0;       ///< Time spent mapping files and copying (page faults included).
+    };
+
+    /**
+     * @brief Read-only Assimp IOStream over a memory-mapped file.
+     *
+     * Reads are plain memcpys out of the mapping; the mapping is shared with the
+     * owning MappedIOSystem's handle cache, so it outlives the stream if still cached.
+     */
+    class MappedIOStream : public Assimp::IOStream {
+    public:
+        MappedIOStream(std::shared_ptr<const MappedFile> file, ImportIOStats& stats);
+
+        size_t Read(void* buffer, size_t size, size_t count) override;
+        size_t Write(const void* buffer, size_t size, size_t count) override;
+        aiReturn Seek(size_t offset, aiOrigin origin) override;
+        size_t Tell() const override { return position_; }
+        size_t FileSize() const override { return size_; }
+        void Flush() override {}
+
+    private:
+        std::shared_ptr<const MappedFile> file_;    ///< Null for empty files.
+        const std::byte* data_ = nullptr;
+        std::size_t size_ = 0;
+        std::size_t position_ = 0;
+        ImportIOStats& stats_;
+    };
+
+    /**
+     * @brief Assimp IOSystem that serves model and material reads from mmap'ed files.
+     *
+     * Install it with Assimp::Importer::SetIOHandler (the importer takes ownership).
+     * Recently opened files stay mapped in a small LRU cache so repeated opens of the
+     * same file (MTL libraries, glTF buffers, probing by several importers) do not
+     * remap it. Write modes are not supported; Assimp does not write during import.
+     */
+    class MappedIOSystem : public Assimp::IOSystem {
+    public:
+        explicit MappedIOSystem(std::size_t cacheCapacity = 8) : cacheCapacity_(cacheCapacity) {}
+
+        bool Exists(const char* file) const override;
+        char getOsSeparator() const override;
+        Assimp::IOStream* Open(const char* file, const char* mode = "rb") override;
+        void Close(Assimp::IOStream* file) override;
+
+        const ImportIOStats& GetStats() const { return stats_; }
+
+    private:
+        std::shared_ptr<const MappedFile> Map(const std::string& path);
+
+        std::size_t cacheCapacity_;
+        std::list<std::pair<std::string, std::shared_ptr<const MappedFile>>> cache_;   ///< Most recent first.
+        ImportIOStats stats_;
+    };
+
+} // namespace StaticLoader
@@ -0,0 +1,324 @@
+#include "Mesh.h"
+
+#include <algorithm>
+#include <meshoptimizer.h>
+
+namespace graphics {
+
+    namespace {
+        // Copies one attribute stream into its slot of every interleaved vertex (zeros when missing).
+        template <typename T>
+        void ScatterAttribute(const std::vector<T>& src, size_t vertexCount, int32_t offset,
+            uint32_t stride, std::byte* dst)
+        {
+            if (offset == VertexFormat::kAbsent) {
+                return;
+            }
+            const T zero(0.0f);
+            for (size_t i = 0; i < vertexCount; ++i) {
+                const T& value = i < src.size() ? src[i] : zero;
+                std::memcpy(dst + i * stride + offset, &value, sizeof(T));
+            }
+        }
+
+        template <typename T>
+        void FreeVector(std::vector<T>& values) {
+            std::vector<T>().swap(values);
+        }
+
+        template <typename T>
+        size_t CapacityBytes(const std::vector<T>& values) {
+            return values.capacity() * sizeof(T);
+        }
+
+        EncodedGeometry::Stream EncodeVertexStream(const void* vertices, size_t count, size_t stride) {
+            EncodedGeometry::Stream stream;
+            if (count == 0) {
+                return stream;
+            }
+            stream.bytes_.resize(meshopt_encodeVertexBufferBound(count, stride));
+            stream.bytes_.resize(meshopt_encodeVertexBuffer(stream.bytes_.data(), stream.bytes_.size(), vertices, count, stride));
+            stream.bytes_.shrink_to_fit();
+            stream.count_ = static_cast<uint32_t>(count);
+            stream.stride_ = static_cast<uint32_t>(stride);
+            return stream;
+        }
+
+        template <typename T>
+        EncodedGeometry::Stream EncodeVector(const std::vector<T>& values) {
+            return EncodeVertexStream(values.data(), values.size(), sizeof(T));
+        }
+
+        template <typename T>
+        bool DecodeVector(const EncodedGeometry::Stream& stream, std::vector<T>& values) {
+            values.resize(stream.count_);
+            return stream.count_ == 0 ||
+                meshopt_decodeVertexBuffer(values.data(), stream.count_, sizeof(T), stream.bytes_.data(), stream.bytes_.size()) == 0;
+        }
+    }
+
+    void Mesh::Translate(const glm::vec3& delta) {
+        if (!IsPacked()) {
+            for (auto& p : positions_) {
+                p += delta;
+            }
+        }
+        else if (vertexFormat_.quantized_) {
+            quantization_.positionOffset_ += delta;
+        }
+        else {
+            for (size_t i = 0, n = GetVertexCount(); i < n; ++i) {
+                SetPosition(i, GetPosition(i) + delta);
+            }
+        }
+        for (auto& cluster : clusters_) {
+            cluster.center_ += delta;
+            cluster.coneApex_ += delta;
+        }
+        for (auto& lod : lods_) {
+            lod.center_ += delta;
+        }
+        orientedBox_.center_ += delta;
+    }
+
+    void Mesh::ComputeBounds(const BoundsSettings& settings, std::span<const float> positions3f) {
+        std::vector<float> flattened;
+        const size_t vertexCount = GetVertexCount();
+        if (positions3f.size() != vertexCount * 3) {
+            flattened.reserve(vertexCount * 3);
+            for (size_t i = 0; i < vertexCount; ++i) {
+                const glm::vec3 p = GetPosition(i);
+                flattened.insert(flattened.end(), { p.x, p.y, p.z });
+            }
+            positions3f = flattened;
+        }
+
+        minBounds_ = glm::vec3(FLT_MAX);
+        maxBounds_ = glm::vec3(-FLT_MAX);
+        for (size_t i = 0; i < vertexCount; ++i) {
+            const glm::vec3 p(positions3f[i * 3], positions3f[i * 3 + 1], positions3f[i * 3 + 2]);
+            minBounds_ = glm::min(minBounds_, p);
+            maxBounds_ = glm::max(maxBounds_, p);
+        }
+
+        const BoundingSphere sphere = ComputeBoundingSphere(positions3f, {}, settings.sphereFit_);
+        localCenter_ = sphere.center_;
+        boundingSphereRadius_ = sphere.radius_;
+        orientedBox_ = settings.orientedBoxes_ ? ComputeOrientedBox(positions3f) : OrientedBox{};
+
+        for (auto& lod : lods_) {
+            BoundingSphere lodSphere;
+            if (settings.perLODSpheres_ && lod.indexCount_ > 0) {
+                lodSphere = ComputeBoundingSphere(positions3f,
+                    std::span<const uint32_t>(indices_.data() + lod.indexOffset_, lod.indexCount_), settings.sphereFit_);
+            }
+            lod.center_ = lodSphere.center_;
+            lod.radius_ = lodSphere.radius_;
+        }
+    }
+
+    MeshResidency Mesh::SetResidency(MeshResidency residency) {
+        const bool needsSource = residency == MeshResidency::PositionsAndIndices || residency == MeshResidency::Evicted;
+        if (needsSource && !(geometrySource_ && geometrySource_->IsAvailable())) {
+            residency = MeshResidency::Compressed;
+        }
+        if (residency == residency_) {
+            return residency_;
+        }
+
+        // Every reduced state is derived from the full data.
+        if (residency_ != MeshResidency::Full && !RestoreGeometry()) {
+            return residency_;
+        }
+        residency_ = MeshResidency::Full;
+
+        switch (residency) {
+        case MeshResidency::Full:
+            break;
+        case MeshResidency::PositionsAndIndices:
+            ReleaseGeometry(true);
+            break;
+        case MeshResidency::Compressed:
+            Encode();
+            ReleaseGeometry(false);
+            break;
+        case MeshResidency::Evicted:
+            ReleaseGeometry(false);
+            break;
+        }
+        residency_ = residency;
+        return residency_;
+    }
+
+    size_t Mesh::GetCPUMemoryBytes() const {
+        size_t bytes = CapacityBytes(positions_) + CapacityBytes(normals_) + CapacityBytes(tangents_) +
+            CapacityBytes(packedVertices_) + CapacityBytes(indices_) + CapacityBytes(lods_) +
+            CapacityBytes(clusters_) + encoded_.GetByteSize();
+        for (const auto& channel : uvs_) {
+            bytes += CapacityBytes(channel);
+        }
+        return bytes;
+    }
+
+    bool Mesh::RestoreGeometry() {
+        if (residency_ == MeshResidency::Compressed) {
+            return Decode();
+        }
+        return geometrySource_ && geometrySource_->Reload(*this);
+    }
+
+    void Mesh::Encode() {
+        encoded_ = {};
+        encoded_.packed_ = IsPacked();
+        if (encoded_.packed_) {
+            encoded_.vertexStreams_.push_back(EncodeVertexStream(packedVertices_.data(), GetVertexCount(), vertexFormat_.stride_));
+        }
+        else {
+            encoded_.vertexStreams_.push_back(EncodeVector(positions_));
+            encoded_.vertexStreams_.push_back(EncodeVector(normals_));
+            encoded_.vertexStreams_.push_back(EncodeVector(tangents_));
+            for (const auto& channel : uvs_) {
+                encoded_.vertexStreams_.push_back(EncodeVector(channel));
+            }
+        }
+
+        if (indices_.size() % 3 == 0) {
+            auto& stream = encoded_.indices_;
+            stream.bytes_.resize(meshopt_encodeIndexBufferBound(indices_.size(), GetVertexCount()));
+            stream.bytes_.resize(meshopt_encodeIndexBuffer(stream.bytes_.data(), stream.bytes_.size(), indices_.data(), indices_.size()));
+            stream.bytes_.shrink_to_fit();
+            stream.count_ = static_cast<uint32_t>(indices_.size());
+        }
+        else {
+            encoded_.indices_ = EncodeVector(indices_);     // Not a triangle list: the index codec cannot take it.
+        }
+    }
+
+    bool Mesh::Decode() {
+        bool ok = true;
+        const auto& streams = encoded_.vertexStreams_;
+        if (encoded_.packed_) {
+            const auto& stream = streams.at(0);
+            packedVertices_.resize(static_cast<size_t>(stream.count_) * stream.stride_);
+            ok = stream.count_ == 0 || meshopt_decodeVertexBuffer(packedVertices_.data(), stream.count_, stream.stride_,
+                stream.bytes_.data(), stream.bytes_.size()) == 0;
+        }
+        else {
+            ok = DecodeVector(streams.at(0), positions_) && DecodeVector(streams.at(1), normals_) &&
+                DecodeVector(streams.at(2), tangents_);
+            uvs_.resize(streams.size() - 3);
+            for (size_t c = 0; ok && c < uvs_.size(); ++c) {
+                ok = DecodeVector(streams[3 + c], uvs_[c]);
+            }
+        }
+
+        const auto& stream = encoded_.indices_;
+        if (ok && stream.stride_ != 0) {
+            ok = DecodeVector(stream, indices_);
+        }
+        else if (ok) {
+            indices_.resize(stream.count_);
+            ok = stream.count_ == 0 ||
+                meshopt_decodeIndexBuffer(indices_.data(), stream.count_, sizeof(uint32_t), stream.bytes_.data(), stream.bytes_.size()) == 0;
+        }
+
+        if (!ok) {
+            ReleaseGeometry(false);     // Keep the encoded copy; the partial decode is useless.
+            return false;
+        }
+        encoded_ = {};
+        return true;
+    }
+
+    void Mesh::ReleaseGeometry(bool keepPositions) {
+        if (keepPositions && IsPacked()) {
+            std::vector<glm::vec3> positions(GetVertexCount());
+            for (size_t i = 0; i < positions.size(); ++i) {
+                positions[i] = GetPosition(i);
+            }
+            positions_ = std::move(positions);
+        }
+        if (!keepPositions) {
+            FreeVector(positions_);
+            FreeVector(indices_);
+        }
+        FreeVector(normals_);
+        FreeVector(tangents_);
+        FreeVector(uvs_);
+        FreeVector(packedVertices_);
+    }
+
+    QuantizationParams Mesh::GetQuantizationParams() const {
+        if (IsPacked() && vertexFormat_.quantized_) {
+            return quantization_;
+        }
+        const size_t vertexCount = GetVertexCount();
+        glm::vec3 minPos(FLT_MAX), maxPos(-FLT_MAX);
+        for (size_t i = 0; i < vertexCount; ++i) {
+            const glm::vec3 p = GetPosition(i);
+            minPos = glm::min(minPos, p);
+            maxPos = glm::max(maxPos, p);
+        }
+        glm::vec2 minUV(FLT_MAX), maxUV(-FLT_MAX);
+        for (uint32_t c = 0; c < kMaxUVChannels; ++c) {
+            if (IsPacked() ? !vertexFormat_.HasUV(c) : (c >= uvs_.size() || uvs_[c].empty())) {
+                continue;
+            }
+            for (size_t i = 0; i < vertexCount; ++i) {
+                const glm::vec2 uv = GetUV(c, i);
+                minUV = glm::min(minUV, uv);
+                maxUV = glm::max(maxUV, uv);
+            }
+        }
+        if (vertexCount == 0) {
+            minPos = maxPos = glm::vec3(0.0f);
+        }
+        if (minUV.x > maxUV.x) {
+            minUV = maxUV = glm::vec2(0.0f);
+        }
+        return quantization::MakeParams(minPos, maxPos, minUV, maxUV);
+    }
+
+    void Mesh::WriteInterleaved(const VertexFormat& format, std::byte* dst, const QuantizationParams& params) const {
+        const size_t vertexCount = GetVertexCount();
+        if (IsPacked() && format == vertexFormat_ && (!format.quantized_ || params == quantization_)) {
+            std::memcpy(dst, packedVertices_.data(), packedVertices_.size());
+            return;
+        }
+
+        if (IsPacked() || format.quantized_) {
+            // Re-layout (and re-encode) vertex by vertex through a scratch single-vertex mesh.
+            Mesh scratch;
+            scratch.vertexFormat_ = format;
+            scratch.quantization_ = params;
+            scratch.packedVertices_.resize(format.stride_);
+            for (size_t i = 0; i < vertexCount; ++i) {
+                std::fill(scratch.packedVertices_.begin(), scratch.packedVertices_.end(), std::byte{ 0 });
+                scratch.SetPosition(0, GetPosition(i));
+                scratch.SetNormal(0, GetNormal(i));
+                scratch.SetTangent(0, GetTangent(i));
+                for (uint32_t c = 0; c < kMaxUVChannels; ++c) {
+                    if (format.HasUV(c)) {
+                        scratch.SetUV(c, 0, GetUV(c, i));
+                    }
+                }
+                std::memcpy(dst + i * format.stride_, scratch.packedVertices_.data(), format.stride_);
+            }
+            return;
+        }
+
+        // Unpacked: one strided pass per attribute.
+        if (format.bitangentOffset_ != VertexFormat::kAbsent) {
+            std::memset(dst, 0, vertexCount * format.stride_);
+        }
+        ScatterAttribute(positions_, vertexCount, format.positionOffset_, format.stride_, dst);
+        ScatterAttribute(normals_, vertexCount, format.normalOffset_, format.stride_, dst);
+        ScatterAttribute(tangents_, vertexCount, format.tangentOffset_, format.stride_, dst);
+        static const std::vector<glm::vec2> kNoUVs;
+        for (size_t c = 0; c < kMaxUVChannels; ++c) {
+            ScatterAttribute(c < uvs_.size() ? uvs_[c] : kNoUVs,
+                vertexCount, format.uvOffsets_[c], format.stride_, dst);
+        }
+    }
+
+} // namespace graphics
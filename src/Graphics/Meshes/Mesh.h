@@ -1,11 +1,18 @@
 #pragma once
 
 #include <vector>
+#include <array>
 #include <cfloat>       // For FLT_MAX
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
 #include <glm/glm.hpp>
-#include <unordered_map>
 #include "Graphics/Materials/MaterialParamType.h"  // Assumes TextureType is defined in a header
+#include "Graphics/Meshes/VertexFormat.h"
+#include "Graphics/Meshes/VertexQuantization.h"
+#include "Graphics/Meshes/BoundingVolumes.h"
 
 namespace graphics {
 
@@ -13,6 +20,71 @@ namespace graphics {
     struct MeshLOD {
         uint32_t indexOffset_ = 0;
         uint32_t indexCount_ = 0;
+        uint32_t firstCluster_ = 0;     ///< Into Mesh::clusters_.
+        uint32_t clusterCount_ = 0;     ///< 0 if the LOD was not split into clusters.
+        float error_ = 0.0f;            ///< Max deviation from LOD0 in mesh units (0 for LOD0 and unsimplified meshes).
+        glm::vec3 center_ = glm::vec3(0.0f);    ///< Sphere around the vertices this LOD references...
+        float radius_ = 0.0f;                   ///< ...or 0 when not computed (use the mesh sphere).
+    };
+
+    /**
+     * @brief What a mesh keeps in CPU memory once its geometry has been uploaded.
+     *
+     * Batches only read vertex and index data while they are (re)built, so after the
+     * upload the CPU copy can shrink. Bounds, LOD ranges and clusters always stay.
+     */
+    enum class MeshResidency : uint8_t {
+        Full,                   ///< Everything (the default).
+        PositionsAndIndices,    ///< Positions and the LOD index chain only (CPU picking/culling); needs a GeometrySource to restore.
+        Compressed,             ///< Vertex streams and indices meshopt-encoded (lossless), decoded on demand.
+        Evicted                 ///< No vertex or index data; needs a GeometrySource to restore.
+    };
+
+    struct Mesh;
+
+    /// Refills the vertex and index data of a released mesh (e.g. from the mesh cache).
+    class GeometrySource {
+    public:
+        virtual ~GeometrySource() = default;
+        /// Whether Reload can currently succeed.
+        virtual bool IsAvailable() const = 0;
+        /// Restores the vertex streams and indices of @p mesh; false leaves it unchanged.
+        virtual bool Reload(Mesh& mesh) const = 0;
+    };
+
+    /// meshopt-encoded vertex streams and indices of a Compressed mesh.
+    struct EncodedGeometry {
+        struct Stream {
+            std::vector<unsigned char> bytes_;
+            uint32_t count_ = 0;        ///< Elements (vertices or indices); 0 for an absent stream.
+            uint32_t stride_ = 0;       ///< Bytes per vertex; for indices, 0 = index codec, 4 = vertex codec (not a triangle list).
+        };
+        bool packed_ = false;
+        /// Packed meshes: the interleaved buffer. Otherwise positions, normals, tangents, then one per UV channel.
+        std::vector<Stream> vertexStreams_;
+        Stream indices_;
+
+        size_t GetByteSize() const {
+            size_t bytes = indices_.bytes_.capacity();
+            for (const auto& s : vertexStreams_) bytes += s.bytes_.capacity();
+            return bytes;
+        }
+    };
+
+    /**
+     * @brief A meshlet: a contiguous index range of one LOD plus its culling bounds.
+     *
+     * The cone is meshoptimizer's backface cone: the cluster can be skipped when
+     * dot(normalize(coneApex_ - cameraPos), coneAxis_) >= coneCutoff_.
+     */
+    struct MeshCluster {
+        uint32_t indexOffset_ = 0;      ///< Into Mesh::indices_ (inside its LOD's range).
+        uint32_t indexCount_ = 0;
+        glm::vec3 center_ = glm::vec3(0.0f);
+        float radius_ = 0.0f;
+        glm::vec3 coneApex_ = glm::vec3(0.0f);
+        float coneCutoff_ = 1.0f;       ///< 1 = never cone-culled.
+        glm::vec3 coneAxis_ = glm::vec3(0.0f, 0.0f, 1.0f);
     };
 
     /**
@@ -20,6 +92,11 @@ namespace graphics {
      *
      * Contains vertex positions, normals, tangents, bitangents, UV sets,
      * index data, LOD information, and bounding volumes.
+     *
+     * Vertices live either in the per-attribute vectors or, for packed meshes, in one
+     * interleaved buffer (packedVertices_) laid out by vertexFormat_. The typed accessors
+     * work for both representations. Quantized packed meshes decode/encode through
+     * quantization_ (see graphics::VertexFormat for the encodings).
      */
     struct Mesh {
         // Vertex data.
@@ -27,21 +104,179 @@ namespace graphics {
         std::vector<glm::vec3> normals_;
         std::vector<glm::vec3> tangents_;
 
-        // UV sets keyed by TextureType (e.g., Albedo).
-        std::unordered_map<TextureType, std::vector<glm::vec2>> uvs_;
+        // UV sets indexed by UV channel (see MeshLayout::uvChannels_); empty channels are unused.
+        std::vector<std::vector<glm::vec2>> uvs_;
+
+        // Packed interleaved vertices in GPU order (empty for unpacked meshes).
+        VertexFormat vertexFormat_;
+        std::vector<std::byte> packedVertices_;
+        QuantizationParams quantization_;   // Only meaningful when vertexFormat_.quantized_
 
         // Index data and LOD info.
         std::vector<uint32_t> indices_;
         std::vector<MeshLOD>  lods_;
+        std::vector<MeshCluster> clusters_;     // Optional, referenced by MeshLOD::firstCluster_.
 
         // Bounding volume data.
         glm::vec3 minBounds_ = glm::vec3(FLT_MAX);
         glm::vec3 maxBounds_ = glm::vec3(-FLT_MAX);
-        glm::vec3 localCenter_ = glm::vec3(0.0f);
+        glm::vec3 localCenter_ = glm::vec3(0.0f);  // Bounding sphere center (not necessarily the AABB midpoint).
         float     boundingSphereRadius_ = 1.0f;
+        OrientedBox orientedBox_;                   // Invalid unless ComputeBounds fitted one.
+
+        // CPU residency (see SetResidency). Main thread only; never change it while a
+        // worker (e.g. LODStreamer) may still read the mesh.
+        MeshResidency residency_ = MeshResidency::Full;
+        bool cpuReleasable_ = false;                // Set by loaders whose meshes are only consumed by batches.
+        std::shared_ptr<const GeometrySource> geometrySource_;
+        EncodedGeometry encoded_;                   // Only filled while Compressed.
 
         /// @return the number of LOD levels.
         size_t GetLODCount() const { return lods_.size(); }
+
+        bool IsPacked() const { return !packedVertices_.empty(); }
+
+        size_t GetVertexCount() const {
+            return IsPacked() ? packedVertices_.size() / vertexFormat_.stride_ : positions_.size();
+        }
+
+        // Typed accessors (both representations). Missing attributes read as zero.
+        glm::vec3 GetPosition(size_t i) const {
+            if (!IsPacked()) return positions_[i];
+            if (!vertexFormat_.quantized_) return ReadPacked<glm::vec3>(vertexFormat_.positionOffset_, i);
+            const auto q = ReadPacked<std::array<uint16_t, 4>>(vertexFormat_.positionOffset_, i);
+            return quantization_.positionOffset_ + quantization_.positionScale_ * glm::vec3(
+                quantization::DecodeUnorm16(q[0]), quantization::DecodeUnorm16(q[1]), quantization::DecodeUnorm16(q[2]));
+        }
+        glm::vec3 GetNormal(size_t i) const { return IsPacked() ? ReadDirection(vertexFormat_.normalOffset_, i) : ReadVector(normals_, i); }
+        glm::vec3 GetTangent(size_t i) const { return IsPacked() ? ReadDirection(vertexFormat_.tangentOffset_, i) : ReadVector(tangents_, i); }
+        glm::vec2 GetUV(uint32_t channel, size_t i) const {
+            if (IsPacked()) {
+                const int32_t offset = channel < kMaxUVChannels ? vertexFormat_.uvOffsets_[channel] : VertexFormat::kAbsent;
+                if (!vertexFormat_.quantized_) return ReadPacked<glm::vec2>(offset, i);
+                if (offset == VertexFormat::kAbsent) return glm::vec2(0.0f);
+                const auto q = ReadPacked<std::array<uint16_t, 2>>(offset, i);
+                return quantization_.uvOffset_ + quantization_.uvScale_ *
+                    glm::vec2(quantization::DecodeUnorm16(q[0]), quantization::DecodeUnorm16(q[1]));
+            }
+            return channel < uvs_.size() ? ReadVector(uvs_[channel], i) : glm::vec2(0.0f);
+        }
+
+        // Writers for packed meshes; attributes absent from vertexFormat_ are ignored.
+        // Quantized meshes need quantization_ set before positions/UVs are written.
+        void SetPosition(size_t i, const glm::vec3& v) {
+            if (!vertexFormat_.quantized_) return WritePacked(vertexFormat_.positionOffset_, i, v);
+            const auto& q = quantization_;
+            const std::array<uint16_t, 4> e = {
+                quantization::EncodeRange(v.x, q.positionOffset_.x, q.positionScale_.x),
+                quantization::EncodeRange(v.y, q.positionOffset_.y, q.positionScale_.y),
+                quantization::EncodeRange(v.z, q.positionOffset_.z, q.positionScale_.z), 0 };
+            WritePacked(vertexFormat_.positionOffset_, i, e);
+        }
+        void SetNormal(size_t i, const glm::vec3& v) { WriteDirection(vertexFormat_.normalOffset_, i, v); }
+        void SetTangent(size_t i, const glm::vec3& v) { WriteDirection(vertexFormat_.tangentOffset_, i, v); }
+        void SetUV(uint32_t channel, size_t i, const glm::vec2& v) {
+            const int32_t offset = channel < kMaxUVChannels ? vertexFormat_.uvOffsets_[channel] : VertexFormat::kAbsent;
+            if (!vertexFormat_.quantized_) return WritePacked(offset, i, v);
+            const auto& q = quantization_;
+            const std::array<uint16_t, 2> e = {
+                quantization::EncodeRange(v.x, q.uvOffset_.x, q.uvScale_.x),
+                quantization::EncodeRange(v.y, q.uvOffset_.y, q.uvScale_.y) };
+            WritePacked(offset, i, e);
+        }
+
+        /**
+         * @brief Moves every vertex (and cluster bound) by @p delta.
+         *
+         * Quantized meshes only shift their dequantization offset, so no precision is lost.
+         */
+        void Translate(const glm::vec3& delta);
+
+        /**
+         * @brief Ranges covering this mesh's positions and UVs.
+         *
+         * Returns quantization_ for quantized packed meshes, otherwise the tight bounds
+         * of the current vertex data.
+         */
+        QuantizationParams GetQuantizationParams() const;
+
+        /**
+         * @brief Recomputes the AABB, the bounding sphere (localCenter_/boundingSphereRadius_),
+         *        the oriented box and the per-LOD spheres as selected by @p settings.
+         * @param positions3f Flattened positions if the caller already has them; read from the mesh otherwise.
+         */
+        void ComputeBounds(const BoundsSettings& settings, std::span<const float> positions3f = {});
+
+        /// Sphere enclosing @p lod (the mesh sphere when no per-LOD sphere was computed).
+        BoundingSphere GetLODSphere(size_t lod) const {
+            if (lod < lods_.size() && lods_[lod].radius_ > 0.0f) return { lods_[lod].center_, lods_[lod].radius_ };
+            return { localCenter_, boundingSphereRadius_ };
+        }
+
+        /**
+         * @brief Moves the mesh to @p residency, restoring the full data first if needed.
+         *
+         * PositionsAndIndices and Evicted need an available geometrySource_; without one
+         * the mesh is compressed instead. @return the residency the mesh ended up in.
+         */
+        MeshResidency SetResidency(MeshResidency residency);
+
+        /// Restores full vertex and index data. @return false if it could not be restored.
+        bool EnsureResident() { return residency_ == MeshResidency::Full || SetResidency(MeshResidency::Full) == MeshResidency::Full; }
+
+        /// Bytes of CPU memory held by vertex, index, LOD, cluster and encoded data.
+        size_t GetCPUMemoryBytes() const;
+
+        /**
+         * @brief Writes all vertices interleaved in @p format to @p dst
+         *        (GetVertexCount() * format.stride_ bytes).
+         *
+         * A packed mesh whose format (and, if quantized, whose params) matches is a single
+         * memcpy. @p params is only used when @p format is quantized.
+         */
+        void WriteInterleaved(const VertexFormat& format, std::byte* dst,
+            const QuantizationParams& params = {}) const;
+
+    private:
+        bool RestoreGeometry();
+        void Encode();
+        bool Decode();
+        void ReleaseGeometry(bool keepPositions);
+
+        template <typename T>
+        T ReadPacked(int32_t offset, size_t i) const {
+            T value;
+            std::memset(&value, 0, sizeof(T));
+            if (offset != VertexFormat::kAbsent) {
+                std::memcpy(&value, packedVertices_.data() + i * vertexFormat_.stride_ + offset, sizeof(T));
+            }
+            return value;
+        }
+
+        template <typename T>
+        void WritePacked(int32_t offset, size_t i, const T& value) {
+            if (offset != VertexFormat::kAbsent) {
+                std::memcpy(packedVertices_.data() + i * vertexFormat_.stride_ + offset, &value, sizeof(T));
+            }
+        }
+
+        glm::vec3 ReadDirection(int32_t offset, size_t i) const {
+            if (!vertexFormat_.quantized_) return ReadPacked<glm::vec3>(offset, i);
+            if (offset == VertexFormat::kAbsent) return glm::vec3(0.0f);
+            const auto q = ReadPacked<std::array<int16_t, 2>>(offset, i);
+            return quantization::OctDecode(glm::vec2(quantization::DecodeSnorm16(q[0]), quantization::DecodeSnorm16(q[1])));
+        }
+
+        void WriteDirection(int32_t offset, size_t i, const glm::vec3& v) {
+            if (!vertexFormat_.quantized_) return WritePacked(offset, i, v);
+            const glm::vec2 e = quantization::OctEncode(v);
+            WritePacked(offset, i, std::array<int16_t, 2>{ quantization::EncodeSnorm16(e.x), quantization::EncodeSnorm16(e.y) });
+        }
+
+        template <typename T>
+        static T ReadVector(const std::vector<T>& values, size_t i) {
+            return i < values.size() ? values[i] : T(0.0f);
+        }
     };
 
-} // namespace graphics
\ No newline at end of file
+} // namespace graphics
@@ -0,0 +1,599 @@
+#include "MeshCache.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <span>
+#include <type_traits>
+
+#include "Graphics/Meshes/GltfImporter.h"
+#include "Graphics/Meshes/ObjImporter.h"
+#include "Utilities/MappedFile.h"
+#include "Utilities/Logger.h"
+
+namespace StaticLoader {
+
+    namespace {
+
+        constexpr char kMagic[4] = { 'O', 'G', 'M', 'C' };
+
+        enum AttributeBits : uint32_t {
+            kHasPositions = 1u << 0,
+            kHasNormals = 1u << 1,
+            kHasTangents = 1u << 2,
+            kPacked = 1u << 3   ///< Vertices stored interleaved (VertexFormat + packed bytes).
+        };
+
+        struct FileHeader {
+            char     magic_[4];
+            uint32_t version_;
+            uint64_t key_;
+            uint32_t materialCount_;
+            uint32_t meshCount_;
+        };
+
+        struct MeshHeader {
+            uint32_t vertexCount_;
+            uint32_t indexCount_;
+            uint32_t lodCount_;
+            uint32_t clusterCount_;
+            uint32_t attributeMask_;
+            uint32_t uvSetCount_;
+            uint32_t materialSlot_;
+            uint32_t instanceCount_;
+            float    minBounds_[3];
+            float    maxBounds_[3];
+            float    localCenter_[3];
+            float    boundingSphereRadius_;
+            float    obbCenter_[3];
+            float    obbAxes_[9];
+            float    obbHalfExtents_[3];        // x < 0: no oriented box.
+        };
+
+        // ––– Hashing –––
+        constexpr uint64_t kFnvOffset = 14695981039346656037ull;
+        constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+        /// FNV-1a over 64-bit words (tail bytes folded in one by one).
+        uint64_t HashBytes(std::span<const std::byte> bytes, uint64_t seed) {
+            uint64_t h = seed;
+            std::size_t i = 0;
+            for (; i + sizeof(uint64_t) <= bytes.size(); i += sizeof(uint64_t)) {
+                uint64_t word;
+                std::memcpy(&word, bytes.data() + i, sizeof(word));
+                h ^= word;
+                h *= kFnvPrime;
+            }
+            for (; i < bytes.size(); ++i) {
+                h ^= static_cast<uint64_t>(bytes[i]);
+                h *= kFnvPrime;
+            }
+            return h;
+        }
+
+        template <typename T>
+        uint64_t HashValue(const T& value, uint64_t seed) {
+            static_assert(std::is_trivially_copyable_v<T>);
+            return HashBytes(std::as_bytes(std::span<const T, 1>(&value, 1)), seed);
+        }
+
+        // ––– Serialization helpers –––
+        class BinaryWriter {
+        public:
+            template <typename T>
+            void Write(const T& value) {
+                static_assert(std::is_trivially_copyable_v<T>);
+                const auto* p = reinterpret_cast<const std::byte*>(&value);
+                buffer_.insert(buffer_.end(), p, p + sizeof(T));
+            }
+
+            template <typename T>
+            void WriteArray(const std::vector<T>& values) {
+                static_assert(std::is_trivially_copyable_v<T>);
+                const auto* p = reinterpret_cast<const std::byte*>(values.data());
+                buffer_.insert(buffer_.end(), p, p + values.size() * sizeof(T));
+            }
+
+            void WriteString(const std::string& s) {
+                Write(static_cast<uint32_t>(s.size()));
+                const auto* p = reinterpret_cast<const std::byte*>(s.data());
+                buffer_.insert(buffer_.end(), p, p + s.size());
+            }
+
+            const std::vector<std::byte>& Buffer() const { return buffer_; }
+
+        private:
+            std::vector<std::byte> buffer_;
+        };
+
+        class BinaryReader {
+        public:
+            explicit BinaryReader(std::span<const std::byte> bytes) : bytes_(bytes) {}
+
+            template <typename T>
+            bool Read(T& value) {
+                static_assert(std::is_trivially_copyable_v<T>);
+                if (offset_ + sizeof(T) > bytes_.size()) return false;
+                std::memcpy(&value, bytes_.data() + offset_, sizeof(T));
+                offset_ += sizeof(T);
+                return true;
+            }
+
+            template <typename T>
+            bool ReadArray(std::vector<T>& values, std::size_t count) {
+                static_assert(std::is_trivially_copyable_v<T>);
+                const std::size_t byteCount = count * sizeof(T);
+                if (offset_ + byteCount > bytes_.size()) return false;
+                values.resize(count);
+                std::memcpy(values.data(), bytes_.data() + offset_, byteCount);
+                offset_ += byteCount;
+                return true;
+            }
+
+            bool Skip(std::size_t byteCount) {
+                if (offset_ + byteCount > bytes_.size()) return false;
+                offset_ += byteCount;
+                return true;
+            }
+
+            bool ReadString(std::string& s) {
+                uint32_t length = 0;
+                if (!Read(length) || offset_ + length > bytes_.size()) return false;
+                s.assign(reinterpret_cast<const char*>(bytes_.data() + offset_), length);
+                offset_ += length;
+                return true;
+            }
+
+        private:
+            std::span<const std::byte> bytes_;
+            std::size_t offset_ = 0;
+        };
+
+        void WriteMaterial(BinaryWriter& w, const MaterialRecord& mat) {
+            w.WriteString(mat.name_);
+            w.Write(static_cast<uint32_t>(mat.params_.size()));
+            for (const auto& p : mat.params_) {
+                w.Write(static_cast<uint32_t>(p.type_));
+                w.Write(p.value_);
+            }
+            w.Write(static_cast<uint32_t>(mat.textures_.size()));
+            for (const auto& t : mat.textures_) {
+                w.Write(static_cast<uint32_t>(t.type_));
+                w.WriteString(t.name_);
+                w.WriteString(t.path_);
+            }
+        }
+
+        bool ReadMaterial(BinaryReader& r, MaterialRecord& mat) {
+            uint32_t paramCount = 0, textureCount = 0;
+            if (!r.ReadString(mat.name_) || !r.Read(paramCount)) return false;
+            mat.params_.resize(paramCount);
+            for (auto& p : mat.params_) {
+                uint32_t type = 0;
+                if (!r.Read(type) || !r.Read(p.value_)) return false;
+                p.type_ = static_cast<MaterialParamType>(type);
+            }
+            if (!r.Read(textureCount)) return false;
+            mat.textures_.resize(textureCount);
+            for (auto& t : mat.textures_) {
+                uint32_t type = 0;
+                if (!r.Read(type) || !r.ReadString(t.name_) || !r.ReadString(t.path_)) return false;
+                t.type_ = static_cast<TextureType>(type);
+            }
+            return true;
+        }
+
+        void WriteMesh(BinaryWriter& w, const CachedMesh& entry) {
+            const graphics::Mesh& mesh = *entry.mesh_;
+            const auto vertexCount = static_cast<uint32_t>(mesh.GetVertexCount());
+            const bool packed = mesh.IsPacked();
+
+            // UV channels that hold a full set (ascending, so identical inputs produce identical files).
+            std::vector<uint32_t> uvChannels;
+            if (!packed) {
+                for (uint32_t c = 0; c < mesh.uvs_.size(); ++c) {
+                    if (mesh.uvs_[c].size() == vertexCount && vertexCount) uvChannels.push_back(c);
+                }
+            }
+
+            MeshHeader h{};
+            h.vertexCount_ = vertexCount;
+            h.indexCount_ = static_cast<uint32_t>(mesh.indices_.size());
+            h.lodCount_ = static_cast<uint32_t>(mesh.lods_.size());
+            h.clusterCount_ = static_cast<uint32_t>(mesh.clusters_.size());
+            if (packed) {
+                h.attributeMask_ = kPacked;
+            }
+            else {
+                h.attributeMask_ = (vertexCount ? kHasPositions : 0u) |
+                    (mesh.normals_.size() == vertexCount && vertexCount ? kHasNormals : 0u) |
+                    (mesh.tangents_.size() == vertexCount && vertexCount ? kHasTangents : 0u);
+            }
+            h.uvSetCount_ = static_cast<uint32_t>(uvChannels.size());
+            h.materialSlot_ = entry.materialSlot_;
+            h.instanceCount_ = static_cast<uint32_t>(entry.instances_.size());
+            for (int i = 0; i < 3; ++i) {
+                h.minBounds_[i] = mesh.minBounds_[i];
+                h.maxBounds_[i] = mesh.maxBounds_[i];
+                h.localCenter_[i] = mesh.localCenter_[i];
+            }
+            h.boundingSphereRadius_ = mesh.boundingSphereRadius_;
+            for (int i = 0; i < 3; ++i) {
+                h.obbCenter_[i] = mesh.orientedBox_.center_[i];
+                h.obbHalfExtents_[i] = mesh.orientedBox_.halfExtents_[i];
+                for (int j = 0; j < 3; ++j) {
+                    h.obbAxes_[i * 3 + j] = mesh.orientedBox_.axes_[i][j];
+                }
+            }
+            w.Write(h);
+
+            if (packed) {
+                w.Write(mesh.vertexFormat_);
+                w.Write(mesh.quantization_);
+                w.WriteArray(mesh.packedVertices_);
+            }
+            else {
+                w.WriteArray(uvChannels);
+                if (h.attributeMask_ & kHasPositions) w.WriteArray(mesh.positions_);
+                if (h.attributeMask_ & kHasNormals)   w.WriteArray(mesh.normals_);
+                if (h.attributeMask_ & kHasTangents)  w.WriteArray(mesh.tangents_);
+                for (uint32_t channel : uvChannels) {
+                    w.WriteArray(mesh.uvs_[channel]);
+                }
+            }
+            for (const auto& lod : mesh.lods_) {
+                w.Write(lod);
+            }
+            w.WriteArray(mesh.clusters_);
+            w.WriteArray(mesh.indices_);
+            w.WriteArray(entry.instances_);
+        }
+
+        bool ReadMesh(BinaryReader& r, CachedMesh& entry) {
+            MeshHeader h{};
+            if (!r.Read(h)) return false;
+
+            auto mesh = std::make_shared<graphics::Mesh>();
+            if (h.attributeMask_ & kPacked) {
+                if (!r.Read(mesh->vertexFormat_) || !mesh->vertexFormat_.IsValid()) return false;
+                if (!r.Read(mesh->quantization_)) return false;
+                const std::size_t byteCount = static_cast<std::size_t>(h.vertexCount_) * mesh->vertexFormat_.stride_;
+                if (!r.ReadArray(mesh->packedVertices_, byteCount)) return false;
+            }
+            else {
+                std::vector<uint32_t> uvChannels;
+                if (!r.ReadArray(uvChannels, h.uvSetCount_)) return false;
+                if ((h.attributeMask_ & kHasPositions) && !r.ReadArray(mesh->positions_, h.vertexCount_)) return false;
+                if ((h.attributeMask_ & kHasNormals) && !r.ReadArray(mesh->normals_, h.vertexCount_)) return false;
+                if ((h.attributeMask_ & kHasTangents) && !r.ReadArray(mesh->tangents_, h.vertexCount_)) return false;
+                for (uint32_t channel : uvChannels) {
+                    if (channel >= kMaxUVChannels) return false;
+                    if (mesh->uvs_.size() <= channel) mesh->uvs_.resize(channel + 1);
+                    if (!r.ReadArray(mesh->uvs_[channel], h.vertexCount_)) return false;
+                }
+            }
+            mesh->lods_.resize(h.lodCount_);
+            for (auto& lod : mesh->lods_) {
+                if (!r.Read(lod)) return false;
+                if (static_cast<uint64_t>(lod.indexOffset_) + lod.indexCount_ > h.indexCount_) return false;
+                if (static_cast<uint64_t>(lod.firstCluster_) + lod.clusterCount_ > h.clusterCount_) return false;
+            }
+            if (!r.ReadArray(mesh->clusters_, h.clusterCount_)) return false;
+            for (const auto& cluster : mesh->clusters_) {
+                if (static_cast<uint64_t>(cluster.indexOffset_) + cluster.indexCount_ > h.indexCount_) return false;
+            }
+            if (!r.ReadArray(mesh->indices_, h.indexCount_)) return false;
+            if (!r.ReadArray(entry.instances_, h.instanceCount_)) return false;
+
+            mesh->minBounds_ = glm::vec3(h.minBounds_[0], h.minBounds_[1], h.minBounds_[2]);
+            mesh->maxBounds_ = glm::vec3(h.maxBounds_[0], h.maxBounds_[1], h.maxBounds_[2]);
+            mesh->localCenter_ = glm::vec3(h.localCenter_[0], h.localCenter_[1], h.localCenter_[2]);
+            mesh->boundingSphereRadius_ = h.boundingSphereRadius_;
+            for (int i = 0; i < 3; ++i) {
+                mesh->orientedBox_.center_[i] = h.obbCenter_[i];
+                mesh->orientedBox_.halfExtents_[i] = h.obbHalfExtents_[i];
+                for (int j = 0; j < 3; ++j) {
+                    mesh->orientedBox_.axes_[i][j] = h.obbAxes_[i * 3 + j];
+                }
+            }
+
+            entry.mesh_ = std::move(mesh);
+            entry.materialSlot_ = h.materialSlot_;
+            return true;
+        }
+
+        /// Steps over one mesh block without decoding it.
+        bool SkipMesh(BinaryReader& r) {
+            MeshHeader h{};
+            if (!r.Read(h)) return false;
+
+            const std::size_t vertexCount = h.vertexCount_;
+            std::size_t bytes = 0;
+            if (h.attributeMask_ & kPacked) {
+                graphics::VertexFormat format;
+                if (!r.Read(format) || !format.IsValid()) return false;
+                bytes += sizeof(graphics::QuantizationParams) + vertexCount * format.stride_;
+            }
+            else {
+                const std::size_t vec3Streams = ((h.attributeMask_ & kHasPositions) ? 1 : 0) +
+                    ((h.attributeMask_ & kHasNormals) ? 1 : 0) + ((h.attributeMask_ & kHasTangents) ? 1 : 0);
+                bytes += h.uvSetCount_ * sizeof(uint32_t) + vec3Streams * vertexCount * sizeof(glm::vec3) +
+                    h.uvSetCount_ * vertexCount * sizeof(glm::vec2);
+            }
+            bytes += h.lodCount_ * sizeof(graphics::MeshLOD) + h.clusterCount_ * sizeof(graphics::MeshCluster) +
+                h.indexCount_ * sizeof(uint32_t) + h.instanceCount_ * sizeof(glm::mat4);
+            return r.Skip(bytes);
+        }
+
+    } // namespace
+
+    // ––– Constructor –––
+    MeshCache::MeshCache(std::filesystem::path cacheDirectory)
+        : cacheDirectory_(std::move(cacheDirectory))
+    {
+    }
+
+    // ––– ComputeKey –––
+    std::optional<uint64_t> MeshCache::ComputeKey(const std::filesystem::path& sourceFile,
+        const MeshLayout& meshLayout,
+        const MaterialLayout& matLayout,
+        const std::unordered_map<aiTextureType, TextureType>& textureTypes,
+        float scaleFactor,
+        const LODPolicy& lodPolicy,
+        bool centerModel,
+        bool packedVertices,
+        const MeshOptimizationSettings& optimization,
+        const MeshClusterSettings& clusters,
+        const graphics::BoundsSettings& bounds,
+        bool nativeImporter)
+    {
+        MappedFile source(sourceFile);
+        if (!source.IsOpen()) {
+            return std::nullopt;
+        }
+        uint64_t h = HashBytes(source.Bytes(), kFnvOffset);
+        h = HashValue(static_cast<uint64_t>(source.Size()), h);
+
+        // The material libraries and buffers the file references affect the result too. A missing
+        // one still hashes its name, so the key changes once it appears.
+        std::string ext = sourceFile.extension().string();
+        std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        std::vector<std::filesystem::path> companions;
+        if (ext == ".obj") {
+            companions = ObjImporter::ReferencedFiles(sourceFile, source.Bytes());
+        }
+        else if (ext == ".gltf" || ext == ".glb") {
+            companions = GltfImporter::ReferencedFiles(sourceFile, source.Bytes());
+        }
+        for (const auto& companion : companions) {
+            const std::string name = companion.generic_string();
+            h = HashBytes(std::as_bytes(std::span(name.data(), name.size())), h);
+            MappedFile extra(companion);
+            if (extra.IsOpen()) {
+                h = HashBytes(extra.Bytes(), h);
+                h = HashValue(static_cast<uint64_t>(extra.Size()), h);
+            }
+        }
+
+        const uint32_t layoutBits =
+            (meshLayout.hasPositions_ ? 1u : 0u) |
+            (meshLayout.hasNormals_ ? 2u : 0u) |
+            (meshLayout.hasTangents_ ? 4u : 0u) |
+            (meshLayout.hasBitangents_ ? 8u : 0u) |
+            (meshLayout.quantized_ ? 16u : 0u) |
+            (meshLayout.instanced_ ? 32u : 0u);
+        h = HashValue(layoutBits, h);
+        h = HashValue(static_cast<uint64_t>(meshLayout.textureTypes_.to_ullong()), h);
+        h = HashValue(meshLayout.uvChannels_, h);
+        h = HashValue(static_cast<uint64_t>(matLayout.params_.to_ullong()), h);
+        h = HashValue(static_cast<uint64_t>(matLayout.textures_.to_ullong()), h);
+        // Sorted: the map's iteration order is unspecified.
+        std::vector<std::pair<uint32_t, uint32_t>> textureMap;
+        textureMap.reserve(textureTypes.size());
+        for (const auto& [aiType, type] : textureTypes) {
+            textureMap.emplace_back(static_cast<uint32_t>(aiType), static_cast<uint32_t>(type));
+        }
+        std::sort(textureMap.begin(), textureMap.end());
+        for (const auto& [aiType, type] : textureMap) {
+            h = HashValue(aiType, h);
+            h = HashValue(type, h);
+        }
+        h = HashValue(scaleFactor, h);
+        h = HashValue(lodPolicy.maxLevels_, h);
+        h = HashValue(lodPolicy.firstLevelError_, h);
+        h = HashValue(lodPolicy.errorGrowth_, h);
+        h = HashValue(lodPolicy.maxRelativeError_, h);
+        h = HashValue(lodPolicy.maxTriangleRatio_, h);
+        h = HashValue(lodPolicy.minTriangles_, h);
+        h = HashValue(lodPolicy.normalWeight_, h);
+        h = HashValue(lodPolicy.uvWeight_, h);
+        const uint32_t lodBits = (lodPolicy.lockBorder_ ? 1u : 0u) | (lodPolicy.sloppyFallback_ ? 2u : 0u);
+        h = HashValue(lodBits, h);
+        h = HashValue(static_cast<uint8_t>(centerModel), h);
+        h = HashValue(static_cast<uint8_t>(packedVertices), h);
+        const uint32_t optimizationBits =
+            (optimization.vertexCache_ ? 1u : 0u) |
+            (optimization.overdraw_ ? 2u : 0u) |
+            (optimization.vertexFetch_ ? 4u : 0u);
+        h = HashValue(optimizationBits, h);
+        h = HashValue(optimization.overdrawThreshold_, h);
+        h = HashValue(static_cast<uint8_t>(clusters.enabled_), h);
+        if (clusters.enabled_) {
+            h = HashValue(clusters.maxVertices_, h);
+            h = HashValue(clusters.maxTriangles_, h);
+            h = HashValue(clusters.coneWeight_, h);
+        }
+        const uint32_t boundsBits = static_cast<uint32_t>(bounds.sphereFit_) |
+            (bounds.orientedBoxes_ ? 0x100u : 0u) |
+            (bounds.perLODSpheres_ ? 0x200u : 0u);
+        h = HashValue(boundsBits, h);
+        h = HashValue(static_cast<uint8_t>(nativeImporter), h);
+        h = HashValue(kFormatVersion, h);
+        return h;
+    }
+
+    // ––– GetEntryPath –––
+    std::filesystem::path MeshCache::GetEntryPath(const std::string& modelName, uint64_t key) const {
+        char hex[17];
+        std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(key));
+        return cacheDirectory_ / (modelName + "_" + hex + ".meshcache");
+    }
+
+    // ––– Load –––
+    bool MeshCache::Load(const std::string& modelName, uint64_t key, CachedModel& outModel) const {
+        const auto path = GetEntryPath(modelName, key);
+        MappedFile file(path);
+        if (!file.IsOpen()) {
+            return false;
+        }
+
+        BinaryReader reader(file.Bytes());
+        FileHeader header{};
+        if (!reader.Read(header) ||
+            std::memcmp(header.magic_, kMagic, sizeof(kMagic)) != 0 ||
+            header.version_ != kFormatVersion ||
+            header.key_ != key)
+        {
+            Logger::GetLogger()->warn("MeshCache: Ignoring stale or foreign entry '{}'.", path.string());
+            return false;
+        }
+
+        CachedModel model;
+        model.materials_.resize(header.materialCount_);
+        for (auto& mat : model.materials_) {
+            if (!ReadMaterial(reader, mat)) {
+                Logger::GetLogger()->warn("MeshCache: Truncated material block in '{}'.", path.string());
+                return false;
+            }
+        }
+        model.meshes_.resize(header.meshCount_);
+        for (auto& mesh : model.meshes_) {
+            if (!ReadMesh(reader, mesh) || mesh.materialSlot_ >= model.materials_.size()) {
+                Logger::GetLogger()->warn("MeshCache: Corrupt mesh block in '{}'.", path.string());
+                return false;
+            }
+        }
+
+        outModel = std::move(model);
+        return true;
+    }
+
+    // ––– LoadMesh –––
+    bool MeshCache::LoadMesh(const std::string& modelName, uint64_t key, uint32_t meshIndex, CachedMesh& outMesh) const {
+        const auto path = GetEntryPath(modelName, key);
+        MappedFile file(path);
+        if (!file.IsOpen()) {
+            return false;
+        }
+
+        BinaryReader reader(file.Bytes());
+        FileHeader header{};
+        if (!reader.Read(header) ||
+            std::memcmp(header.magic_, kMagic, sizeof(kMagic)) != 0 ||
+            header.version_ != kFormatVersion ||
+            header.key_ != key ||
+            meshIndex >= header.meshCount_)
+        {
+            return false;
+        }
+
+        MaterialRecord skipped;
+        for (uint32_t i = 0; i < header.materialCount_; ++i) {
+            if (!ReadMaterial(reader, skipped)) return false;
+        }
+        for (uint32_t i = 0; i < meshIndex; ++i) {
+            if (!SkipMesh(reader)) return false;
+        }
+        return ReadMesh(reader, outMesh);
+    }
+
+    // ––– CachedGeometrySource –––
+    bool CachedGeometrySource::Reload(graphics::Mesh& mesh) const {
+        CachedMesh entry;
+        if (!cache_.LoadMesh(modelName_, key_, meshIndex_, entry)) {
+            Logger::GetLogger()->error("MeshCache: Cannot reload mesh {} of '{}'.", meshIndex_, modelName_);
+            return false;
+        }
+        auto& source = *entry.mesh_;
+        // The entry must describe this mesh: every resident LOD range has to fit its index chain.
+        for (const auto& lod : mesh.lods_) {
+            if (static_cast<uint64_t>(lod.indexOffset_) + lod.indexCount_ > source.indices_.size()) {
+                Logger::GetLogger()->error("MeshCache: Entry for mesh {} of '{}' does not match the loaded mesh.",
+                    meshIndex_, modelName_);
+                return false;
+            }
+        }
+        mesh.positions_ = std::move(source.positions_);
+        mesh.normals_ = std::move(source.normals_);
+        mesh.tangents_ = std::move(source.tangents_);
+        mesh.uvs_ = std::move(source.uvs_);
+        mesh.vertexFormat_ = source.vertexFormat_;
+        mesh.quantization_ = source.quantization_;
+        mesh.packedVertices_ = std::move(source.packedVertices_);
+        mesh.indices_ = std::move(source.indices_);
+        return true;
+    }
+
+    // ––– HasEntry –––
+    bool MeshCache::HasEntry(const std::string& modelName, uint64_t key) const {
+        std::error_code ec;
+        return std::filesystem::is_regular_file(GetEntryPath(modelName, key), ec);
+    }
+
+    // ––– Save –––
+    bool MeshCache::Save(const std::string& modelName, uint64_t key, const CachedModel& model) const {
+        std::error_code ec;
+        std::filesystem::create_directories(cacheDirectory_, ec);
+        if (ec) {
+            Logger::GetLogger()->error("MeshCache: Cannot create cache directory '{}': {}",
+                cacheDirectory_.string(), ec.message());
+            return false;
+        }
+
+        BinaryWriter writer;
+        FileHeader header{};
+        std::memcpy(header.magic_, kMagic, sizeof(kMagic));
+        header.version_ = kFormatVersion;
+        header.key_ = key;
+        header.materialCount_ = static_cast<uint32_t>(model.materials_.size());
+        header.meshCount_ = static_cast<uint32_t>(model.meshes_.size());
+        writer.Write(header);
+        for (const auto& mat : model.materials_) {
+            WriteMaterial(writer, mat);
+        }
+        for (const auto& mesh : model.meshes_) {
+            WriteMesh(writer, mesh);
+        }
+
+        // Write to a temporary file first so a crash never leaves a half-written entry behind.
+        const auto path = GetEntryPath(modelName, key);
+        auto tmpPath = path;
+        tmpPath += ".tmp";
+        {
+            std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+            if (!out) {
+                Logger::GetLogger()->error("MeshCache: Cannot write '{}'.", tmpPath.string());
+                return false;
+            }
+            const auto& bytes = writer.Buffer();
+            out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+            if (!out) {
+                Logger::GetLogger()->error("MeshCache: Short write to '{}'.", tmpPath.string());
+                return false;
+            }
+        }
+        std::filesystem::rename(tmpPath, path, ec);
+        if (ec) {
+            Logger::GetLogger()->error("MeshCache: Cannot finalize '{}': {}", path.string(), ec.message());
+            std::filesystem::remove(tmpPath, ec);
+            return false;
+        }
+
+        Logger::GetLogger()->info("MeshCache: Wrote '{}' ({} meshes, {:.1f} MB).",
+            path.string(), model.meshes_.size(), writer.Buffer().size() / (1024.0 * 1024.0));
+        return true;
+    }
+
+} // namespace StaticLoader
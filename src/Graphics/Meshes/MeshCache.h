@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <glm/glm.hpp>
+#include <assimp/material.h>
+
+#include "Graphics/Meshes/Mesh.h"
+#include "Graphics/Meshes/MeshLayout.h"
+#include "Graphics/Meshes/MeshOptimizer.h"
+#include "Graphics/Meshes/MeshClusters.h"
+#include "Graphics/Meshes/LODPolicy.h"
+#include "Graphics/Materials/MaterialParamType.h"
+#include "Graphics/Materials/MaterialLayout.h"
+
+namespace StaticLoader {
+
+    /// One packed material parameter as read from the source asset.
+    struct MaterialParamRecord {
+        MaterialParamType type_ = MaterialParamType::Diffuse;
+        glm::vec3 value_ = glm::vec3(0.0f); ///< Scalar params only use x.
+    };
+
+    /// A texture reference (name used by TextureManager + resolved path on disk).
+    struct TextureRecord {
+        TextureType type_ = TextureType::Diffuse;
+        std::string name_;
+        std::string path_;
+    };
+
+    /**
+     * @brief Importer-agnostic description of a material.
+     *
+     * Everything needed to re-create a graphics::Material without the source asset.
+     */
+    struct MaterialRecord {
+        std::string name_;
+        std::vector<MaterialParamRecord> params_;
+        std::vector<TextureRecord> textures_;
+    };
+
+    /// A fully processed mesh plus the index of its MaterialRecord (and its instances, if any).
+    struct CachedMesh {
+        std::shared_ptr<graphics::Mesh> mesh_;
+        uint32_t materialSlot_ = 0;
+        std::vector<glm::mat4> instances_;
+    };
+
+    /// The complete output of ModelLoader for one (model, settings) combination.
+    struct CachedModel {
+        std::vector<MaterialRecord> materials_;
+        std::vector<CachedMesh> meshes_;
+    };
+
+    /**
+     * @brief Versioned on-disk cache of processed model data.
+     *
+     * Stores the final Mesh data (vertex streams, concatenated LOD index chain,
+     * LOD ranges, clusters, bounds, instance transforms) and material records, keyed by a hash of the source
+     * file contents and every loader setting that affects the result. Entries
+     * are read back with a single memory-mapped read.
+     */
+    class MeshCache {
+    public:
+        /// Bump whenever the file layout or the processing pipeline changes.
+        static constexpr uint32_t kFormatVersion = 10;
+
+        explicit MeshCache(std::filesystem::path cacheDirectory);
+
+        /**
+         * @brief Hashes the source asset (and the material libraries/buffers it references)
+         *        together with the loader settings.
+         *
+         * The cached material records keep only what @p matLayout and @p textureTypes select,
+         * so both are part of the key.
+         * @return std::nullopt if the source file cannot be read.
+         */
+        static std::optional<uint64_t> ComputeKey(const std::filesystem::path& sourceFile,
+            const MeshLayout& meshLayout,
+            const MaterialLayout& matLayout,
+            const std::unordered_map<aiTextureType, TextureType>& textureTypes,
+            float scaleFactor,
+            const LODPolicy& lodPolicy,
+            bool centerModel,
+            bool packedVertices,
+            const MeshOptimizationSettings& optimization,
+            const MeshClusterSettings& clusters,
+            const graphics::BoundsSettings& bounds,
+            bool nativeImporter = false);
+
+        /// @return true if an entry for this key was found and decoded into @p outModel.
+        bool Load(const std::string& modelName, uint64_t key, CachedModel& outModel) const;
+
+        /**
+         * @brief Decodes only mesh @p meshIndex of an entry (the others are skipped, not read).
+         *        Used to restore meshes whose CPU data was released (graphics::MeshResidency).
+         */
+        bool LoadMesh(const std::string& modelName, uint64_t key, uint32_t meshIndex, CachedMesh& outMesh) const;
+
+        /// @return true if an entry file exists for this key (it is not validated).
+        bool HasEntry(const std::string& modelName, uint64_t key) const;
+
+        /// Writes (or replaces) the entry for this key.
+        bool Save(const std::string& modelName, uint64_t key, const CachedModel& model) const;
+
+        const std::filesystem::path& GetDirectory() const { return cacheDirectory_; }
+
+    private:
+        std::filesystem::path GetEntryPath(const std::string& modelName, uint64_t key) const;
+
+        std::filesystem::path cacheDirectory_;
+    };
+
+    /// Restores a released mesh from its MeshCache entry (mesh @p meshIndex of the model).
+    class CachedGeometrySource : public graphics::GeometrySource {
+    public:
+        CachedGeometrySource(std::filesystem::path cacheDirectory, std::string modelName, uint64_t key, uint32_t meshIndex)
+            : cache_(std::move(cacheDirectory)), modelName_(std::move(modelName)), key_(key), meshIndex_(meshIndex) {}
+
+        bool IsAvailable() const override { return cache_.HasEntry(modelName_, key_); }
+        bool Reload(graphics::Mesh& mesh) const override;
+
+    private:
+        MeshCache cache_;
+        std::string modelName_;
+        uint64_t key_ = 0;
+        uint32_t meshIndex_ = 0;
+    };
+
+} // namespace StaticLoader
@@ -0,0 +1,64 @@
+#include "MeshClusters.h"
+
+#include <algorithm>
+#include <meshoptimizer.h>
+
+namespace StaticLoader {
+
+    // ––– BuildClusters –––
+    void BuildClusters(graphics::Mesh& mesh,
+        const std::vector<float>& positions3f,
+        const MeshClusterSettings& settings)
+    {
+        const std::size_t vertexCount = positions3f.size() / 3;
+        if (vertexCount == 0) {
+            return;
+        }
+        const std::size_t maxVertices = std::clamp<std::size_t>(settings.maxVertices_, 3, 255);
+        const std::size_t maxTriangles = std::clamp<std::size_t>(settings.maxTriangles_ & ~3u, 4, 512);
+
+        for (auto& lod : mesh.lods_) {
+            if (lod.clusterCount_ != 0 || lod.indexCount_ < 3) {
+                continue;
+            }
+            const uint32_t* lodIndices = mesh.indices_.data() + lod.indexOffset_;
+
+            const std::size_t maxMeshlets = meshopt_buildMeshletsBound(lod.indexCount_, maxVertices, maxTriangles);
+            std::vector<meshopt_Meshlet> meshlets(maxMeshlets);
+            std::vector<unsigned int> meshletVertices(maxMeshlets * maxVertices);
+            std::vector<unsigned char> meshletTriangles(maxMeshlets * maxTriangles * 3);
+            const std::size_t meshletCount = meshopt_buildMeshlets(meshlets.data(), meshletVertices.data(),
+                meshletTriangles.data(), lodIndices, lod.indexCount_, positions3f.data(), vertexCount,
+                sizeof(float) * 3, maxVertices, maxTriangles, settings.coneWeight_);
+
+            // Rewrite the LOD range cluster by cluster (the triangle count is unchanged).
+            std::vector<uint32_t> reordered;
+            reordered.reserve(lod.indexCount_);
+            lod.firstCluster_ = static_cast<uint32_t>(mesh.clusters_.size());
+            lod.clusterCount_ = static_cast<uint32_t>(meshletCount);
+            for (std::size_t m = 0; m < meshletCount; ++m) {
+                const meshopt_Meshlet& meshlet = meshlets[m];
+                const unsigned int* vertices = meshletVertices.data() + meshlet.vertex_offset;
+                const unsigned char* triangles = meshletTriangles.data() + meshlet.triangle_offset;
+
+                graphics::MeshCluster cluster;
+                cluster.indexOffset_ = lod.indexOffset_ + static_cast<uint32_t>(reordered.size());
+                cluster.indexCount_ = meshlet.triangle_count * 3;
+                for (std::size_t t = 0; t < meshlet.triangle_count * 3; ++t) {
+                    reordered.push_back(vertices[triangles[t]]);
+                }
+
+                const meshopt_Bounds bounds = meshopt_computeMeshletBounds(vertices, triangles,
+                    meshlet.triangle_count, positions3f.data(), vertexCount, sizeof(float) * 3);
+                cluster.center_ = glm::vec3(bounds.center[0], bounds.center[1], bounds.center[2]);
+                cluster.radius_ = bounds.radius;
+                cluster.coneApex_ = glm::vec3(bounds.cone_apex[0], bounds.cone_apex[1], bounds.cone_apex[2]);
+                cluster.coneAxis_ = glm::vec3(bounds.cone_axis[0], bounds.cone_axis[1], bounds.cone_axis[2]);
+                cluster.coneCutoff_ = bounds.cone_cutoff;
+                mesh.clusters_.push_back(cluster);
+            }
+            std::copy(reordered.begin(), reordered.end(), mesh.indices_.begin() + lod.indexOffset_);
+        }
+    }
+
+} // namespace StaticLoader
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Graphics/Meshes/Mesh.h"
+
+namespace StaticLoader {
+
+    /// Meshlet building parameters (see meshopt_buildMeshlets).
+    struct MeshClusterSettings {
+        bool enabled_ = false;
+        uint32_t maxVertices_ = 64;     ///< <= 255
+        uint32_t maxTriangles_ = 124;   ///< <= 512, multiple of 4
+        float coneWeight_ = 0.25f;      ///< Trades spatial compactness for tighter normal cones.
+    };
+
+    /**
+     * @brief Splits every LOD of @p mesh that has no clusters yet into meshlets.
+     *
+     * Each LOD's index range is rewritten so that the triangles of one cluster are
+     * contiguous (same triangle set, new order); bounds and normal cones are stored
+     * in mesh.clusters_ and referenced from the MeshLOD.
+     *
+     * @param positions3f Flattened positions of @p mesh.
+     */
+    void BuildClusters(graphics::Mesh& mesh,
+        const std::vector<float>& positions3f,
+        const MeshClusterSettings& settings);
+
+} // namespace StaticLoader
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <vector>
+#include <glm/glm.hpp>
 #include "Mesh.h"
 
 namespace graphics {
@@ -9,10 +11,14 @@ namespace graphics {
      * @brief Holds a reference to a Mesh plus an associated material index.
      *
      * When rendering, the material identified by materialIndex_ should be bound.
+     * Meshes loaded with an instanced MeshLayout stay in mesh space and list one
+     * world transform per scene node referencing them; otherwise instanceTransforms_
+     * is empty and the node transform is baked into the vertices.
      */
     struct MeshInfo {
         std::shared_ptr<Mesh> mesh_;
         int materialIndex_ = -1;
+        std::vector<glm::mat4> instanceTransforms_;
     };
 
 } // namespace graphics
\ No newline at end of file
@@ -1,38 +1,72 @@
 #pragma once
 
+#include <array>
 #include <bitset>
 #include <cstddef>
+#include <cstdint>
 #include "Graphics/Materials/MaterialParamType.h"  // Must define TextureType and TextureType::COUNT
 
+/// Maximum number of distinct UV channels a mesh/vertex layout can carry.
+constexpr std::size_t kMaxUVChannels = 4;
+
 /**
  * @brief Describes which vertex attributes to load for a mesh.
+ *
+ * Texture types are sampled through UV channels: uvChannels_ maps every texture type to a
+ * channel index (all map to channel 0 by default), and meshes/vertex layouts carry each
+ * distinct channel used by the enabled texture types exactly once.
  */
 struct MeshLayout {
     bool hasPositions_ = true;
     bool hasNormals_ = false;
     bool hasTangents_ = false;
     bool hasBitangents_ = false;
+    bool quantized_ = false;  // 16-bit positions/UVs, octahedral normals/tangents (see graphics::VertexFormat)
+    bool instanced_ = false;  // Mesh-space vertices placed by a per-instance transform SSBO (see renderer::InstanceData)
     std::bitset<kTextureTypeCount> textureTypes_;  // Does not accept an initializer list directly
+    std::array<uint8_t, kTextureTypeCount> uvChannels_{};  // Texture type -> UV channel (< kMaxUVChannels)
 
     // Default constructor
     MeshLayout() = default;
 
     // Custom constructor that accepts an initializer list for texture types.
-    MeshLayout(bool positions, bool normals, bool tangents, bool bitangents, std::initializer_list<TextureType> texTypes)
+    MeshLayout(bool positions, bool normals, bool tangents, bool bitangents, std::initializer_list<TextureType> texTypes,
+        bool quantized = false, bool instanced = false)
         : hasPositions_(positions)
         , hasNormals_(normals)
         , hasTangents_(tangents)
+        , quantized_(quantized)
+        , instanced_(instanced)
     {
         for (auto tex : texTypes) {
             textureTypes_.set(static_cast<std::size_t>(tex), true);
         }
     }
 
+    uint8_t GetUVChannel(TextureType type) const { return uvChannels_[static_cast<std::size_t>(type)]; }
+    void SetUVChannel(TextureType type, uint8_t channel) {
+        uvChannels_[static_cast<std::size_t>(type)] = static_cast<uint8_t>(channel < kMaxUVChannels ? channel : 0);
+    }
+
+    /// @return the distinct UV channels referenced by the enabled texture types.
+    std::bitset<kMaxUVChannels> GetUVChannels() const {
+        std::bitset<kMaxUVChannels> channels;
+        for (std::size_t i = 0; i < textureTypes_.size(); ++i) {
+            if (textureTypes_.test(i)) {
+                channels.set(uvChannels_[i]);
+            }
+        }
+        return channels;
+    }
+
     bool operator==(const MeshLayout& other) const {
         return hasPositions_ == other.hasPositions_ &&
             hasNormals_ == other.hasNormals_ &&
             hasTangents_ == other.hasTangents_ &&
-            textureTypes_ == other.textureTypes_;
+            quantized_ == other.quantized_ &&
+            instanced_ == other.instanced_ &&
+            textureTypes_ == other.textureTypes_ &&
+            uvChannels_ == other.uvChannels_;
     }
 };
 
@@ -48,7 +82,12 @@ namespace std {
             hash_combine(std::hash<bool>{}(layout.hasNormals_));
             hash_combine(std::hash<bool>{}(layout.hasTangents_));
             hash_combine(std::hash<bool>{}(layout.hasBitangents_));
+            hash_combine(std::hash<bool>{}(layout.quantized_));
+            hash_combine(std::hash<bool>{}(layout.instanced_));
             hash_combine(std::hash<std::string>{}(layout.textureTypes_.to_string()));
+            for (uint8_t channel : layout.uvChannels_) {
+                hash_combine(std::hash<uint8_t>{}(channel));
+            }
             return seed;
         }
     };
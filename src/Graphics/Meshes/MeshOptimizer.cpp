@@ -0,0 +1,156 @@
+#include "MeshOptimizer.h"
+
+#include <chrono>
+#include <meshoptimizer.h>
+
+namespace StaticLoader {
+
+    namespace {
+        constexpr unsigned kCacheSize = 16;
+
+        struct Metrics {
+            float acmr_ = 0.0f;
+            float atvr_ = 0.0f;
+            float overdraw_ = 0.0f;
+            float overfetch_ = 0.0f;
+        };
+
+        Metrics Analyze(const std::vector<uint32_t>& indices, const std::vector<float>& positions3f,
+            std::size_t vertexCount, std::size_t vertexSize)
+        {
+            Metrics m;
+            const auto cache = meshopt_analyzeVertexCache(indices.data(), indices.size(), vertexCount, kCacheSize, 0, 0);
+            m.acmr_ = cache.acmr;
+            m.atvr_ = cache.atvr;
+            m.overdraw_ = meshopt_analyzeOverdraw(indices.data(), indices.size(),
+                positions3f.data(), vertexCount, sizeof(float) * 3).overdraw;
+            m.overfetch_ = meshopt_analyzeVertexFetch(indices.data(), indices.size(), vertexCount, vertexSize).overfetch;
+            return m;
+        }
+
+        template <typename T>
+        void RemapStream(std::vector<T>& stream, const std::vector<unsigned int>& remap, std::size_t newCount) {
+            if (stream.size() != remap.size()) {
+                return; // Missing (or partial) streams are left alone; accessors read them as zero.
+            }
+            std::vector<T> remapped(newCount);
+            meshopt_remapVertexBuffer(remapped.data(), stream.data(), stream.size(), sizeof(T), remap.data());
+            stream = std::move(remapped);
+        }
+
+        // Applies a vertex remap to every representation of the mesh's vertices.
+        void RemapVertices(graphics::Mesh& mesh, const std::vector<unsigned int>& remap, std::size_t newCount) {
+            if (mesh.IsPacked()) {
+                const std::size_t stride = mesh.vertexFormat_.stride_;
+                std::vector<std::byte> remapped(newCount * stride);
+                meshopt_remapVertexBuffer(remapped.data(), mesh.packedVertices_.data(), remap.size(), stride, remap.data());
+                mesh.packedVertices_ = std::move(remapped);
+                return;
+            }
+            RemapStream(mesh.positions_, remap, newCount);
+            RemapStream(mesh.normals_, remap, newCount);
+            RemapStream(mesh.tangents_, remap, newCount);
+            for (auto& uvSet : mesh.uvs_) {
+                RemapStream(uvSet, remap, newCount);
+            }
+        }
+
+        std::size_t VertexSize(const graphics::Mesh& mesh) {
+            if (mesh.IsPacked()) {
+                return mesh.vertexFormat_.stride_;
+            }
+            std::size_t size = sizeof(glm::vec3);
+            if (!mesh.normals_.empty())  size += sizeof(glm::vec3);
+            if (!mesh.tangents_.empty()) size += sizeof(glm::vec3);
+            for (const auto& uvSet : mesh.uvs_) {
+                if (!uvSet.empty()) size += sizeof(glm::vec2);
+            }
+            return size;
+        }
+    }
+
+    // ––– OptimizeMesh –––
+    MeshOptimizationStats OptimizeMesh(graphics::Mesh& mesh,
+        std::vector<uint32_t>& indices,
+        std::vector<float>& positions3f,
+        const MeshOptimizationSettings& settings)
+    {
+        MeshOptimizationStats stats;
+        const std::size_t vertexCount = mesh.GetVertexCount();
+        stats.vertexCount_ = static_cast<uint32_t>(vertexCount);
+        stats.triangleCount_ = static_cast<uint32_t>(indices.size() / 3);
+        if (indices.empty() || vertexCount == 0 || positions3f.size() != vertexCount * 3) {
+            return stats;
+        }
+
+        const std::size_t vertexSize = VertexSize(mesh);
+        if (settings.collectStats_) {
+            const Metrics before = Analyze(indices, positions3f, vertexCount, vertexSize);
+            stats.acmrBefore_ = before.acmr_;
+            stats.atvrBefore_ = before.atvr_;
+            stats.overdrawBefore_ = before.overdraw_;
+            stats.overfetchBefore_ = before.overfetch_;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        if (settings.vertexCache_) {
+            meshopt_optimizeVertexCache(indices.data(), indices.data(), indices.size(), vertexCount);
+        }
+        if (settings.overdraw_) {
+            meshopt_optimizeOverdraw(indices.data(), indices.data(), indices.size(),
+                positions3f.data(), vertexCount, sizeof(float) * 3, settings.overdrawThreshold_);
+        }
+        std::size_t finalVertexCount = vertexCount;
+        if (settings.vertexFetch_) {
+            std::vector<unsigned int> remap(vertexCount);
+            finalVertexCount = meshopt_optimizeVertexFetchRemap(remap.data(), indices.data(), indices.size(), vertexCount);
+            meshopt_remapIndexBuffer(indices.data(), indices.data(), indices.size(), remap.data());
+            RemapVertices(mesh, remap, finalVertexCount);
+
+            std::vector<float> remappedPositions(finalVertexCount * 3);
+            meshopt_remapVertexBuffer(remappedPositions.data(), positions3f.data(), vertexCount,
+                sizeof(float) * 3, remap.data());
+            positions3f = std::move(remappedPositions);
+        }
+        stats.milliseconds_ = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        if (settings.collectStats_) {
+            const Metrics after = Analyze(indices, positions3f, finalVertexCount, vertexSize);
+            stats.acmrAfter_ = after.acmr_;
+            stats.atvrAfter_ = after.atvr_;
+            stats.overdrawAfter_ = after.overdraw_;
+            stats.overfetchAfter_ = after.overfetch_;
+        }
+        stats.vertexCount_ = static_cast<uint32_t>(finalVertexCount);
+        return stats;
+    }
+
+    // ––– SummarizeStats –––
+    MeshOptimizationStats SummarizeStats(const std::vector<MeshOptimizationStats>& stats)
+    {
+        MeshOptimizationStats total;
+        double weight = 0.0;
+        double sums[8] = {};
+        for (const auto& s : stats) {
+            total.vertexCount_ += s.vertexCount_;
+            total.triangleCount_ += s.triangleCount_;
+            total.milliseconds_ += s.milliseconds_;
+            const double w = s.triangleCount_;
+            const float values[8] = { s.acmrBefore_, s.acmrAfter_, s.atvrBefore_, s.atvrAfter_,
+                s.overdrawBefore_, s.overdrawAfter_, s.overfetchBefore_, s.overfetchAfter_ };
+            for (int i = 0; i < 8; ++i) {
+                sums[i] += w * values[i];
+            }
+            weight += w;
+        }
+        if (weight > 0.0) {
+            float* outputs[8] = { &total.acmrBefore_, &total.acmrAfter_, &total.atvrBefore_, &total.atvrAfter_,
+                &total.overdrawBefore_, &total.overdrawAfter_, &total.overfetchBefore_, &total.overfetchAfter_ };
+            for (int i = 0; i < 8; ++i) {
+                *outputs[i] = static_cast<float>(sums[i] / weight);
+            }
+        }
+        return total;
+    }
+
+} // namespace StaticLoader
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Graphics/Meshes/Mesh.h"
+
+namespace StaticLoader {
+
+    /// Which meshoptimizer passes run on LOD0 of every imported mesh (in this order).
+    struct MeshOptimizationSettings {
+        bool vertexCache_ = true;           ///< meshopt_optimizeVertexCache
+        bool overdraw_ = true;              ///< meshopt_optimizeOverdraw (after the vertex cache pass)
+        float overdrawThreshold_ = 1.05f;   ///< Max ACMR degradation accepted by the overdraw pass.
+        bool vertexFetch_ = true;           ///< meshopt_optimizeVertexFetchRemap, applied to every attribute stream
+        bool collectStats_ = true;          ///< Analyze before/after (the overdraw analysis rasterizes the mesh).
+
+        bool AnyPass() const { return vertexCache_ || overdraw_ || vertexFetch_; }
+    };
+
+    /**
+     * @brief Before/after GPU efficiency metrics for one mesh (cache size 16).
+     *
+     * ACMR = transformed vertices per triangle, ATVR = transformed vertices per vertex,
+     * overdraw = shaded pixels per covered pixel, overfetch = fetched bytes per vertex byte.
+     */
+    struct MeshOptimizationStats {
+        uint32_t vertexCount_ = 0;
+        uint32_t triangleCount_ = 0;
+        float acmrBefore_ = 0.0f, acmrAfter_ = 0.0f;
+        float atvrBefore_ = 0.0f, atvrAfter_ = 0.0f;
+        float overdrawBefore_ = 0.0f, overdrawAfter_ = 0.0f;
+        float overfetchBefore_ = 0.0f, overfetchAfter_ = 0.0f;
+        double milliseconds_ = 0.0;         ///< Time spent in the optimization passes.
+    };
+
+    /**
+     * @brief Reorders @p indices (LOD0) and, with vertexFetch_, the mesh vertices.
+     *
+     * @param positions3f Flattened positions of @p mesh; remapped together with the mesh
+     *                    so callers can keep using it (e.g. for LOD generation).
+     */
+    MeshOptimizationStats OptimizeMesh(graphics::Mesh& mesh,
+        std::vector<uint32_t>& indices,
+        std::vector<float>& positions3f,
+        const MeshOptimizationSettings& settings);
+
+    /// Triangle-weighted average of @p stats (counts and times are summed).
+    MeshOptimizationStats SummarizeStats(const std::vector<MeshOptimizationStats>& stats);
+
+} // namespace StaticLoader
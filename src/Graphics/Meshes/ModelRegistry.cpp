@@ -0,0 +1,134 @@
+#include "ModelRegistry.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+
+#include "Graphics/Meshes/StaticModelLoader.h"
+#include "Utilities/Logger.h"
+
+namespace StaticLoader {
+
+    // ––– ModelRequest –––
+    bool ModelRequest::operator==(const ModelRequest& other) const {
+        // MeshLayout::operator== ignores bitangents, which do change the loaded vertices.
+        return modelName_ == other.modelName_ &&
+            meshLayout_ == other.meshLayout_ &&
+            meshLayout_.hasBitangents_ == other.meshLayout_.hasBitangents_ &&
+            matLayout_ == other.matLayout_ &&
+            scaleFactor_ == other.scaleFactor_ &&
+            centerModel_ == other.centerModel_ &&
+            deferredLODs_ == other.deferredLODs_ &&
+            packedVertices_ == other.packedVertices_ &&
+            clusterSettings_.enabled_ == other.clusterSettings_.enabled_ &&
+            clusterSettings_.maxVertices_ == other.clusterSettings_.maxVertices_ &&
+            clusterSettings_.maxTriangles_ == other.clusterSettings_.maxTriangles_ &&
+            clusterSettings_.coneWeight_ == other.clusterSettings_.coneWeight_;
+    }
+
+    std::size_t ModelRequestHash::operator()(const ModelRequest& request) const noexcept {
+        std::size_t seed = std::hash<std::string>{}(request.modelName_);
+        auto hash_combine = [&seed](std::size_t value) {
+            seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            };
+        hash_combine(std::hash<MeshLayout>{}(request.meshLayout_));
+        hash_combine(std::hash<MaterialLayout>{}(request.matLayout_));
+        hash_combine(std::hash<float>{}(request.scaleFactor_));
+        hash_combine((request.centerModel_ ? 1u : 0u) |
+            (request.deferredLODs_ ? 2u : 0u) |
+            (request.packedVertices_ ? 4u : 0u) |
+            (request.clusterSettings_.enabled_ ? 8u : 0u) |
+            (request.meshLayout_.hasBitangents_ ? 16u : 0u));
+        return seed;
+    }
+
+    // ––– GetInstance –––
+    ModelRegistry& ModelRegistry::GetInstance() {
+        static ModelRegistry instance;
+        return instance;
+    }
+
+    // ––– Acquire –––
+    std::shared_ptr<const LoadedModel> ModelRegistry::Acquire(const ModelRequest& request) {
+        auto it = entries_.find(request);
+        if (it != entries_.end()) {
+            ++hits_;
+            it->second.lastAcquire_ = ++acquireCounter_;
+            Logger::GetLogger()->info("ModelRegistry: '{}' is resident ({} other reference(s)); reusing it.",
+                request.modelName_, it->second.model_.use_count() - 1);
+            return it->second.model_;
+        }
+
+        ++misses_;
+        const auto start = std::chrono::steady_clock::now();
+        ModelLoader loader(request.scaleFactor_);
+        loader.SetDeferredLODs(request.deferredLODs_);
+        loader.SetPackedVertices(request.packedVertices_);
+        loader.SetClusterSettings(request.clusterSettings_);
+        if (!loader.LoadStaticModel(request.modelName_, request.meshLayout_, request.matLayout_, request.centerModel_)) {
+            return nullptr;
+        }
+
+        auto model = std::make_shared<LoadedModel>();
+        model->objects_ = loader.GetLoadedObjects();
+        model->materialIDs_ = loader.GetMaterialIDs();
+        model->optimizationStats_ = loader.GetOptimizationStats();
+        entries_[request] = Entry{ model, ++acquireCounter_ };
+
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        Logger::GetLogger()->info("ModelRegistry: Registered '{}' ({} meshes) in {:.1f} ms; {} model(s) resident.",
+            request.modelName_, model->objects_.size(), elapsed.count(), entries_.size());
+        TrimUnused();
+        return model;
+    }
+
+    // ––– GetReferenceCount –––
+    std::size_t ModelRegistry::GetReferenceCount(const ModelRequest& request) const {
+        auto it = entries_.find(request);
+        return it != entries_.end() ? static_cast<std::size_t>(it->second.model_.use_count() - 1) : 0;
+    }
+
+    // ––– SetRetainedUnused –––
+    void ModelRegistry::SetRetainedUnused(std::size_t count) {
+        retainedUnused_ = count;
+        TrimUnused();
+    }
+
+    // ––– TrimUnused –––
+    void ModelRegistry::TrimUnused() {
+        std::vector<std::pair<uint64_t, const ModelRequest*>> unused;
+        for (const auto& [request, entry] : entries_) {
+            if (entry.model_.use_count() == 1) {
+                unused.push_back({ entry.lastAcquire_, &request });
+            }
+        }
+        if (unused.size() <= retainedUnused_) {
+            return;
+        }
+        std::sort(unused.begin(), unused.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
+        const std::size_t evict = unused.size() - retainedUnused_;
+        std::vector<ModelRequest> victims;
+        victims.reserve(evict);
+        for (std::size_t i = 0; i < evict; ++i) {
+            victims.push_back(*unused[i].second);
+        }
+        for (const auto& request : victims) {
+            Logger::GetLogger()->info("ModelRegistry: Evicting unused model '{}'.", request.modelName_);
+            entries_.erase(request);
+        }
+    }
+
+    // ––– ReleaseUnused –––
+    std::size_t ModelRegistry::ReleaseUnused() {
+        return std::erase_if(entries_, [](const auto& item) { return item.second.model_.use_count() == 1; });
+    }
+
+    // ––– Clear –––
+    void ModelRegistry::Clear() {
+        entries_.clear();
+        hits_ = 0;
+        misses_ = 0;
+    }
+
+} // namespace StaticLoader
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Graphics/Meshes/MeshInfo.h"
+#include "Graphics/Meshes/MeshLayout.h"
+#include "Graphics/Meshes/MeshOptimizer.h"
+#include "Graphics/Meshes/MeshClusters.h"
+#include "Graphics/Materials/MaterialLayout.h"
+
+namespace StaticLoader {
+
+    /// Everything that selects one loaded result: the model and the loader settings shaping it.
+    struct ModelRequest {
+        std::string modelName_;
+        MeshLayout meshLayout_;
+        MaterialLayout matLayout_;
+        float scaleFactor_ = 1.0f;
+        bool centerModel_ = false;
+        bool deferredLODs_ = false;
+        bool packedVertices_ = false;
+        MeshClusterSettings clusterSettings_;
+
+        bool operator==(const ModelRequest& other) const;
+    };
+
+    struct ModelRequestHash {
+        std::size_t operator()(const ModelRequest& request) const noexcept;
+    };
+
+    /**
+     * @brief The output of one ModelLoader::LoadStaticModel call, shared read-only by every scene
+     *        that references the model. Meshes only change through LODStreamer publishing
+     *        deferred LODs, which every sharer wants anyway.
+     */
+    struct LoadedModel {
+        std::vector<graphics::MeshInfo> objects_;
+        std::vector<std::size_t> materialIDs_;
+        std::vector<MeshOptimizationStats> optimizationStats_;  ///< Empty when served from the mesh cache.
+    };
+
+    /**
+     * @brief Process-wide registry of loaded static models. Main thread only (loads upload to GL).
+     *
+     * Scenes hold the returned shared_ptr for as long as they draw the model, so a model used
+     * by several scenes is imported, processed and uploaded once. The reference count is the
+     * shared_ptr's: an entry no scene holds any more stays resident (most recently released
+     * first) until more than GetRetainedUnused() such entries exist, so switching back to a
+     * scene that was just torn down does not reload anything.
+     */
+    class ModelRegistry {
+    public:
+        static ModelRegistry& GetInstance();
+
+        /// @return the shared result for @p request, loading it on a miss; nullptr if loading failed.
+        std::shared_ptr<const LoadedModel> Acquire(const ModelRequest& request);
+
+        /// Number of scenes (or other owners) currently holding the entry, 0 if not resident.
+        std::size_t GetReferenceCount(const ModelRequest& request) const;
+
+        /// How many unreferenced models are kept resident for reuse (4 by default).
+        void SetRetainedUnused(std::size_t count);
+        std::size_t GetRetainedUnused() const { return retainedUnused_; }
+
+        /// Drops every entry no one references. @return the number of entries dropped.
+        std::size_t ReleaseUnused();
+        void Clear();
+
+        std::size_t GetResidentCount() const { return entries_.size(); }
+        uint64_t GetHitCount() const { return hits_; }
+        uint64_t GetMissCount() const { return misses_; }
+
+    private:
+        ModelRegistry() = default;
+        ModelRegistry(const ModelRegistry&) = delete;
+        ModelRegistry& operator=(const ModelRegistry&) = delete;
+
+        struct Entry {
+            std::shared_ptr<const LoadedModel> model_;
+            uint64_t lastAcquire_ = 0;
+        };
+
+        /// Evicts the least recently acquired unreferenced entries beyond retainedUnused_.
+        void TrimUnused();
+
+        std::unordered_map<ModelRequest, Entry, ModelRequestHash> entries_;
+        std::size_t retainedUnused_ = 4;
+        uint64_t acquireCounter_ = 0;
+        uint64_t hits_ = 0;
+        uint64_t misses_ = 0;
+    };
+
+} // namespace StaticLoader
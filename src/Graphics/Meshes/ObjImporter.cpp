@@ -0,0 +1,644 @@
+#include "ObjImporter.h"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "Utilities/Logger.h"
+#include "Utilities/MappedFile.h"
+#include "Utilities/ThreadPool.h"
+
+namespace StaticLoader {
+
+    namespace {
+        constexpr int32_t kNoIndex = -1;
+        constexpr const char* kDefaultMaterialName = "DefaultMaterial";
+
+        /// One face corner as 0-based indices into the file-wide v/vt/vn arrays.
+        struct Corner {
+            int32_t v_ = kNoIndex;
+            int32_t vt_ = kNoIndex;
+            int32_t vn_ = kNoIndex;
+
+            bool operator==(const Corner& other) const = default;
+        };
+
+        /// Consecutive faces of one chunk sharing a (group, material) state.
+        struct Run {
+            std::string group_;
+            std::string material_;
+            std::vector<Corner> corners_;   ///< Three per triangle.
+        };
+
+        /// Output of the counting pass for one chunk.
+        struct ChunkScan {
+            uint64_t counts_[3] = {};       ///< v, vt, vn records.
+            std::optional<std::string> lastGroup_;
+            std::optional<std::string> lastMaterial_;
+            std::vector<std::string> materialLibraries_;
+        };
+
+        /// Where a chunk starts: global record offsets and the o/g/usemtl state in effect.
+        struct ChunkState {
+            uint64_t bases_[3] = {};
+            std::string group_;
+            std::string material_;
+        };
+
+        struct ChunkParse {
+            std::vector<Run> runs_;
+            uint64_t invalidFaces_ = 0;
+        };
+
+        /// File-wide attribute arrays, written in place by the parse pass.
+        struct AttributeArrays {
+            std::vector<glm::vec3> positions_;
+            std::vector<glm::vec2> uvs_;
+            std::vector<glm::vec3> normals_;
+        };
+
+        double MillisecondsSince(std::chrono::steady_clock::time_point start) {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        void ForEachIndex(std::size_t count, bool parallel, const std::function<void(std::size_t)>& body) {
+            if (parallel && count > 1) {
+                ThreadPool::GetInstance().ParallelFor(count, body);
+                return;
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                body(i);
+            }
+        }
+
+        bool IsBlank(char c) {
+            return c == ' ' || c == '\t';
+        }
+
+        std::string_view Trim(std::string_view text) {
+            while (!text.empty() && IsBlank(text.front())) {
+                text.remove_prefix(1);
+            }
+            while (!text.empty() && (IsBlank(text.back()) || text.back() == '\r')) {
+                text.remove_suffix(1);
+            }
+            return text;
+        }
+
+        /// Splits off the first blank-separated token; @p text is advanced past it.
+        std::string_view NextToken(std::string_view& text) {
+            std::size_t start = 0;
+            while (start < text.size() && IsBlank(text[start])) {
+                ++start;
+            }
+            std::size_t end = start;
+            while (end < text.size() && !IsBlank(text[end])) {
+                ++end;
+            }
+            const std::string_view token = text.substr(start, end - start);
+            text.remove_prefix(end);
+            return token;
+        }
+
+        /// Calls onLine(keyword, rest) for every non-empty, non-comment line in [begin, end).
+        template <typename F>
+        void ForEachLine(const char* begin, const char* end, F&& onLine) {
+            while (begin < end) {
+                const char* newline = static_cast<const char*>(std::memchr(begin, '\n', static_cast<std::size_t>(end - begin)));
+                const char* lineEnd = newline ? newline : end;
+                std::string_view rest = Trim(std::string_view(begin, static_cast<std::size_t>(lineEnd - begin)));
+                if (!rest.empty() && rest.front() != '#') {
+                    const std::string_view keyword = NextToken(rest);
+                    onLine(keyword, Trim(rest));
+                }
+                begin = lineEnd + 1;
+            }
+        }
+
+        bool ParseFloatToken(std::string_view token, float& value) {
+            if (!token.empty() && token.front() == '+') {
+                token.remove_prefix(1);     // from_chars does not accept a leading '+'.
+            }
+            const auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+            return ec == std::errc() && ptr == token.data() + token.size();
+        }
+
+        float ParseFloat(std::string_view& text, float fallback = 0.0f) {
+            float value = fallback;
+            return ParseFloatToken(NextToken(text), value) ? value : fallback;
+        }
+
+        bool EqualsNoCase(std::string_view a, std::string_view b) {
+            return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+                return std::tolower(static_cast<unsigned char>(x)) == std::tolower(static_cast<unsigned char>(y));
+                });
+        }
+
+        /**
+         * @brief Parses "v", "v/vt", "v//vn" or "v/vt/vn". Positive indices are 1-based,
+         *        negative ones relative to @p counts (records seen so far).
+         * @return false for a missing position or any index outside [0, totals).
+         */
+        bool ParseCorner(std::string_view token, const uint64_t (&counts)[3], const uint64_t (&totals)[3], Corner& out) {
+            int32_t* fields[3] = { &out.v_, &out.vt_, &out.vn_ };
+            for (int f = 0; f < 3; ++f) {
+                const std::size_t slash = token.find('/');
+                const std::string_view part = token.substr(0, slash);
+                if (!part.empty()) {
+                    int64_t value = 0;
+                    const auto [ptr, ec] = std::from_chars(part.data(), part.data() + part.size(), value);
+                    if (ec != std::errc() || value == 0) {
+                        return false;
+                    }
+                    const int64_t index = value > 0 ? value - 1 : static_cast<int64_t>(counts[f]) + value;
+                    if (index < 0 || index >= static_cast<int64_t>(totals[f])) {
+                        return false;
+                    }
+                    *fields[f] = static_cast<int32_t>(index);
+                }
+                if (slash == std::string_view::npos) {
+                    break;
+                }
+                token.remove_prefix(slash + 1);
+            }
+            return out.v_ != kNoIndex;
+        }
+
+        // ––– Pass 1: counts and trailing state –––
+        ChunkScan ScanChunk(const char* begin, const char* end) {
+            ChunkScan scan;
+            ForEachLine(begin, end, [&](std::string_view keyword, std::string_view rest) {
+                if (keyword == "v") {
+                    ++scan.counts_[0];
+                }
+                else if (keyword == "vt") {
+                    ++scan.counts_[1];
+                }
+                else if (keyword == "vn") {
+                    ++scan.counts_[2];
+                }
+                else if (keyword == "o" || keyword == "g") {
+                    scan.lastGroup_ = std::string(rest);
+                }
+                else if (keyword == "usemtl") {
+                    scan.lastMaterial_ = std::string(rest);
+                }
+                else if (keyword == "mtllib") {
+                    scan.materialLibraries_.emplace_back(rest);
+                }
+                });
+            return scan;
+        }
+
+        // ––– Pass 2: attributes and faces –––
+        ChunkParse ParseChunk(const char* begin, const char* end, const ChunkState& state,
+            const uint64_t (&totals)[3], AttributeArrays& arrays)
+        {
+            ChunkParse out;
+            uint64_t counts[3] = { state.bases_[0], state.bases_[1], state.bases_[2] };
+            std::string group = state.group_;
+            std::string material = state.material_;
+            Run* run = nullptr;
+            std::vector<Corner> polygon;
+
+            ForEachLine(begin, end, [&](std::string_view keyword, std::string_view rest) {
+                if (keyword == "v") {
+                    glm::vec3& p = arrays.positions_[counts[0]++];
+                    p.x = ParseFloat(rest);
+                    p.y = ParseFloat(rest);
+                    p.z = ParseFloat(rest);
+                }
+                else if (keyword == "vt") {
+                    glm::vec2& uv = arrays.uvs_[counts[1]++];
+                    uv.x = ParseFloat(rest);
+                    uv.y = ParseFloat(rest);
+                }
+                else if (keyword == "vn") {
+                    glm::vec3& n = arrays.normals_[counts[2]++];
+                    n.x = ParseFloat(rest);
+                    n.y = ParseFloat(rest);
+                    n.z = ParseFloat(rest);
+                }
+                else if (keyword == "f") {
+                    polygon.clear();
+                    bool valid = true;
+                    for (std::string_view token = NextToken(rest); !token.empty(); token = NextToken(rest)) {
+                        Corner corner;
+                        valid = ParseCorner(token, counts, totals, corner) && valid;
+                        polygon.push_back(corner);
+                    }
+                    if (!valid || polygon.size() < 3) {
+                        ++out.invalidFaces_;
+                        return;
+                    }
+                    if (!run) {
+                        out.runs_.push_back({ group, material, {} });
+                        run = &out.runs_.back();
+                    }
+                    for (std::size_t i = 1; i + 1 < polygon.size(); ++i) {
+                        run->corners_.push_back(polygon[0]);
+                        run->corners_.push_back(polygon[i]);
+                        run->corners_.push_back(polygon[i + 1]);
+                    }
+                }
+                else if (keyword == "o" || keyword == "g") {
+                    if (rest != group) {
+                        group = std::string(rest);
+                        run = nullptr;
+                    }
+                }
+                else if (keyword == "usemtl") {
+                    if (rest != material) {
+                        material = std::string(rest);
+                        run = nullptr;
+                    }
+                }
+                });
+            return out;
+        }
+
+        // ––– Pass 3: per-mesh vertex dedupe –––
+        uint32_t HashCorner(const Corner& c) {
+            uint32_t h = static_cast<uint32_t>(c.v_) * 0x9E3779B1u;
+            h ^= static_cast<uint32_t>(c.vt_) * 0x85EBCA77u + (h << 6) + (h >> 2);
+            h ^= static_cast<uint32_t>(c.vn_) * 0xC2B2AE3Du + (h << 6) + (h >> 2);
+            return h;
+        }
+
+        /// Area-weighted normals accumulated per OBJ position, for vertices without 'vn'.
+        void GenerateSmoothNormals(const std::vector<Corner>& unique, ObjMesh& mesh) {
+            std::unordered_map<int32_t, glm::vec3> accumulated;
+            accumulated.reserve(unique.size());
+            for (std::size_t i = 0; i + 2 < mesh.indices_.size(); i += 3) {
+                const uint32_t a = mesh.indices_[i], b = mesh.indices_[i + 1], c = mesh.indices_[i + 2];
+                const glm::vec3 faceNormal = glm::cross(mesh.positions_[b] - mesh.positions_[a],
+                    mesh.positions_[c] - mesh.positions_[a]);
+                accumulated[unique[a].v_] += faceNormal;
+                accumulated[unique[b].v_] += faceNormal;
+                accumulated[unique[c].v_] += faceNormal;
+            }
+            for (std::size_t v = 0; v < unique.size(); ++v) {
+                if (unique[v].vn_ != kNoIndex) {
+                    continue;
+                }
+                const glm::vec3 sum = accumulated[unique[v].v_];
+                const float length = glm::length(sum);
+                mesh.normals_[v] = length > 0.0f ? sum / length : glm::vec3(0.0f, 1.0f, 0.0f);
+            }
+        }
+
+        void BuildMesh(const std::vector<const std::vector<Corner>*>& parts, const AttributeArrays& arrays,
+            const ObjImportSettings& settings, ObjMesh& mesh)
+        {
+            std::size_t cornerCount = 0;
+            for (const auto* part : parts) {
+                cornerCount += part->size();
+            }
+            std::size_t capacity = 16;
+            while (capacity < cornerCount * 2) {
+                capacity <<= 1;
+            }
+            const std::size_t mask = capacity - 1;
+
+            // Open addressing: slots hold (unique vertex index + 1), 0 = empty.
+            std::vector<uint32_t> table(capacity, 0);
+            std::vector<Corner> unique;
+            unique.reserve(cornerCount / 4 + 16);
+            mesh.indices_.reserve(cornerCount);
+            bool anyUV = false;
+            bool anyNormal = false;
+            bool missingNormal = false;
+            for (const auto* part : parts) {
+                for (const Corner& corner : *part) {
+                    std::size_t slot = HashCorner(corner) & mask;
+                    while (table[slot] != 0 && !(unique[table[slot] - 1] == corner)) {
+                        slot = (slot + 1) & mask;
+                    }
+                    if (table[slot] == 0) {
+                        unique.push_back(corner);
+                        table[slot] = static_cast<uint32_t>(unique.size());
+                        anyUV |= corner.vt_ != kNoIndex;
+                        anyNormal |= corner.vn_ != kNoIndex;
+                        missingNormal |= corner.vn_ == kNoIndex;
+                    }
+                    mesh.indices_.push_back(table[slot] - 1);
+                }
+            }
+            table = {};
+
+            const std::size_t vertexCount = unique.size();
+            mesh.positions_.resize(vertexCount);
+            for (std::size_t v = 0; v < vertexCount; ++v) {
+                mesh.positions_[v] = arrays.positions_[unique[v].v_];
+            }
+            if (anyUV) {
+                mesh.uvs_.resize(vertexCount);
+                for (std::size_t v = 0; v < vertexCount; ++v) {
+                    mesh.uvs_[v] = unique[v].vt_ != kNoIndex ? arrays.uvs_[unique[v].vt_] : glm::vec2(0.0f);
+                }
+            }
+            if (anyNormal || settings.generateNormals_) {
+                mesh.normals_.assign(vertexCount, glm::vec3(0.0f, 1.0f, 0.0f));
+                for (std::size_t v = 0; v < vertexCount; ++v) {
+                    if (unique[v].vn_ != kNoIndex) {
+                        mesh.normals_[v] = arrays.normals_[unique[v].vn_];
+                    }
+                }
+                if (missingNormal && settings.generateNormals_) {
+                    GenerateSmoothNormals(unique, mesh);
+                }
+            }
+            if (settings.generateTangents_ && anyUV) {
+                mesh.tangents_ = ComputeVertexTangents(vertexCount,
+                    AttributeView<glm::vec3>(mesh.positions_.data(), sizeof(glm::vec3)),
+                    AttributeView<glm::vec2>(mesh.uvs_.data(), sizeof(glm::vec2)),
+                    mesh.normals_.empty() ? AttributeView<glm::vec3>() : AttributeView<glm::vec3>(mesh.normals_.data(), sizeof(glm::vec3)),
+                    mesh.indices_);
+            }
+        }
+
+        // ––– MTL –––
+        aiTextureType MtlTextureType(std::string_view keyword) {
+            static const std::pair<const char*, aiTextureType> kMaps[] = {
+                { "map_Kd", aiTextureType_DIFFUSE }, { "map_Ka", aiTextureType_AMBIENT },
+                { "map_Ks", aiTextureType_SPECULAR }, { "map_Ke", aiTextureType_EMISSIVE },
+                { "map_Ns", aiTextureType_SHININESS }, { "map_d", aiTextureType_OPACITY },
+                { "map_bump", aiTextureType_HEIGHT }, { "bump", aiTextureType_HEIGHT },
+                { "map_Kn", aiTextureType_NORMALS }, { "norm", aiTextureType_NORMALS },
+                { "disp", aiTextureType_DISPLACEMENT }, { "refl", aiTextureType_REFLECTION },
+            };
+            for (const auto& [name, type] : kMaps) {
+                if (EqualsNoCase(keyword, name)) {
+                    return type;
+                }
+            }
+            return aiTextureType_NONE;
+        }
+
+        /// Drops leading "-option args..." from a map statement, leaving the file name.
+        std::string_view StripMapOptions(std::string_view rest) {
+            while (!rest.empty() && rest.front() == '-') {
+                NextToken(rest);
+                // Option arguments are numbers, on/off, or a channel letter (-imfchan).
+                for (;;) {
+                    std::string_view probe = rest;
+                    const std::string_view arg = NextToken(probe);
+                    float number = 0.0f;
+                    if (arg.empty() || !(ParseFloatToken(arg, number) || EqualsNoCase(arg, "on") || EqualsNoCase(arg, "off") ||
+                        (arg.size() == 1 && std::strchr("rgbmlz", arg[0]) != nullptr))) {
+                        break;
+                    }
+                    rest = probe;
+                }
+                rest = Trim(rest);
+            }
+            return Trim(rest);
+        }
+
+        glm::vec3 ParseColor(std::string_view rest) {
+            glm::vec3 color;
+            color.x = ParseFloat(rest);
+            color.y = ParseFloat(rest, color.x);
+            color.z = ParseFloat(rest, color.x);
+            return color;
+        }
+
+        /// Material defaults of Assimp's OBJ importer, so both paths agree on missing keys.
+        SourceMaterial MakeObjMaterial(std::string name) {
+            SourceMaterial material;
+            material.name_ = std::move(name);
+            material.ambient_ = glm::vec3(0.0f);
+            material.diffuse_ = glm::vec3(0.6f);
+            material.specular_ = glm::vec3(0.0f);
+            material.shininess_ = 0.0f;
+            return material;
+        }
+
+        /**
+         * @brief Appends the materials of one MTL file. Texture paths are made relative to the
+         *        OBJ directory (@p libraryDirectory is the mtllib path's directory part).
+         */
+        bool ParseMaterialLibrary(const std::filesystem::path& path, const std::filesystem::path& libraryDirectory,
+            std::vector<SourceMaterial>& out)
+        {
+            MappedFile file(path);
+            if (!file.IsOpen()) {
+                return false;
+            }
+            const char* begin = reinterpret_cast<const char*>(file.Data());
+            SourceMaterial* current = nullptr;
+            ForEachLine(begin, begin + file.Size(), [&](std::string_view keyword, std::string_view rest) {
+                if (EqualsNoCase(keyword, "newmtl")) {
+                    out.push_back(MakeObjMaterial(std::string(rest)));
+                    current = &out.back();
+                    return;
+                }
+                if (!current) {
+                    return;
+                }
+                if (EqualsNoCase(keyword, "Ka")) {
+                    current->ambient_ = ParseColor(rest);
+                }
+                else if (EqualsNoCase(keyword, "Kd")) {
+                    current->diffuse_ = ParseColor(rest);
+                }
+                else if (EqualsNoCase(keyword, "Ks")) {
+                    current->specular_ = ParseColor(rest);
+                }
+                else if (EqualsNoCase(keyword, "Ke")) {
+                    current->emissive_ = ParseColor(rest);
+                }
+                else if (EqualsNoCase(keyword, "Ns")) {
+                    current->shininess_ = ParseFloat(rest, current->shininess_);
+                }
+                else if (EqualsNoCase(keyword, "Ni")) {
+                    current->refractionIndex_ = ParseFloat(rest, current->refractionIndex_);
+                }
+                else if (EqualsNoCase(keyword, "d")) {
+                    current->opacity_ = ParseFloat(rest, current->opacity_);
+                }
+                else if (EqualsNoCase(keyword, "Tr")) {
+                    current->opacity_ = 1.0f - ParseFloat(rest, 1.0f - current->opacity_);
+                }
+                else if (const aiTextureType type = MtlTextureType(keyword); type != aiTextureType_NONE) {
+                    const std::string_view file = StripMapOptions(rest);
+                    if (!file.empty()) {
+                        current->textures_.emplace_back(type, (libraryDirectory / std::string(file)).string());
+                    }
+                }
+                });
+            return true;
+        }
+    }
+
+    // ––– ReferencedFiles –––
+    std::vector<std::filesystem::path> ObjImporter::ReferencedFiles(const std::filesystem::path& path,
+        std::span<const std::byte> bytes)
+    {
+        std::vector<std::filesystem::path> files;
+        std::unordered_set<std::string> seen;
+        const char* begin = reinterpret_cast<const char*>(bytes.data());
+        ForEachLine(begin, begin + bytes.size(), [&](std::string_view keyword, std::string_view rest) {
+            if (keyword == "mtllib" && seen.emplace(rest).second) {
+                files.push_back(path.parent_path() / std::filesystem::path(std::string(rest)));
+            }
+            });
+        return files;
+    }
+
+    // ––– Import –––
+    bool ObjImporter::Import(const std::filesystem::path& path, ObjModel& outModel)
+    {
+        stats_ = {};
+        outModel = {};
+
+        MappedFile file(path);
+        if (!file.IsOpen()) {
+            Logger::GetLogger()->error("ObjImporter: Could not map '{}'.", path.string());
+            return false;
+        }
+        const char* data = reinterpret_cast<const char*>(file.Data());
+        const std::size_t size = file.Size();
+        stats_.fileBytes_ = size;
+
+        // 1) Line-aligned chunks, a few per thread for load balancing.
+        const bool parallel = settings_.parallel_;
+        const std::size_t maxChunks = parallel ? (ThreadPool::GetInstance().GetThreadCount() + 1) * 4 : 1;
+        const std::size_t wantedChunks = std::clamp<std::size_t>(size / std::max<std::size_t>(settings_.minChunkBytes_, 1), 1, maxChunks);
+        std::vector<const char*> bounds{ data };
+        for (std::size_t c = 1; c < wantedChunks; ++c) {
+            const char* target = data + size * c / wantedChunks;
+            if (target <= bounds.back()) {
+                continue;
+            }
+            const char* newline = static_cast<const char*>(std::memchr(target, '\n', static_cast<std::size_t>(data + size - target)));
+            if (!newline) {
+                break;
+            }
+            bounds.push_back(newline + 1);
+        }
+        bounds.push_back(data + size);
+        const std::size_t chunkCount = bounds.size() - 1;
+        stats_.chunkCount_ = static_cast<uint32_t>(chunkCount);
+
+        // 2) Count records and find the state each chunk leaves behind.
+        auto start = std::chrono::steady_clock::now();
+        std::vector<ChunkScan> scans(chunkCount);
+        ForEachIndex(chunkCount, parallel, [&](std::size_t i) { scans[i] = ScanChunk(bounds[i], bounds[i + 1]); });
+
+        std::vector<ChunkState> states(chunkCount);
+        ChunkState running;
+        for (std::size_t i = 0; i < chunkCount; ++i) {
+            states[i] = running;
+            for (int k = 0; k < 3; ++k) {
+                running.bases_[k] += scans[i].counts_[k];
+            }
+            if (scans[i].lastGroup_) {
+                running.group_ = *scans[i].lastGroup_;
+            }
+            if (scans[i].lastMaterial_) {
+                running.material_ = *scans[i].lastMaterial_;
+            }
+        }
+        const uint64_t totals[3] = { running.bases_[0], running.bases_[1], running.bases_[2] };
+        stats_.positionCount_ = totals[0];
+        stats_.scanMilliseconds_ = MillisecondsSince(start);
+
+        // 3) Parse every chunk straight into the shared arrays.
+        start = std::chrono::steady_clock::now();
+        AttributeArrays arrays;
+        arrays.positions_.resize(totals[0]);
+        arrays.uvs_.resize(totals[1]);
+        arrays.normals_.resize(totals[2]);
+        std::vector<ChunkParse> parsed(chunkCount);
+        ForEachIndex(chunkCount, parallel, [&](std::size_t i) {
+            parsed[i] = ParseChunk(bounds[i], bounds[i + 1], states[i], totals, arrays);
+            });
+        stats_.parseMilliseconds_ = MillisecondsSince(start);
+
+        // 4) Group runs by (group, material) in order of first appearance.
+        struct Group {
+            std::string name_;
+            uint32_t materialSlot_ = 0;
+            std::vector<const std::vector<Corner>*> parts_;
+        };
+        std::vector<Group> groups;
+        std::unordered_map<std::string, std::size_t> groupIndex;
+        std::vector<std::string> usedMaterials;
+        std::unordered_map<std::string, uint32_t> materialSlot;
+        for (const auto& chunk : parsed) {
+            stats_.invalidFaces_ += chunk.invalidFaces_;
+            for (const auto& run : chunk.runs_) {
+                const std::string& materialName = run.material_.empty() ? std::string(kDefaultMaterialName) : run.material_;
+                auto [slotIt, newMaterial] = materialSlot.try_emplace(materialName, static_cast<uint32_t>(usedMaterials.size()));
+                if (newMaterial) {
+                    usedMaterials.push_back(materialName);
+                }
+                auto [groupIt, newGroup] = groupIndex.try_emplace(run.group_ + '\0' + materialName, groups.size());
+                if (newGroup) {
+                    groups.push_back({ run.group_.empty() ? std::string("defaultobject") : run.group_, slotIt->second, {} });
+                }
+                groups[groupIt->second].parts_.push_back(&run.corners_);
+            }
+        }
+        if (stats_.invalidFaces_ > 0) {
+            Logger::GetLogger()->warn("ObjImporter: Dropped {} face(s) with invalid indices in '{}'.",
+                stats_.invalidFaces_, path.string());
+        }
+
+        // 5) Materials referenced by the faces, from every mtllib (missing ones get defaults).
+        start = std::chrono::steady_clock::now();
+        std::vector<SourceMaterial> library;
+        std::unordered_set<std::string> parsedLibraries;
+        for (const auto& scan : scans) {
+            for (const auto& name : scan.materialLibraries_) {
+                if (!parsedLibraries.insert(name).second) {
+                    continue;
+                }
+                const std::filesystem::path relative(name);
+                if (!ParseMaterialLibrary(path.parent_path() / relative, relative.parent_path(), library)) {
+                    Logger::GetLogger()->warn("ObjImporter: Could not read material library '{}'.", name);
+                }
+            }
+        }
+        outModel.materials_.reserve(usedMaterials.size());
+        for (const auto& name : usedMaterials) {
+            auto it = std::find_if(library.begin(), library.end(), [&](const SourceMaterial& m) { return m.name_ == name; });
+            if (it != library.end()) {
+                outModel.materials_.push_back(*it);
+                continue;
+            }
+            if (name != kDefaultMaterialName) {
+                Logger::GetLogger()->warn("ObjImporter: Material '{}' is not defined; using defaults.", name);
+            }
+            outModel.materials_.push_back(MakeObjMaterial(name));
+        }
+        stats_.materialMilliseconds_ = MillisecondsSince(start);
+
+        // 6) Deduplicate vertices per mesh.
+        start = std::chrono::steady_clock::now();
+        outModel.meshes_.resize(groups.size());
+        ForEachIndex(groups.size(), parallel, [&](std::size_t i) {
+            ObjMesh& mesh = outModel.meshes_[i];
+            mesh.name_ = groups[i].name_;
+            mesh.materialSlot_ = groups[i].materialSlot_;
+            BuildMesh(groups[i].parts_, arrays, settings_, mesh);
+            });
+        stats_.buildMilliseconds_ = MillisecondsSince(start);
+
+        for (const auto& mesh : outModel.meshes_) {
+            stats_.vertexCount_ += mesh.positions_.size();
+            stats_.triangleCount_ += mesh.indices_.size() / 3;
+        }
+        return !outModel.meshes_.empty();
+    }
+
+} // namespace StaticLoader
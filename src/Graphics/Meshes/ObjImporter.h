@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "Graphics/Meshes/SourceMesh.h"
+
+namespace StaticLoader {
+
+    /// One (object/group, material) part of an OBJ file with deduplicated vertices.
+    struct ObjMesh {
+        std::string name_;
+        uint32_t materialSlot_ = 0;         ///< Index into ObjModel::materials_.
+        std::vector<glm::vec3> positions_;
+        std::vector<glm::vec3> normals_;    ///< Empty if the file has none and none were generated.
+        std::vector<glm::vec3> tangents_;   ///< Only with ObjImportSettings::generateTangents_ and UVs.
+        std::vector<glm::vec2> uvs_;        ///< Empty if the file has no texture coordinates.
+        std::vector<uint32_t> indices_;     ///< Triangle list.
+    };
+
+    /// Everything ObjImporter produces; materials are the referenced ones, in order of first use.
+    struct ObjModel {
+        std::vector<SourceMaterial> materials_;
+        std::vector<ObjMesh> meshes_;
+    };
+
+    struct ObjImportSettings {
+        bool parallel_ = true;                      ///< Parse and build on the shared ThreadPool.
+        bool generateNormals_ = true;               ///< Smooth normals for corners without 'vn'.
+        bool generateTangents_ = false;             ///< Per-vertex tangents from positions and UVs.
+        std::size_t minChunkBytes_ = 1u << 20;      ///< Smallest line-aligned chunk handed to one task.
+    };
+
+    struct ObjImportStats {
+        uint32_t chunkCount_ = 0;
+        uint64_t fileBytes_ = 0;
+        uint64_t positionCount_ = 0;        ///< 'v' records in the file.
+        uint64_t vertexCount_ = 0;          ///< Unique vertices over all meshes.
+        uint64_t triangleCount_ = 0;        ///< After fan triangulation.
+        uint64_t invalidFaces_ = 0;         ///< Faces dropped for out-of-range indices.
+        double scanMilliseconds_ = 0.0;     ///< Counting pass (record counts and state per chunk).
+        double parseMilliseconds_ = 0.0;    ///< Number parsing into the shared attribute arrays.
+        double buildMilliseconds_ = 0.0;    ///< Vertex dedupe and normal/tangent generation.
+        double materialMilliseconds_ = 0.0; ///< MTL parsing.
+    };
+
+    /**
+     * @brief Native Wavefront OBJ/MTL importer.
+     *
+     * The file is memory-mapped and split into line-aligned chunks. A first parallel pass
+     * counts v/vt/vn records and the last o/g/usemtl of every chunk; prefix sums then give
+     * each chunk the global record offsets and starting state, so the second pass parses
+     * v/vt/vn/f/usemtl/o/g of all chunks in parallel straight into shared arrays and resolves
+     * relative indices. Faces are grouped by (o/g name, material), fan-triangulated, and
+     * every group deduplicates its (v, vt, vn) corners with an open-addressing hash table.
+     *
+     * Lines, points, smoothing groups, line continuations and free-form geometry are ignored.
+     */
+    class ObjImporter {
+    public:
+        explicit ObjImporter(const ObjImportSettings& settings = {}) : settings_(settings) {}
+
+        /// @return false if the file cannot be read or contains no faces.
+        bool Import(const std::filesystem::path& path, ObjModel& outModel);
+
+        const ObjImportStats& GetStats() const { return stats_; }
+
+        /// Material libraries named by the mtllib lines of @p bytes (the OBJ at @p path), resolved like Import().
+        static std::vector<std::filesystem::path> ReferencedFiles(const std::filesystem::path& path,
+            std::span<const std::byte> bytes);
+
+    private:
+        ObjImportSettings settings_;
+        ObjImportStats stats_;
+    };
+
+} // namespace StaticLoader
@@ -12,8 +12,9 @@ namespace graphics {
             {  1.0f,  1.0f, 0.0f }   // top-right
         };
 
-        // Provide UVs for Albedo.
-        uvs_[TextureType::Diffuse] = {
+        // Provide UV channel 0 (shared by every texture type).
+        uvs_.resize(1);
+        uvs_[0] = {
             { 0.0f, 1.0f },
             { 0.0f, 0.0f },
             { 1.0f, 0.0f },
@@ -60,7 +61,8 @@ namespace graphics {
         }
 
         // Define UVs.
-        uvs_[TextureType::Diffuse] = {
+        uvs_.resize(1);
+        uvs_[0] = {
             { 0.0f, 1.0f },
             { 0.0f, 0.0f },
             { 1.0f, 0.0f },
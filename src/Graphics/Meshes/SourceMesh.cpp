@@ -0,0 +1,66 @@
+#include "SourceMesh.h"
+
+#include <cmath>
+
+namespace StaticLoader {
+
+    // ––– ComputeVertexNormals –––
+    std::vector<glm::vec3> ComputeVertexNormals(std::size_t vertexCount,
+        const AttributeView<glm::vec3>& positions,
+        std::span<const uint32_t> indices)
+    {
+        std::vector<glm::vec3> normals(vertexCount, glm::vec3(0.0f));
+        for (std::size_t i = 0; i + 2 < indices.size(); i += 3) {
+            const uint32_t a = indices[i], b = indices[i + 1], c = indices[i + 2];
+            const glm::vec3 pa = positions[a];
+            const glm::vec3 faceNormal = glm::cross(positions[b] - pa, positions[c] - pa);
+            normals[a] += faceNormal;
+            normals[b] += faceNormal;
+            normals[c] += faceNormal;
+        }
+        for (auto& n : normals) {
+            const float length = glm::length(n);
+            n = length > 0.0f ? n / length : glm::vec3(0.0f, 1.0f, 0.0f);
+        }
+        return normals;
+    }
+
+    // ––– ComputeVertexTangents –––
+    std::vector<glm::vec3> ComputeVertexTangents(std::size_t vertexCount,
+        const AttributeView<glm::vec3>& positions,
+        const AttributeView<glm::vec2>& uvs,
+        const AttributeView<glm::vec3>& normals,
+        std::span<const uint32_t> indices)
+    {
+        std::vector<glm::vec3> tangents(vertexCount, glm::vec3(0.0f));
+        for (std::size_t i = 0; i + 2 < indices.size(); i += 3) {
+            const uint32_t a = indices[i], b = indices[i + 1], c = indices[i + 2];
+            const glm::vec3 e1 = positions[b] - positions[a];
+            const glm::vec3 e2 = positions[c] - positions[a];
+            const glm::vec2 d1 = uvs[b] - uvs[a];
+            const glm::vec2 d2 = uvs[c] - uvs[a];
+            const float det = d1.x * d2.y - d2.x * d1.y;
+            if (std::abs(det) < 1e-12f) {
+                continue;
+            }
+            const glm::vec3 tangent = (e1 * d2.y - e2 * d1.y) / det;
+            tangents[a] += tangent;
+            tangents[b] += tangent;
+            tangents[c] += tangent;
+        }
+        for (std::size_t v = 0; v < vertexCount; ++v) {
+            const glm::vec3 n = normals ? normals[v] : glm::vec3(0.0f);
+            glm::vec3 t = tangents[v] - n * glm::dot(n, tangents[v]);
+            const float length = glm::length(t);
+            if (length > 1e-8f) {
+                tangents[v] = t / length;
+                continue;
+            }
+            const glm::vec3 axis = std::abs(n.x) < 0.9f ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+            const glm::vec3 fallback = glm::cross(n, axis);
+            tangents[v] = glm::length(fallback) > 0.0f ? glm::normalize(fallback) : axis;
+        }
+        return tangents;
+    }
+
+} // namespace StaticLoader
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+#include <glm/glm.hpp>
+#include <assimp/material.h>
+
+#include "Graphics/Meshes/MeshLayout.h"
+
+namespace StaticLoader {
+
+    /// Storage type of one attribute component (values match glTF accessor componentTypes).
+    enum class ComponentType : uint16_t {
+        Int8 = 5120,
+        UInt8 = 5121,
+        Int16 = 5122,
+        UInt16 = 5123,
+        UInt32 = 5125,
+        Float = 5126
+    };
+
+    /**
+     * @brief Strided read-only view of one vertex attribute.
+     *
+     * Lets the processing stage read aiVector3D arrays (UVs included, stride 12), tightly
+     * packed glm arrays and glTF accessors (any stride, integer components, optionally
+     * normalized) in place through the same code.
+     */
+    template <typename T>
+    class AttributeView {
+    public:
+        AttributeView() = default;
+        AttributeView(const void* data, std::size_t stride,
+            ComponentType component = ComponentType::Float, bool normalized = false)
+            : data_(static_cast<const std::byte*>(data)), stride_(stride), component_(component), normalized_(normalized) {}
+
+        explicit operator bool() const { return data_ != nullptr; }
+
+        T operator[](std::size_t i) const {
+            const std::byte* element = data_ + i * stride_;
+            T value;
+            if (component_ == ComponentType::Float) {
+                std::memcpy(&value, element, sizeof(T));
+                return value;
+            }
+            for (int c = 0; c < T::length(); ++c) {
+                value[c] = ReadComponent(element, c);
+            }
+            return value;
+        }
+
+    private:
+        template <typename C>
+        static C Load(const std::byte* element, int c) {
+            C v;
+            std::memcpy(&v, element + c * sizeof(C), sizeof(C));
+            return v;
+        }
+
+        /// Integer components follow the glTF/GL normalization rules when normalized_.
+        float ReadComponent(const std::byte* element, int c) const {
+            switch (component_) {
+            case ComponentType::Int8: {
+                const float v = Load<int8_t>(element, c);
+                return normalized_ ? std::max(v / 127.0f, -1.0f) : v;
+            }
+            case ComponentType::UInt8: {
+                const float v = Load<uint8_t>(element, c);
+                return normalized_ ? v / 255.0f : v;
+            }
+            case ComponentType::Int16: {
+                const float v = Load<int16_t>(element, c);
+                return normalized_ ? std::max(v / 32767.0f, -1.0f) : v;
+            }
+            case ComponentType::UInt16: {
+                const float v = Load<uint16_t>(element, c);
+                return normalized_ ? v / 65535.0f : v;
+            }
+            case ComponentType::UInt32:
+                return static_cast<float>(Load<uint32_t>(element, c));
+            default:
+                return Load<float>(element, c);
+            }
+        }
+
+        const std::byte* data_ = nullptr;
+        std::size_t stride_ = sizeof(T);
+        ComponentType component_ = ComponentType::Float;
+        bool normalized_ = false;
+    };
+
+    /**
+     * @brief Importer-agnostic input of ModelLoader's mesh processing stage.
+     *
+     * Attribute views point into importer-owned memory (an aiMesh, an ObjMesh or mapped glTF buffers) that
+     * must outlive processing; the index list is owned and consumed by the stage.
+     */
+    struct SourceMesh {
+        std::size_t vertexCount_ = 0;
+        AttributeView<glm::vec3> positions_;
+        AttributeView<glm::vec3> normals_;
+        AttributeView<glm::vec3> tangents_;
+        std::array<AttributeView<glm::vec2>, kMaxUVChannels> uvs_;  ///< Per layout UV channel, already resolved to a source set.
+        std::vector<uint32_t> indices_;
+    };
+
+    /// Importer-agnostic material values, before they are filtered by a MaterialLayout.
+    struct SourceMaterial {
+        std::string name_;
+        glm::vec3 ambient_ = glm::vec3(0.2f);
+        glm::vec3 diffuse_ = glm::vec3(0.8f);
+        glm::vec3 specular_ = glm::vec3(0.0f);
+        glm::vec3 emissive_ = glm::vec3(0.0f);
+        float shininess_ = 32.0f;
+        float refractionIndex_ = 1.0f;
+        float opacity_ = 1.0f;
+        std::vector<std::pair<aiTextureType, std::string>> textures_;   ///< Paths as written in the source asset.
+        std::vector<std::pair<TextureType, std::string>> typedTextures_; ///< Slots the importer maps itself (glTF PBR).
+    };
+
+    /// Area-weighted per-vertex normals of a triangle list.
+    std::vector<glm::vec3> ComputeVertexNormals(std::size_t vertexCount,
+        const AttributeView<glm::vec3>& positions,
+        std::span<const uint32_t> indices);
+
+    /**
+     * @brief Per-vertex tangents from UV gradients, orthogonalized against @p normals
+     *        (if any); vertices with degenerate UVs get an arbitrary perpendicular.
+     */
+    std::vector<glm::vec3> ComputeVertexTangents(std::size_t vertexCount,
+        const AttributeView<glm::vec3>& positions,
+        const AttributeView<glm::vec2>& uvs,
+        const AttributeView<glm::vec3>& normals,
+        std::span<const uint32_t> indices);
+
+} // namespace StaticLoader
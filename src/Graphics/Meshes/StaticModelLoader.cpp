@@ -2,8 +2,14 @@
 #include <assimp/Importer.hpp>
 #include <assimp/postprocess.h>
 #include <filesystem>
+#include <algorithm>
+#include <cctype>
 #include <cfloat>          // For FLT_MAX
-#include <meshoptimizer.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <unordered_set>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/matrix_inverse.hpp>
 #include <filesystem>
@@ -11,12 +17,81 @@
 #include <nlohmann/json.hpp>
 
 #include "Graphics/Materials/MaterialManager.h"
+#include "Graphics/Meshes/LODStreamer.h"
+#include "Graphics/Meshes/ObjImporter.h"
 #include "Graphics/Textures/TextureManager.h"
+#include "Graphics/Textures/TextureLoader.h"
+#include "Graphics/Textures/Bitmap.h"
 #include "Graphics/Textures/TextureConfig.h"
 #include "Utilities/Logger.h"
+#include "Utilities/ThreadPool.h"
 
 namespace StaticLoader {
 
+    namespace {
+        // Assimp UV set feeding a layout UV channel; channels missing from the source reuse set 0.
+        unsigned SourceUVSet(const aiMesh* aimesh, uint32_t channel) {
+            return aimesh->HasTextureCoords(channel) ? channel : 0u;
+        }
+
+        SourceMesh MakeSourceMesh(const aiMesh* aimesh) {
+            SourceMesh source;
+            source.vertexCount_ = aimesh->mNumVertices;
+            if (aimesh->HasPositions()) {
+                source.positions_ = AttributeView<glm::vec3>(aimesh->mVertices, sizeof(aiVector3D));
+            }
+            if (aimesh->HasNormals()) {
+                source.normals_ = AttributeView<glm::vec3>(aimesh->mNormals, sizeof(aiVector3D));
+            }
+            if (aimesh->HasTangentsAndBitangents()) {
+                source.tangents_ = AttributeView<glm::vec3>(aimesh->mTangents, sizeof(aiVector3D));
+            }
+            if (aimesh->HasTextureCoords(0)) {
+                for (uint32_t c = 0; c < kMaxUVChannels; ++c) {
+                    source.uvs_[c] = AttributeView<glm::vec2>(aimesh->mTextureCoords[SourceUVSet(aimesh, c)], sizeof(aiVector3D));
+                }
+            }
+            source.indices_.reserve(aimesh->mNumFaces * 3);
+            for (unsigned f = 0; f < aimesh->mNumFaces; f++) {
+                const aiFace& face = aimesh->mFaces[f];
+                for (unsigned idx = 0; idx < face.mNumIndices; idx++) {
+                    source.indices_.push_back(face.mIndices[idx]);
+                }
+            }
+            return source;
+        }
+
+        // OBJ meshes carry a single UV set, shared by every layout channel; the indices are moved out.
+        SourceMesh MakeSourceMesh(ObjMesh& objMesh) {
+            SourceMesh source;
+            source.vertexCount_ = objMesh.positions_.size();
+            source.positions_ = AttributeView<glm::vec3>(objMesh.positions_.data(), sizeof(glm::vec3));
+            if (!objMesh.normals_.empty()) {
+                source.normals_ = AttributeView<glm::vec3>(objMesh.normals_.data(), sizeof(glm::vec3));
+            }
+            if (!objMesh.tangents_.empty()) {
+                source.tangents_ = AttributeView<glm::vec3>(objMesh.tangents_.data(), sizeof(glm::vec3));
+            }
+            if (!objMesh.uvs_.empty()) {
+                source.uvs_.fill(AttributeView<glm::vec2>(objMesh.uvs_.data(), sizeof(glm::vec2)));
+            }
+            source.indices_ = std::move(objMesh.indices_);
+            return source;
+        }
+
+        bool IsObjFile(const std::string& filePath) {
+            std::string ext = std::filesystem::path(filePath).extension().string();
+            std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return ext == ".obj";
+        }
+
+        bool IsGltfFile(const std::string& filePath) {
+            std::string ext = std::filesystem::path(filePath).extension().string();
+            std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return ext == ".gltf" || ext == ".glb";
+        }
+    }
+
     // ––– Constructor –––
     ModelLoader::ModelLoader(float scaleFactor,
         std::unordered_map<aiTextureType, TextureType> aiToMyType,
@@ -24,9 +99,9 @@ namespace StaticLoader {
         const std::filesystem::path& configPath)
         : scaleFactor_(scaleFactor),
         aiToMyType_(std::move(aiToMyType)),
-        maxLODs_(maxLODs),
         configPath_(configPath)
     {
+        lodPolicy_.maxLevels_ = maxLODs;
         if (!LoadModelConfig()) {
             Logger::GetLogger()->error("ModelLoader: Failed to load model config from '{}'.", configPath_.string());
         }
@@ -34,11 +109,24 @@ namespace StaticLoader {
 
     // ––– LoadModelConfig –––
     bool ModelLoader::LoadModelConfig() {
+        // Every loader used to re-read the config; it is now parsed once per path and shared.
+        using ModelPaths = std::unordered_map<std::string, std::string>;
+        static std::mutex parsedMutex;
+        static std::unordered_map<std::string, std::shared_ptr<const ModelPaths>> parsed;
+
+        const std::string key = configPath_.lexically_normal().string();
+        std::lock_guard<std::mutex> lock(parsedMutex);
+        if (auto it = parsed.find(key); it != parsed.end()) {
+            modelPaths_ = it->second;
+            return true;
+        }
+
         std::ifstream file(configPath_);
         if (!file) {
             Logger::GetLogger()->error("ModelLoader: Could not open model config file '{}'.", configPath_.string());
             return false;
         }
+        auto modelPaths = std::make_shared<ModelPaths>();
         try {
             nlohmann::json jsonData;
             file >> jsonData;
@@ -47,21 +135,27 @@ namespace StaticLoader {
                 return false;
             }
             for (auto& [modelName, pathValue] : jsonData["models"].items()) {
-                modelPaths_[modelName] = pathValue.get<std::string>();
+                (*modelPaths)[modelName] = pathValue.get<std::string>();
             }
         }
         catch (const std::exception& e) {
             Logger::GetLogger()->error("ModelLoader: Exception parsing config '{}': {}", configPath_.string(), e.what());
             return false;
         }
+        modelPaths_ = modelPaths;
+        parsed.emplace(key, std::move(modelPaths));
         Logger::GetLogger()->info("ModelLoader: Successfully loaded model config from '{}'.", configPath_.string());
         return true;
     }
 
     // ––– GetModelPath –––
     std::string ModelLoader::GetModelPath(const std::string& modelName) const {
-        auto it = modelPaths_.find(modelName);
-        if (it != modelPaths_.end()) {
+        if (!modelPaths_) {
+            Logger::GetLogger()->error("ModelLoader: No model config loaded; cannot resolve '{}'.", modelName);
+            return "";
+        }
+        auto it = modelPaths_->find(modelName);
+        if (it != modelPaths_->end()) {
             return it->second;
         }
         Logger::GetLogger()->error("ModelLoader: Unknown modelName '{}'. Check your config file.", modelName);
@@ -74,12 +168,91 @@ namespace StaticLoader {
         const MaterialLayout& matLayout,
         bool centerModel)
     {
+        const auto loadStart = std::chrono::steady_clock::now();
+
         // Clear previous data.
         objects_.clear();
         materialIDs_.clear();
+        materialRecords_.clear();
+        objectMaterialSlots_.clear();
+        optimizationStats_.clear();
+        textureLoadStats_ = {};
+        ioStats_ = {};
+        objImportStats_ = {};
         fallbackMaterialCounter_ = 0;
         unnamedMaterialCounter_ = 0;
 
+        // Look up file path.
+        std::string filePath = GetModelPath(modelName);
+        if (filePath.empty()) {
+            Logger::GetLogger()->error("ModelLoader: No path for model '{}'.", modelName);
+            return false;
+        }
+
+        const bool nativeObj = nativeObjImport_ && IsObjFile(filePath);
+        const bool nativeGltf = nativeGltfImport_ && IsGltfFile(filePath);
+
+        // Warm start: the processed result is already on disk. The key depends on the importer
+        // that produced the entry, so it is recomputed when a native import falls back to Assimp.
+        std::optional<uint64_t> cacheKey;
+        auto loadFromCache = [&](bool nativeImporter) {
+            if (!useMeshCache_) {
+                return false;
+            }
+            cacheKey = MeshCache::ComputeKey(filePath, meshLayout, matLayout, aiToMyType_, scaleFactor_, lodPolicy_,
+                centerModel, packedVertices_, optimizationSettings_, clusterSettings_, boundsSettings_, nativeImporter);
+            if (!cacheKey || !LoadFromCache(modelName, *cacheKey, matLayout)) {
+                return false;
+            }
+            const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - loadStart;
+            Logger::GetLogger()->info("ModelLoader: Loaded '{}' from cache => {} meshes, {} materials in {:.1f} ms.",
+                modelName, objects_.size(), materialIDs_.size(), elapsed.count());
+            return true;
+            };
+        if (loadFromCache(nativeObj || nativeGltf)) {
+            return true;
+        }
+
+        // Native OBJ/MTL fast path; Assimp below remains the fallback.
+        // The OBJ meshes must outlive FinishLoad, which reads their vertex streams.
+        // Native imports only read material records: materials are registered once the import
+        // succeeded, so a failed import leaves nothing behind for Assimp to duplicate.
+        ObjModel objModel;
+        if (nativeObj) {
+            std::vector<MeshJob> jobs;
+            if (ImportObj(filePath, meshLayout, matLayout, objModel, jobs)) {
+                CreateMaterials(matLayout);
+                FinishLoad(modelName, jobs, meshLayout, centerModel, cacheKey);
+                const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - loadStart;
+                Logger::GetLogger()->info("ModelLoader: Loaded '{}' (native OBJ) => {} meshes, {} materials in {:.1f} ms.",
+                    modelName, objects_.size(), materialIDs_.size(), elapsed.count());
+                return true;
+            }
+            Logger::GetLogger()->warn("ModelLoader: Native OBJ import of '{}' failed; falling back to Assimp.", filePath);
+            materialRecords_.clear();
+        }
+
+        // Native glTF fast path; the mapped buffers must likewise outlive FinishLoad.
+        GltfModel gltfModel;
+        if (nativeGltf) {
+            std::vector<MeshJob> jobs;
+            if (ImportGltf(filePath, meshLayout, matLayout, gltfModel, jobs)) {
+                CreateMaterials(matLayout);
+                FinishLoad(modelName, jobs, meshLayout, centerModel, cacheKey);
+                const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - loadStart;
+                Logger::GetLogger()->info("ModelLoader: Loaded '{}' (native glTF) => {} meshes, {} materials in {:.1f} ms.",
+                    modelName, objects_.size(), materialIDs_.size(), elapsed.count());
+                return true;
+            }
+            Logger::GetLogger()->warn("ModelLoader: Native glTF import of '{}' failed; falling back to Assimp.", filePath);
+            materialRecords_.clear();
+        }
+
+        // A failed native import must not store the Assimp result under the native key.
+        if ((nativeObj || nativeGltf) && loadFromCache(false)) {
+            return true;
+        }
+
         // Configure Assimp importer.
         Assimp::Importer importer;
         unsigned importFlags = aiProcess_JoinIdenticalVertices |
@@ -95,17 +268,28 @@ namespace StaticLoader {
         }
 
         AI_CONFIG_IMPORT_FBX_READ_MATERIALS;
-        // Look up file path.
-        std::string filePath = GetModelPath(modelName);
-        if (filePath.empty()) {
-            Logger::GetLogger()->error("ModelLoader: No path for model '{}'.", modelName);
-            return false;
+
+        // The importer owns (and deletes) the IO handler.
+        MappedIOSystem* ioSystem = nullptr;
+        if (mappedIO_) {
+            ioSystem = new MappedIOSystem();
+            importer.SetIOHandler(ioSystem);
         }
 
         // Load the scene.
+        const auto importStart = std::chrono::steady_clock::now();
         const aiScene* scene = importer.ReadFile(filePath, importFlags);
+        const std::chrono::duration<double, std::milli> importTime = std::chrono::steady_clock::now() - importStart;
+        if (ioSystem) {
+            ioStats_ = ioSystem->GetStats();
+            Logger::GetLogger()->info("ModelLoader: Import of '{}' read {:.1f} MiB ({:.1f} MiB mapped) from {} file(s), "
+                "{} reopen(s) from the handle cache; {:.1f} ms of {:.1f} ms in I/O.",
+                modelName, static_cast<double>(ioStats_.bytesRead_) / (1024.0 * 1024.0),
+                static_cast<double>(ioStats_.bytesMapped_) / (1024.0 * 1024.0), ioStats_.filesOpened_,
+                ioStats_.cacheHits_, ioStats_.ioMilliseconds_, importTime.count());
+        }
         if (!scene || !scene->HasMeshes()) {
-            Logger::GetLogger()->error("ModelLoader: Failed to load '{}'.", filePath);
+            Logger::GetLogger()->error("ModelLoader: Failed to load '{}': {}", filePath, importer.GetErrorString());
             return false;
         }
 
@@ -115,7 +299,14 @@ namespace StaticLoader {
         // 1) Load scene materials.
         LoadSceneMaterials(scene, matLayout, directory);
 
-        // 2) Traverse the scene node hierarchy (iteratively).
+        // 2) Traverse the scene node hierarchy (iteratively), gathering one job per mesh instance.
+        //    Instanced layouts get one job per aiMesh instead, kept in mesh space, and every
+        //    node referencing it adds an instance transform.
+        //    Material slots (including fallbacks) are resolved here, on the calling thread.
+        const bool instanced = meshLayout.instanced_;
+        std::vector<MeshJob> jobs;
+        std::unordered_map<unsigned, std::size_t> jobForMesh;
+        std::size_t meshReferences = 0;
         std::vector<std::pair<aiNode*, glm::mat4>> stack;
         stack.push_back({ scene->mRootNode, glm::mat4(1.0f) });
         while (!stack.empty()) {
@@ -125,38 +316,35 @@ namespace StaticLoader {
             glm::mat4 local = AiToGlm(node->mTransformation);
             glm::mat4 global = parentXform * local;
 
-            // Process each mesh in this node.
             for (unsigned i = 0; i < node->mNumMeshes; i++) {
                 unsigned meshIndex = node->mMeshes[i];
-                aiMesh* aimesh = scene->mMeshes[meshIndex];
-
-                // Bake the transformation into the mesh.
-                auto newMesh = ProcessAssimpMesh(aimesh, meshLayout, global);
+                const aiMesh* aimesh = scene->mMeshes[meshIndex];
+                ++meshReferences;
+                if (instanced) {
+                    auto it = jobForMesh.find(meshIndex);
+                    if (it != jobForMesh.end()) {
+                        jobs[it->second].instances_.push_back(global);
+                        continue;
+                    }
+                    jobForMesh.emplace(meshIndex, jobs.size());
+                }
 
-                // Determine the material ID.
-                std::size_t matID = 0;
+                // Determine the material slot.
                 std::size_t matIndex = aimesh->mMaterialIndex;
                 if (matIndex >= materialIDs_.size()) {
                     // Use a fallback material.
-                    auto fallbackMat = std::make_unique<graphics::Material>(matLayout);
-                    fallbackMat->SetName("FallbackMat_" + std::to_string(++fallbackMaterialCounter_));
-                    auto idOpt = graphics::MaterialManager::GetInstance().AddMaterial(std::move(fallbackMat));
-                    if (!idOpt.has_value()) {
-                        Logger::GetLogger()->error("ModelLoader: Failed to create fallback material.");
-                        continue;
-                    }
-                    materialIDs_.push_back(idOpt.value());
-                    matID = idOpt.value();
+                    MaterialRecord fallback;
+                    fallback.name_ = "FallbackMat_" + std::to_string(++fallbackMaterialCounter_);
+                    materialIDs_.push_back(CreateMaterialFromRecord(fallback, matLayout));
+                    materialRecords_.push_back(std::move(fallback));
+                    matIndex = materialIDs_.size() - 1;
+                }
+                if (instanced) {
+                    jobs.push_back({ aimesh, nullptr, nullptr, glm::mat4(1.0f), static_cast<uint32_t>(matIndex), { global } });
                 }
                 else {
-                    matID = materialIDs_[matIndex];
+                    jobs.push_back({ aimesh, nullptr, nullptr, global, static_cast<uint32_t>(matIndex) });
                 }
-
-                // Create MeshInfo and store.
-                graphics::MeshInfo mi;
-                mi.mesh_ = newMesh;
-                mi.materialIndex_ = static_cast<int>(matID);
-                objects_.push_back(mi);
             }
 
             // Push children nodes.
@@ -164,107 +352,559 @@ namespace StaticLoader {
                 stack.push_back({ node->mChildren[c], global });
             }
         }
+        if (instanced) {
+            Logger::GetLogger()->info("ModelLoader: {} mesh reference(s) share {} unique mesh(es).",
+                meshReferences, jobs.size());
+        }
+
+        FinishLoad(modelName, jobs, meshLayout, centerModel, cacheKey);
+
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - loadStart;
+        Logger::GetLogger()->info("ModelLoader: Loaded '{}' => {} meshes, {} materials in {:.1f} ms.",
+            modelName, objects_.size(), materialIDs_.size(), elapsed.count());
+        return true;
+    }
+
+    // ––– ImportObj –––
+    bool ModelLoader::ImportObj(const std::string& filePath,
+        const MeshLayout& meshLayout,
+        const MaterialLayout& matLayout,
+        ObjModel& objModel,
+        std::vector<MeshJob>& jobs)
+    {
+        ObjImportSettings settings;
+        settings.parallel_ = parallelProcessing_;
+        settings.generateNormals_ = meshLayout.hasNormals_;
+        settings.generateTangents_ = meshLayout.hasTangents_ || meshLayout.hasBitangents_;
+        ObjImporter importer(settings);
+        if (!importer.Import(filePath, objModel)) {
+            return false;
+        }
+        objImportStats_ = importer.GetStats();
+        const auto& s = objImportStats_;
+        Logger::GetLogger()->info("ObjImporter: '{}' ({:.1f} MiB, {} chunks) => {} meshes, {} vertices ({} positions), {} tris; "
+            "scan {:.1f} ms, parse {:.1f} ms, build {:.1f} ms, mtl {:.1f} ms.",
+            filePath, static_cast<double>(s.fileBytes_) / (1024.0 * 1024.0), s.chunkCount_, objModel.meshes_.size(),
+            s.vertexCount_, s.positionCount_, s.triangleCount_, s.scanMilliseconds_, s.parseMilliseconds_,
+            s.buildMilliseconds_, s.materialMilliseconds_);
+
+        const std::string directory = std::filesystem::path(filePath).parent_path().string();
+        materialRecords_.reserve(objModel.materials_.size());
+        for (const auto& material : objModel.materials_) {
+            materialRecords_.push_back(ReadMaterialRecord(material, matLayout, directory));
+        }
+
+        // OBJ has no node hierarchy: every mesh is placed once, as is.
+        jobs.reserve(objModel.meshes_.size());
+        for (auto& objMesh : objModel.meshes_) {
+            MeshJob job;
+            job.objMesh_ = &objMesh;
+            job.materialSlot_ = objMesh.materialSlot_;
+            if (meshLayout.instanced_) {
+                job.instances_.push_back(glm::mat4(1.0f));
+            }
+            jobs.push_back(std::move(job));
+        }
+        return true;
+    }
+
+    // ––– ImportGltf –––
+    bool ModelLoader::ImportGltf(const std::string& filePath,
+        const MeshLayout& meshLayout,
+        const MaterialLayout& matLayout,
+        GltfModel& gltfModel,
+        std::vector<MeshJob>& jobs)
+    {
+        GltfImportSettings settings;
+        settings.generateNormals_ = meshLayout.hasNormals_;
+        settings.generateTangents_ = meshLayout.hasTangents_ || meshLayout.hasBitangents_;
+        GltfImporter importer(settings);
+        if (!importer.Import(filePath, gltfModel)) {
+            return false;
+        }
+
+        const std::string directory = std::filesystem::path(filePath).parent_path().string();
+        materialRecords_.reserve(gltfModel.materials_.size());
+        for (const auto& material : gltfModel.materials_) {
+            materialRecords_.push_back(ReadMaterialRecord(material, matLayout, directory));
+        }
+
+        // Instanced layouts process each primitive once and keep every node placement as an
+        // instance; otherwise each placement is baked into its own mesh, like the Assimp path.
+        if (meshLayout.instanced_) {
+            std::vector<std::size_t> jobForPrimitive(gltfModel.primitives_.size(), SIZE_MAX);
+            for (const auto& placement : gltfModel.placements_) {
+                std::size_t& jobIndex = jobForPrimitive[placement.primitive_];
+                if (jobIndex == SIZE_MAX) {
+                    const GltfPrimitive& primitive = gltfModel.primitives_[placement.primitive_];
+                    jobIndex = jobs.size();
+                    jobs.push_back({ nullptr, nullptr, &primitive.source_, glm::mat4(1.0f), primitive.materialSlot_, {} });
+                }
+                jobs[jobIndex].instances_.push_back(placement.transform_);
+            }
+            Logger::GetLogger()->info("ModelLoader: {} glTF placement(s) share {} unique primitive(s).",
+                gltfModel.placements_.size(), jobs.size());
+        }
+        else {
+            jobs.reserve(gltfModel.placements_.size());
+            for (const auto& placement : gltfModel.placements_) {
+                const GltfPrimitive& primitive = gltfModel.primitives_[placement.primitive_];
+                jobs.push_back({ nullptr, nullptr, &primitive.source_, placement.transform_, primitive.materialSlot_ });
+            }
+        }
+        return true;
+    }
+
+    // ––– FinishLoad –––
+    void ModelLoader::FinishLoad(const std::string& modelName,
+        std::vector<MeshJob>& jobs,
+        const MeshLayout& meshLayout,
+        bool centerModel,
+        std::optional<uint64_t> cacheKey)
+    {
+        // 3) Bake transforms and build LODs; each job writes only its own slot,
+        //    so the final order matches the traversal order regardless of scheduling.
+        std::vector<std::shared_ptr<graphics::Mesh>> meshes(jobs.size());
+        optimizationStats_.assign(jobs.size(), MeshOptimizationStats{});
+        std::atomic<int64_t> busyMicros{ 0 };
+        auto processJob = [&](std::size_t i) {
+            const auto jobStart = std::chrono::steady_clock::now();
+            SourceMesh source = jobs[i].aimesh_ ? MakeSourceMesh(jobs[i].aimesh_)
+                : jobs[i].objMesh_ ? MakeSourceMesh(*jobs[i].objMesh_)
+                : *jobs[i].source_;
+            meshes[i] = ProcessSourceMesh(source, meshLayout, jobs[i].transform_, optimizationStats_[i]);
+            busyMicros += std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - jobStart).count();
+            };
+
+        const auto processStart = std::chrono::steady_clock::now();
+        std::size_t threadCount = 1;
+        if (parallelProcessing_ && jobs.size() > 1) {
+            auto& pool = ThreadPool::GetInstance();
+            threadCount = pool.GetThreadCount() + 1; // The calling thread helps too.
+            pool.ParallelFor(jobs.size(), processJob);
+        }
+        else {
+            for (std::size_t i = 0; i < jobs.size(); ++i) {
+                processJob(i);
+            }
+        }
+        const std::chrono::duration<double, std::milli> processWall = std::chrono::steady_clock::now() - processStart;
+        const double busyMs = static_cast<double>(busyMicros.load()) / 1000.0;
+        Logger::GetLogger()->info("ModelLoader: Processed {} meshes on {} thread(s) in {:.1f} ms "
+            "(serial work {:.1f} ms, speedup {:.2f}x).",
+            jobs.size(), threadCount, processWall.count(), busyMs,
+            processWall.count() > 0.0 ? busyMs / processWall.count() : 1.0);
+        LogOptimizationStats(modelName);
+        LogBoundsTightness(modelName);
+
+        objects_.reserve(jobs.size());
+        objectMaterialSlots_.reserve(jobs.size());
+        for (std::size_t i = 0; i < jobs.size(); ++i) {
+            graphics::MeshInfo mi;
+            mi.mesh_ = std::move(meshes[i]);
+            mi.materialIndex_ = static_cast<int>(materialIDs_[jobs[i].materialSlot_]);
+            mi.instanceTransforms_ = std::move(jobs[i].instances_);
+            objects_.push_back(std::move(mi));
+            objectMaterialSlots_.push_back(jobs[i].materialSlot_);
+        }
 
         if (centerModel) {
             CenterMeshes();
         }
+        AttachGeometrySources(modelName, cacheKey);
+
+        if (deferLODs_) {
+            // The cache entry is written once the full LOD chain has been published.
+            ScheduleDeferredLODs(modelName, cacheKey);
+        }
+        else if (cacheKey) {
+            SaveToCache(modelName, *cacheKey);
+        }
+    }
 
-        Logger::GetLogger()->info("ModelLoader: Loaded '{}' => {} meshes, {} materials.",
-            modelName, objects_.size(), materialIDs_.size());
+    // ––– LoadFromCache –––
+    bool ModelLoader::LoadFromCache(const std::string& modelName,
+        uint64_t cacheKey,
+        const MaterialLayout& matLayout)
+    {
+        CachedModel cached;
+        if (!MeshCache(cacheDirectory_).Load(modelName, cacheKey, cached)) {
+            return false;
+        }
+
+        PreloadTextures(cached.materials_);
+        materialIDs_.reserve(cached.materials_.size());
+        for (const auto& record : cached.materials_) {
+            materialIDs_.push_back(CreateMaterialFromRecord(record, matLayout));
+        }
+        materialRecords_ = std::move(cached.materials_);
+
+        objects_.reserve(cached.meshes_.size());
+        objectMaterialSlots_.reserve(cached.meshes_.size());
+        for (auto& entry : cached.meshes_) {
+            graphics::MeshInfo mi;
+            mi.mesh_ = std::move(entry.mesh_);
+            mi.materialIndex_ = static_cast<int>(materialIDs_[entry.materialSlot_]);
+            mi.instanceTransforms_ = std::move(entry.instances_);
+            objects_.push_back(std::move(mi));
+            objectMaterialSlots_.push_back(entry.materialSlot_);
+        }
+        AttachGeometrySources(modelName, cacheKey);
         return true;
     }
 
+    // ––– AttachGeometrySources –––
+    void ModelLoader::AttachGeometrySources(const std::string& modelName, std::optional<uint64_t> cacheKey) const
+    {
+        // Loaded meshes are only read by batch builds, so their CPU copy may be released
+        // after upload; with a cache entry they can even be dropped and reloaded from it.
+        for (std::size_t i = 0; i < objects_.size(); ++i) {
+            auto& mesh = *objects_[i].mesh_;
+            mesh.cpuReleasable_ = true;
+            if (cacheKey) {
+                mesh.geometrySource_ = std::make_shared<CachedGeometrySource>(
+                    cacheDirectory_, modelName, *cacheKey, static_cast<uint32_t>(i));
+            }
+        }
+    }
+
+    // ––– MakeCachedModel –––
+    CachedModel ModelLoader::MakeCachedModel() const
+    {
+        CachedModel cached;
+        cached.materials_ = materialRecords_;
+        cached.meshes_.reserve(objects_.size());
+        for (std::size_t i = 0; i < objects_.size(); ++i) {
+            cached.meshes_.push_back({ objects_[i].mesh_, objectMaterialSlots_[i], objects_[i].instanceTransforms_ });
+        }
+        return cached;
+    }
+
+    // ––– SaveToCache –––
+    void ModelLoader::SaveToCache(const std::string& modelName, uint64_t cacheKey) const
+    {
+        if (!MeshCache(cacheDirectory_).Save(modelName, cacheKey, MakeCachedModel())) {
+            Logger::GetLogger()->warn("ModelLoader: Could not cache '{}'; next start will re-import.", modelName);
+        }
+    }
+
+    // ––– ScheduleDeferredLODs –––
+    void ModelLoader::ScheduleDeferredLODs(const std::string& modelName, std::optional<uint64_t> cacheKey) const
+    {
+        std::vector<std::shared_ptr<graphics::Mesh>> meshes;
+        meshes.reserve(objects_.size());
+        for (const auto& obj : objects_) {
+            meshes.push_back(obj.mesh_);
+        }
+
+        // Runs on a worker: reads only positions and the LOD0 range of the mesh.
+        auto generator = [policy = lodPolicy_, bounds = boundsSettings_](const graphics::Mesh& mesh) {
+            LODStreamer::LODChain chain;
+            if (mesh.lods_.empty()) {
+                return chain;
+            }
+            const auto& lod0 = mesh.lods_.front();
+            std::vector<uint32_t> srcIndices(mesh.indices_.begin() + lod0.indexOffset_,
+                mesh.indices_.begin() + lod0.indexOffset_ + lod0.indexCount_);
+            const std::vector<float> positions3f = FlattenPositions(mesh);
+            chain = GenerateLODChain(std::move(srcIndices), positions3f, GatherLODAttributes(mesh, policy), policy);
+            chain.erase(chain.begin()); // LOD0 is already resident.
+            if (bounds.perLODSpheres_) {
+                for (auto& level : chain) {
+                    level.bounds_ = graphics::ComputeBoundingSphere(positions3f, level.indices_, bounds.sphereFit_);
+                }
+            }
+            return chain;
+            };
+
+        std::function<void()> onComplete;
+        if (cacheKey) {
+            onComplete = [cached = MakeCachedModel(), cacheDirectory = cacheDirectory_, modelName, key = *cacheKey]() {
+                if (!MeshCache(cacheDirectory).Save(modelName, key, cached)) {
+                    Logger::GetLogger()->warn("ModelLoader: Could not cache '{}'; next start will re-import.", modelName);
+                }
+                };
+        }
+
+        Logger::GetLogger()->info("ModelLoader: Generating LODs for {} mesh(es) of '{}' in the background.",
+            meshes.size(), modelName);
+        LODStreamer::GetInstance().Submit(std::move(meshes), std::move(generator), std::move(onComplete));
+    }
+
     // ––– LoadSceneMaterials –––
     void ModelLoader::LoadSceneMaterials(const aiScene* scene,
         const MaterialLayout& matLayout,
         const std::string& directory)
     {
-        materialIDs_.reserve(scene->mNumMaterials);
+        materialRecords_.reserve(scene->mNumMaterials);
         for (unsigned i = 0; i < scene->mNumMaterials; i++) {
             aiMaterial* aimat = scene->mMaterials[i];
-            auto matID = CreateMaterialForAssimpMat(aimat, matLayout, directory);
-            materialIDs_.push_back(matID);
+            materialRecords_.push_back(ReadMaterialRecord(ReadAssimpMaterial(aimat), matLayout, directory));
         }
+        CreateMaterials(matLayout);
     }
 
-    // ––– CreateMaterialForAssimpMat –––
-    std::size_t ModelLoader::CreateMaterialForAssimpMat(const aiMaterial* aiMat,
-        const MaterialLayout& matLayout,
-        const std::string& directory)
+    // ––– CreateMaterials –––
+    void ModelLoader::CreateMaterials(const MaterialLayout& matLayout)
     {
+        // Decode every referenced texture up front; material creation then finds them registered.
+        PreloadTextures(materialRecords_);
+        materialIDs_.reserve(materialRecords_.size());
+        for (const auto& record : materialRecords_) {
+            materialIDs_.push_back(CreateMaterialFromRecord(record, matLayout));
+        }
+    }
+
+    // ––– PreloadTextures –––
+    void ModelLoader::PreloadTextures(const std::vector<MaterialRecord>& records)
+    {
+        const auto stageStart = std::chrono::steady_clock::now();
+        auto& textureManager = graphics::TextureManager::GetInstance();
+
+        // Unique texture files not registered yet (textures are registered by name, first path wins).
+        struct TextureRequest {
+            std::string name_;
+            std::string path_;
+        };
+        std::vector<TextureRequest> requests;
+        std::unordered_set<std::string> seenPaths;
+        std::unordered_set<std::string> seenNames;
+        for (const auto& record : records) {
+            if (graphics::MaterialManager::GetInstance().GetMaterialIDByName(record.name_).has_value()) {
+                continue; // Reused material: its textures are not loaded again.
+            }
+            for (const auto& tex : record.textures_) {
+                if (textureManager.HasTexture(tex.name_) || seenNames.contains(tex.name_) ||
+                    !seenPaths.insert(tex.path_).second) {
+                    continue;
+                }
+                seenNames.insert(tex.name_);
+                requests.push_back({ tex.name_, tex.path_ });
+            }
+        }
+        if (requests.empty()) {
+            return;
+        }
+
+        struct DecodedTexture {
+            graphics::Bitmap bitmap_;
+            double milliseconds_ = 0.0;
+        };
+        auto decode = [](const std::string& path) {
+            const auto start = std::chrono::steady_clock::now();
+            DecodedTexture decoded;
+            decoded.bitmap_ = graphics::TextureLoader::Decode2DBitmap(path);
+            decoded.milliseconds_ = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            return decoded;
+            };
+
+        TextureLoadStats& stats = textureLoadStats_;
+        const graphics::TextureConfig textureConfig;
+        auto upload = [&](const TextureRequest& request, DecodedTexture& decoded) {
+            stats.decodeMilliseconds_ += decoded.milliseconds_;
+            const auto start = std::chrono::steady_clock::now();
+            if (textureManager.Create2DTexture(request.name_, decoded.bitmap_, textureConfig)) {
+                ++stats.textureCount_;
+            }
+            else {
+                ++stats.failedCount_;
+            }
+            stats.uploadMilliseconds_ += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            };
+
+        if (!parallelProcessing_ || requests.size() == 1) {
+            for (const auto& request : requests) {
+                try {
+                    DecodedTexture decoded = decode(request.path_);
+                    upload(request, decoded);
+                }
+                catch (const std::exception&) {
+                    ++stats.failedCount_; // Already logged by the decoder.
+                }
+            }
+        }
+        else {
+            // Decode on the pool; upload on this thread in completion order, helping with
+            // queued decodes whenever nothing is ready to upload.
+            auto& pool = ThreadPool::GetInstance();
+            std::vector<std::future<DecodedTexture>> pending;
+            pending.reserve(requests.size());
+            for (const auto& request : requests) {
+                pending.push_back(pool.Submit([decode, path = request.path_]() { return decode(path); }));
+            }
+            std::vector<bool> done(pending.size(), false);
+            std::size_t remaining = pending.size();
+            while (remaining > 0) {
+                bool progressed = false;
+                for (std::size_t i = 0; i < pending.size(); ++i) {
+                    if (done[i] || pending[i].wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                        continue;
+                    }
+                    done[i] = true;
+                    --remaining;
+                    progressed = true;
+                    try {
+                        DecodedTexture decoded = pending[i].get();
+                        upload(requests[i], decoded);
+                    }
+                    catch (const std::exception&) {
+                        ++stats.failedCount_;
+                    }
+                }
+                if (!progressed && !pool.RunPendingTask()) {
+                    for (std::size_t i = 0; i < pending.size(); ++i) {
+                        if (!done[i]) {
+                            pending[i].wait_for(std::chrono::milliseconds(1));
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        stats.wallMilliseconds_ += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - stageStart).count();
+        Logger::GetLogger()->info("ModelLoader: Textures: {} uploaded, {} failed in {:.1f} ms "
+            "(decode {:.1f} ms across threads, upload {:.1f} ms on the calling thread).",
+            stats.textureCount_, stats.failedCount_, stats.wallMilliseconds_,
+            stats.decodeMilliseconds_, stats.uploadMilliseconds_);
+    }
+
+    // ––– ReadAssimpMaterial –––
+    SourceMaterial ModelLoader::ReadAssimpMaterial(const aiMaterial* aiMat)
+    {
+        SourceMaterial source;
         aiString aiName;
         if (AI_SUCCESS != aiMat->Get(AI_MATKEY_NAME, aiName)) {
             aiName = aiString(("UnnamedMat_" + std::to_string(unnamedMaterialCounter_++)).c_str());
         }
-        std::string matName(aiName.C_Str());
+        source.name_ = aiName.C_Str();
+
+        // Keys missing from the material keep the SourceMaterial defaults.
+        aiColor3D color;
+        if (aiMat->Get(AI_MATKEY_COLOR_AMBIENT, color) == AI_SUCCESS)  source.ambient_ = glm::vec3(color.r, color.g, color.b);
+        if (aiMat->Get(AI_MATKEY_COLOR_DIFFUSE, color) == AI_SUCCESS)  source.diffuse_ = glm::vec3(color.r, color.g, color.b);
+        if (aiMat->Get(AI_MATKEY_COLOR_SPECULAR, color) == AI_SUCCESS) source.specular_ = glm::vec3(color.r, color.g, color.b);
+        if (aiMat->Get(AI_MATKEY_COLOR_EMISSIVE, color) == AI_SUCCESS) source.emissive_ = glm::vec3(color.r, color.g, color.b);
+        aiMat->Get(AI_MATKEY_SHININESS, source.shininess_);
+        aiMat->Get(AI_MATKEY_REFRACTI, source.refractionIndex_);
+        aiMat->Get(AI_MATKEY_OPACITY, source.opacity_);
 
+        //for (int i = 0; i <= 25; i++)
+        //{
+        //    unsigned count = aiMat->GetTextureCount(static_cast<aiTextureType>(i));
+        //    if (count > 0) {
+        //        allTextures_[static_cast<aiTextureType>(i)].insert(mat->GetName());
+        //    }
+        //}
+        for (const auto& [aiType, myType] : aiToMyType_) {
+            unsigned count = aiMat->GetTextureCount(aiType);
+            for (unsigned i = 0; i < count; i++) {
+                aiString texPath;
+                if (aiMat->GetTexture(aiType, i, &texPath) == AI_SUCCESS) {
+                    source.textures_.emplace_back(aiType, texPath.C_Str());
+                }
+            }
+        }
+        return source;
+    }
+
+    // ––– ReadMaterialRecord –––
+    MaterialRecord ModelLoader::ReadMaterialRecord(const SourceMaterial& source,
+        const MaterialLayout& matLayout,
+        const std::string& directory) const
+    {
+        MaterialRecord record;
+        record.name_ = source.name_;
+
+        // Material properties (colors, floats, etc.).
+        ReadMaterialProperties(source, matLayout, record);
+
+        // Texture references.
+        ReadMaterialTextures(source, directory, record);
+        return record;
+    }
+
+    // ––– CreateMaterialFromRecord –––
+    std::size_t ModelLoader::CreateMaterialFromRecord(const MaterialRecord& record,
+        const MaterialLayout& matLayout) const
+    {
         // Reuse an existing material if one exists.
-        auto existingMatID = graphics::MaterialManager::GetInstance().GetMaterialIDByName(matName);
+        auto existingMatID = graphics::MaterialManager::GetInstance().GetMaterialIDByName(record.name_);
         if (existingMatID.has_value()) {
             return existingMatID.value();
         }
 
         auto material = std::make_unique<graphics::Material>(matLayout);
-        material->SetName(matName);
+        material->SetName(record.name_);
 
-        // Load material properties (colors, floats, etc.).
-        LoadMaterialProperties(aiMat, material, matLayout);
+        for (const auto& param : record.params_) {
+            switch (param.type_) {
+            case MaterialParamType::Shininess:
+            case MaterialParamType::RefractionIndex:
+            case MaterialParamType::Opacity:
+            case MaterialParamType::Illumination:
+                material->AssignToPackedParams(param.type_, param.value_.x);
+                break;
+            default:
+                material->AssignToPackedParams(param.type_, param.value_);
+                break;
+            }
+        }
 
-        // Load texture references.
-        LoadMaterialTextures(aiMat, material, matLayout, directory);
+        for (const auto& tex : record.textures_) {
+            graphics::TextureConfig texture_config;
+            auto loadedTex = graphics::TextureManager::GetInstance().Load2DTexture(tex.name_, tex.path_, texture_config);
+            if (!loadedTex) {
+                Logger::GetLogger()->error("Failed to load texture '{}' for type={}.",
+                    tex.path_, static_cast<int>(tex.type_));
+                continue;
+            }
+            material->SetTexture(tex.type_, loadedTex);
+            Logger::GetLogger()->info("Loaded texture '{}' (type={}).", tex.path_, static_cast<int>(tex.type_));
+        }
 
         // Register the new material.
         auto idOpt = graphics::MaterialManager::GetInstance().AddMaterial(std::move(material));
         if (!idOpt.has_value()) {
-            Logger::GetLogger()->error("ModelLoader: Failed to add material '{}'.", matName);
+            Logger::GetLogger()->error("ModelLoader: Failed to add material '{}'.", record.name_);
             return 0;
         }
 
         return idOpt.value();
     }
 
-    // ––– LoadMaterialProperties –––
-    void ModelLoader::LoadMaterialProperties(const aiMaterial* aiMat,
-        const std::unique_ptr<graphics::Material>& mat,
-        const MaterialLayout& matLayout)
+    // ––– ReadMaterialProperties –––
+    void ModelLoader::ReadMaterialProperties(const SourceMaterial& source,
+        const MaterialLayout& matLayout,
+        MaterialRecord& record) const
     {
+        auto push = [&record](MaterialParamType type, const glm::vec3& value) {
+            record.params_.push_back({ type, value });
+            };
         // Ambient (Ka)
         if (matLayout.HasParam(MaterialParamType::Ambient)) {
-            aiColor3D ambient(0.2f, 0.2f, 0.2f);
-            aiMat->Get(AI_MATKEY_COLOR_AMBIENT, ambient);
-            mat->AssignToPackedParams(MaterialParamType::Ambient,
-                glm::vec3(ambient.r, ambient.g, ambient.b));
+            push(MaterialParamType::Ambient, source.ambient_);
         }
         // Diffuse (Kd)
         if (matLayout.HasParam(MaterialParamType::Diffuse)) {
-            aiColor3D diffuse(0.8f, 0.8f, 0.8f);
-            aiMat->Get(AI_MATKEY_COLOR_DIFFUSE, diffuse);
-            mat->AssignToPackedParams(MaterialParamType::Diffuse,
-                glm::vec3(diffuse.r, diffuse.g, diffuse.b));
+            push(MaterialParamType::Diffuse, source.diffuse_);
         }
         // Specular (Ks)
         if (matLayout.HasParam(MaterialParamType::Specular)) {
-            aiColor3D specular(0.0f, 0.0f, 0.0f);
-            aiMat->Get(AI_MATKEY_COLOR_SPECULAR, specular);
-            mat->AssignToPackedParams(MaterialParamType::Specular,
-                glm::vec3(specular.r, specular.g, specular.b));
+            push(MaterialParamType::Specular, source.specular_);
         }
         // Shininess (Ns)
         if (matLayout.HasParam(MaterialParamType::Shininess)) {
-            float shininess = 32.0f;
-            aiMat->Get(AI_MATKEY_SHININESS, shininess);
-            mat->AssignToPackedParams(MaterialParamType::Shininess, shininess);
+            push(MaterialParamType::Shininess, glm::vec3(source.shininess_));
         }
         // Refraction Index (Ni)
         if (matLayout.HasParam(MaterialParamType::RefractionIndex)) {
-            float ni = 1.0f;
-            aiMat->Get(AI_MATKEY_REFRACTI, ni);
-            mat->AssignToPackedParams(MaterialParamType::RefractionIndex, ni);
+            push(MaterialParamType::RefractionIndex, glm::vec3(source.refractionIndex_));
         }
         // Opacity (d)
         if (matLayout.HasParam(MaterialParamType::Opacity)) {
-            float opacity = 1.0f;
-            aiMat->Get(AI_MATKEY_OPACITY, opacity);
+            const float opacity = source.opacity_;
 
             // The book does: transparencyFactor = clamp(1 - opacity, 0, 1)
             // and if near-opaque, force to zero. Then final alpha = 1 - transparencyFactor
@@ -275,14 +915,11 @@ namespace StaticLoader {
                 transparencyFactor = 0.0f;
 
             float finalOpacity = 1.0f - transparencyFactor;
-            mat->AssignToPackedParams(MaterialParamType::Opacity, finalOpacity);
+            push(MaterialParamType::Opacity, glm::vec3(finalOpacity));
         }
         // Emissive (Ke)
         if (matLayout.HasParam(MaterialParamType::Emissive)) {
-            aiColor3D emissive(0.0f, 0.0f, 0.0f);
-            aiMat->Get(AI_MATKEY_COLOR_EMISSIVE, emissive);
-            mat->AssignToPackedParams(MaterialParamType::Emissive,
-                glm::vec3(emissive.r, emissive.g, emissive.b));
+            push(MaterialParamType::Emissive, source.emissive_);
         }
         //// Illumination (illum)
         //if (matLayout.HasParam(MaterialParamType::Illumination)) {
@@ -299,65 +936,74 @@ namespace StaticLoader {
         //}
     }
 
-    // ––– LoadMaterialTextures –––
-    void ModelLoader::LoadMaterialTextures(const aiMaterial* aiMat,
-        const std::unique_ptr<graphics::Material>& mat,
-        const MaterialLayout& matLayout,
-        const std::string& directory)
+    // ––– ReadMaterialTextures –––
+    void ModelLoader::ReadMaterialTextures(const SourceMaterial& source,
+        const std::string& directory,
+        MaterialRecord& record) const
     {
-        //for (int i = 0; i <= 25; i++)
-        //{
-        //    unsigned count = aiMat->GetTextureCount(static_cast<aiTextureType>(i));
-        //    if (count > 0) {
-        //        allTextures_[static_cast<aiTextureType>(i)].insert(mat->GetName());
-        //    }
-        //}
+        auto addTexture = [&](TextureType myType, const std::string& sourcePath) {
+            // Build the full texture path.
+            std::filesystem::path rel(sourcePath);
+            rel = rel.lexically_normal();
+            std::filesystem::path full = std::filesystem::path(directory) / rel;
+            full = full.lexically_normal();
+
+            record.textures_.push_back({ myType, rel.filename().string(), full.string() });
+            };
+
         // For each mapping from Assimp texture type to your texture type.
         for (auto& [aiType, myType] : aiToMyType_) {
-            unsigned count = aiMat->GetTextureCount(aiType);
-            for (unsigned i = 0; i < count; i++) {
-                aiString texPath;
-                if (aiMat->GetTexture(aiType, i, &texPath) == AI_SUCCESS) {
-                    // Build the full texture path.
-                    std::filesystem::path rel(texPath.C_Str());
-                    rel = rel.lexically_normal();
-                    std::filesystem::path full = std::filesystem::path(directory) / rel;
-                    full = full.lexically_normal();
-
-                    auto textureName = rel.filename().string();
-                    graphics::TextureConfig texture_config;
-                    auto loadedTex = graphics::TextureManager::GetInstance().Load2DTexture(textureName, full.string(), texture_config);
-                    if (!loadedTex) {
-                        Logger::GetLogger()->error("Failed to load texture '{}' for type={}.",
-                            full.string(), static_cast<int>(myType));
-                        continue;
-                    }
-                    mat->SetTexture(myType, loadedTex);
-                    Logger::GetLogger()->info("Loaded texture '{}' (type={}).", full.string(), static_cast<int>(myType));
+            for (const auto& [sourceType, sourcePath] : source.textures_) {
+                if (sourceType == aiType) {
+                    addTexture(myType, sourcePath);
                 }
             }
         }
+        // Slots the importer already resolved (glTF PBR).
+        for (const auto& [myType, sourcePath] : source.typedTextures_) {
+            addTexture(myType, sourcePath);
+        }
     }
 
-    // ––– ProcessAssimpMesh –––
-    std::shared_ptr<graphics::Mesh> ModelLoader::ProcessAssimpMesh(const aiMesh* aimesh,
+    // ––– ProcessSourceMesh –––
+    std::shared_ptr<graphics::Mesh> ModelLoader::ProcessSourceMesh(SourceMesh& source,
         const MeshLayout& meshLayout,
-        const glm::mat4& transform)
+        const glm::mat4& transform,
+        MeshOptimizationStats& outStats) const
     {
         auto mesh = std::make_shared<graphics::Mesh>();
+        const std::size_t vertexCount = source.vertexCount_;
+
+        // Packed meshes get one interleaved allocation, written in GPU order.
+        const bool packed = packedVertices_ && vertexCount > 0;
+        if (packed) {
+            mesh->vertexFormat_ = graphics::VertexFormat::FromLayout(meshLayout);
+            mesh->packedVertices_.assign(static_cast<std::size_t>(vertexCount) * mesh->vertexFormat_.stride_, std::byte{ 0 });
+            if (mesh->vertexFormat_.quantized_) {
+                mesh->quantization_ = ComputeQuantizationParams(source, meshLayout, transform);
+            }
+        }
 
         // Process positions.
-        if (meshLayout.hasPositions_ && aimesh->HasPositions()) {
-            mesh->positions_.reserve(aimesh->mNumVertices);
+        if (meshLayout.hasPositions_ && source.positions_) {
+            if (!packed) {
+                mesh->positions_.reserve(vertexCount);
+            }
             glm::vec4 tmp;
-            for (unsigned v = 0; v < aimesh->mNumVertices; v++) {
-                tmp.x = scaleFactor_ * aimesh->mVertices[v].x;
-                tmp.y = scaleFactor_ * aimesh->mVertices[v].y;
-                tmp.z = scaleFactor_ * aimesh->mVertices[v].z;
+            for (std::size_t v = 0; v < vertexCount; v++) {
+                const glm::vec3 p = source.positions_[v];
+                tmp.x = scaleFactor_ * p.x;
+                tmp.y = scaleFactor_ * p.y;
+                tmp.z = scaleFactor_ * p.z;
                 tmp.w = 1.0f;
                 glm::vec4 worldPos = transform * tmp;
                 glm::vec3 finalPos(worldPos);
-                mesh->positions_.push_back(finalPos);
+                if (packed) {
+                    mesh->SetPosition(v, finalPos);
+                }
+                else {
+                    mesh->positions_.push_back(finalPos);
+                }
 
                 // Update bounding box.
                 mesh->minBounds_ = glm::min(mesh->minBounds_, finalPos);
@@ -366,168 +1012,207 @@ namespace StaticLoader {
         }
 
         // Process normals.
-        if (meshLayout.hasNormals_ && aimesh->HasNormals()) {
-            mesh->normals_.reserve(aimesh->mNumVertices);
+        if (meshLayout.hasNormals_ && source.normals_) {
+            if (!packed) {
+                mesh->normals_.reserve(vertexCount);
+            }
             glm::mat3 normalMat = glm::mat3(glm::transpose(glm::inverse(transform)));
-            for (unsigned v = 0; v < aimesh->mNumVertices; v++) {
-                glm::vec3 n(aimesh->mNormals[v].x,
-                    aimesh->mNormals[v].y,
-                    aimesh->mNormals[v].z);
+            for (std::size_t v = 0; v < vertexCount; v++) {
+                glm::vec3 n = source.normals_[v];
                 n = glm::normalize(normalMat * n);
-                mesh->normals_.push_back(n);
+                if (packed) {
+                    mesh->SetNormal(v, n);
+                }
+                else {
+                    mesh->normals_.push_back(n);
+                }
             }
         }
 
         // Process tangents and bitangents.
-        if ((meshLayout.hasTangents_ || meshLayout.hasBitangents_) &&
-            aimesh->HasTangentsAndBitangents())
+        if ((meshLayout.hasTangents_ || meshLayout.hasBitangents_) && source.tangents_)
         {
             glm::mat3 tbMat = glm::mat3(glm::transpose(glm::inverse(transform)));
-            if (meshLayout.hasTangents_) {
-                mesh->tangents_.reserve(aimesh->mNumVertices);
+            if (meshLayout.hasTangents_ && !packed) {
+                mesh->tangents_.reserve(vertexCount);
             }
-            for (unsigned v = 0; v < aimesh->mNumVertices; v++) {
+            for (std::size_t v = 0; v < vertexCount; v++) {
                 if (meshLayout.hasTangents_) {
-                    glm::vec3 t(aimesh->mTangents[v].x,
-                        aimesh->mTangents[v].y,
-                        aimesh->mTangents[v].z);
+                    glm::vec3 t = source.tangents_[v];
                     t = glm::normalize(tbMat * t);
-                    mesh->tangents_.push_back(t);
+                    if (packed) {
+                        mesh->SetTangent(v, t);
+                    }
+                    else {
+                        mesh->tangents_.push_back(t);
+                    }
                 }
             }
         }
 
-        // Process UVs.
-        if (!meshLayout.textureTypes_.none() && aimesh->HasTextureCoords(0)) {
-            std::vector<glm::vec2> uvSet(aimesh->mNumVertices);
-            for (unsigned v = 0; v < aimesh->mNumVertices; v++) {
-                uvSet[v] = glm::vec2(aimesh->mTextureCoords[0][v].x,
-                    aimesh->mTextureCoords[0][v].y);
-            }
-            // Iterate over all bits set in the bitset.
-            for (std::size_t i = 0; i < meshLayout.textureTypes_.size(); ++i) {
-                if (meshLayout.textureTypes_.test(i)) {
-                    // Assume that TextureType values match the bitset index.
-                    mesh->uvs_[static_cast<TextureType>(i)] = uvSet;
+        // Process UVs: one set per distinct UV channel, however many texture types sample it.
+        const auto uvChannels = meshLayout.GetUVChannels();
+        if (uvChannels.any()) {
+            for (uint32_t c = 0; c < kMaxUVChannels; ++c) {
+                if (!uvChannels.test(c) || !source.uvs_[c]) {
+                    continue;
+                }
+                const auto& coords = source.uvs_[c];
+                if (packed) {
+                    for (std::size_t v = 0; v < vertexCount; v++) {
+                        mesh->SetUV(c, v, coords[v]);
+                    }
+                }
+                else {
+                    if (mesh->uvs_.size() <= c) {
+                        mesh->uvs_.resize(c + 1);
+                    }
+                    auto& uvSet = mesh->uvs_[c];
+                    uvSet.resize(vertexCount);
+                    for (std::size_t v = 0; v < vertexCount; v++) {
+                        uvSet[v] = coords[v];
+                    }
                 }
             }
         }
 
-        // Process indices.
-        std::vector<uint32_t> srcIndices;
-        srcIndices.reserve(aimesh->mNumFaces * 3);
-        for (unsigned f = 0; f < aimesh->mNumFaces; f++) {
-            const aiFace& face = aimesh->mFaces[f];
-            for (unsigned idx = 0; idx < face.mNumIndices; idx++) {
-                srcIndices.push_back(face.mIndices[idx]);
-            }
-        }
-
-        // Compute bounding volumes.
-        mesh->localCenter_ = 0.5f * (mesh->minBounds_ + mesh->maxBounds_);
-        mesh->boundingSphereRadius_ = glm::length(mesh->maxBounds_ - mesh->localCenter_);
+        // Take over the source indices.
+        std::vector<uint32_t> srcIndices = std::move(source.indices_);
 
-        // Prepare vertex positions for LOD generation.
-        std::vector<float> floatPositions;
-        floatPositions.reserve(mesh->positions_.size() * 3);
-        for (const auto& pos : mesh->positions_) {
-            floatPositions.push_back(pos.x);
-            floatPositions.push_back(pos.y);
-            floatPositions.push_back(pos.z);
+        // Optimize LOD0 (vertex cache, overdraw, vertex fetch) before simplification.
+        std::vector<float> positions3f = FlattenPositions(*mesh);
+        if (optimizationSettings_.AnyPass() || optimizationSettings_.collectStats_) {
+            outStats = OptimizeMesh(*mesh, srcIndices, positions3f, optimizationSettings_);
         }
 
-        // Generate LODs.
-        std::vector<std::vector<uint32_t>> lodIndices;
-        GenerateLODs(std::move(srcIndices), floatPositions, lodIndices);
+        // Generate LODs (or only publish LOD0 when they are generated in the background).
+        std::vector<LODLevel> lodLevels;
+        if (deferLODs_) {
+            lodLevels.push_back({ std::move(srcIndices), 0.0f });
+        }
+        else {
+            lodLevels = GenerateLODChain(std::move(srcIndices), positions3f, GatherLODAttributes(*mesh, lodPolicy_), lodPolicy_);
+        }
         mesh->indices_.clear();
         mesh->lods_.clear();
-        for (auto& singleLOD : lodIndices) {
+        for (auto& level : lodLevels) {
             graphics::MeshLOD lod;
             lod.indexOffset_ = static_cast<uint32_t>(mesh->indices_.size());
-            lod.indexCount_ = static_cast<uint32_t>(singleLOD.size());
-            mesh->indices_.insert(mesh->indices_.end(), singleLOD.begin(), singleLOD.end());
+            lod.indexCount_ = static_cast<uint32_t>(level.indices_.size());
+            lod.error_ = level.error_;
+            mesh->indices_.insert(mesh->indices_.end(), level.indices_.begin(), level.indices_.end());
             mesh->lods_.push_back(lod);
         }
 
+        // Fit the bounding volumes (sphere, oriented box, per-LOD spheres) to the final vertices.
+        mesh->ComputeBounds(boundsSettings_, positions3f);
+
+        // Split the resident LODs into meshlets for cluster culling.
+        if (clusterSettings_.enabled_) {
+            BuildClusters(*mesh, positions3f, clusterSettings_);
+        }
+
         return mesh;
     }
 
-    // ––– GenerateLODs –––
-    void ModelLoader::GenerateLODs(std::vector<uint32_t> srcIndices,
-        const std::vector<float>& vertices3f,
-        std::vector<std::vector<uint32_t>>& outLods) const
+    // ––– LogOptimizationStats –––
+    void ModelLoader::LogOptimizationStats(const std::string& modelName) const
     {
-        if (srcIndices.empty() || vertices3f.empty()) {
-            outLods.push_back(std::move(srcIndices));
+        if (!optimizationSettings_.collectStats_ || optimizationStats_.empty()) {
             return;
         }
+        for (std::size_t i = 0; i < optimizationStats_.size(); ++i) {
+            const auto& s = optimizationStats_[i];
+            Logger::GetLogger()->debug("ModelLoader: mesh {} ({} tris): ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}, "
+                "overdraw {:.3f} -> {:.3f}, overfetch {:.3f} -> {:.3f}.",
+                i, s.triangleCount_, s.acmrBefore_, s.acmrAfter_, s.atvrBefore_, s.atvrAfter_,
+                s.overdrawBefore_, s.overdrawAfter_, s.overfetchBefore_, s.overfetchAfter_);
+        }
+        const MeshOptimizationStats total = SummarizeStats(optimizationStats_);
+        Logger::GetLogger()->info("ModelLoader: '{}' LOD0 optimization ({} tris, {:.1f} ms): ACMR {:.3f} -> {:.3f}, "
+            "ATVR {:.3f} -> {:.3f}, overdraw {:.3f} -> {:.3f}, overfetch {:.3f} -> {:.3f}.",
+            modelName, total.triangleCount_, total.milliseconds_, total.acmrBefore_, total.acmrAfter_,
+            total.atvrBefore_, total.atvrAfter_, total.overdrawBefore_, total.overdrawAfter_,
+            total.overfetchBefore_, total.overfetchAfter_);
+    }
 
-        const size_t vertexCount = vertices3f.size() / 3;
-        size_t currentIndexCount = srcIndices.size();
-
-        // LOD0: the original indices.
-        outLods.push_back(srcIndices);
-
-        size_t lodLevel = 1;
-        while (lodLevel < maxLODs_ && currentIndexCount > 1024) {
-            size_t targetCount = currentIndexCount / 2;
-            const auto& prevLOD = outLods.back();
-            std::vector<uint32_t> simplified(prevLOD);
-
-            // Simplify the mesh.
-            size_t numOpt = meshopt_simplify(
-                simplified.data(),
-                simplified.data(),
-                static_cast<uint32_t>(simplified.size()),
-                vertices3f.data(),
-                static_cast<uint32_t>(vertexCount),
-                sizeof(float) * 3,
-                targetCount,
-                0.02f
-            );
-
-            bool sloppy = false;
-            // If no significant improvement is achieved, try a “sloppy” simplification.
-            if (numOpt > simplified.size() * 0.9f) {
-                if (lodLevel > 1) {
-                    numOpt = meshopt_simplifySloppy(
-                        simplified.data(),
-                        simplified.data(),
-                        static_cast<uint32_t>(simplified.size()),
-                        vertices3f.data(),
-                        static_cast<uint32_t>(vertexCount),
-                        sizeof(float) * 3,
-                        targetCount,
-                        FLT_MAX,
-                        nullptr
-                    );
-                    sloppy = true;
-                    if (numOpt == simplified.size()) {
-                        Logger::GetLogger()->warn("LOD{}: no further simplification possible.", lodLevel);
-                        break;
-                    }
+    // ––– LogBoundsTightness –––
+    void ModelLoader::LogBoundsTightness(const std::string& modelName) const
+    {
+        // Compares the fitted volumes with the AABB and its circumscribed sphere (the old bound).
+        double boxSphereVolume = 0.0, sphereVolume = 0.0, aabbVolume = 0.0, obbVolume = 0.0;
+        for (const auto& obj : objects_) {
+            const auto& mesh = *obj.mesh_;
+            if (mesh.minBounds_.x > mesh.maxBounds_.x) {
+                continue;
+            }
+            const glm::vec3 size = mesh.maxBounds_ - mesh.minBounds_;
+            const graphics::BoundingSphere boxSphere{ glm::vec3(0.0f), 0.5f * glm::length(size) };
+            boxSphereVolume += boxSphere.Volume();
+            sphereVolume += graphics::BoundingSphere{ mesh.localCenter_, mesh.boundingSphereRadius_ }.Volume();
+            const double boxVolume = static_cast<double>(size.x) * size.y * size.z;
+            aabbVolume += boxVolume;
+            obbVolume += mesh.orientedBox_.IsValid() ? mesh.orientedBox_.Volume() : boxVolume;
+        }
+        if (boxSphereVolume <= 0.0) {
+            return;
+        }
+        Logger::GetLogger()->info("ModelLoader: '{}' bounds: fitted spheres are {:.1f}% of the AABB-diagonal sphere volume, "
+            "oriented boxes {:.1f}% of the AABB volume.",
+            modelName, 100.0 * sphereVolume / boxSphereVolume, aabbVolume > 0.0 ? 100.0 * obbVolume / aabbVolume : 100.0);
+    }
+
+    // ––– ComputeQuantizationParams –––
+    graphics::QuantizationParams ModelLoader::ComputeQuantizationParams(const SourceMesh& source,
+        const MeshLayout& meshLayout,
+        const glm::mat4& transform) const
+    {
+        glm::vec3 minPos(0.0f), maxPos(0.0f);
+        if (source.positions_ && source.vertexCount_ > 0) {
+            minPos = glm::vec3(FLT_MAX);
+            maxPos = glm::vec3(-FLT_MAX);
+            for (std::size_t v = 0; v < source.vertexCount_; v++) {
+                const glm::vec3 p(transform * glm::vec4(scaleFactor_ * source.positions_[v], 1.0f));
+                minPos = glm::min(minPos, p);
+                maxPos = glm::max(maxPos, p);
+            }
+        }
+        glm::vec2 minUV(0.0f), maxUV(0.0f);
+        const auto uvChannels = meshLayout.GetUVChannels();
+        bool hasUVs = false;
+        for (uint32_t c = 0; c < kMaxUVChannels; ++c) {
+            hasUVs = hasUVs || (uvChannels.test(c) && source.uvs_[c]);
+        }
+        if (hasUVs && source.vertexCount_ > 0) {
+            minUV = glm::vec2(FLT_MAX);
+            maxUV = glm::vec2(-FLT_MAX);
+            for (uint32_t c = 0; c < kMaxUVChannels; ++c) {
+                if (!uvChannels.test(c) || !source.uvs_[c]) {
+                    continue;
                 }
-                else {
-                    Logger::GetLogger()->warn("LOD{}: simplification not effective.", lodLevel);
-                    break;
+                for (std::size_t v = 0; v < source.vertexCount_; v++) {
+                    const glm::vec2 uv = source.uvs_[c][v];
+                    minUV = glm::min(minUV, uv);
+                    maxUV = glm::max(maxUV, uv);
                 }
             }
-            simplified.resize(numOpt);
-
-            // Optimize for vertex cache.
-            meshopt_optimizeVertexCache(
-                simplified.data(),
-                simplified.data(),
-                static_cast<uint32_t>(numOpt),
-                static_cast<uint32_t>(vertexCount)
-            );
-
-            currentIndexCount = numOpt;
-            outLods.push_back(std::move(simplified));
+        }
+        return graphics::quantization::MakeParams(minPos, maxPos, minUV, maxUV);
+    }
 
-            Logger::GetLogger()->info("LOD{} => {} indices {}", lodLevel, numOpt, sloppy ? "[sloppy]" : "");
-            lodLevel++;
+    // ––– FlattenPositions –––
+    std::vector<float> ModelLoader::FlattenPositions(const graphics::Mesh& mesh)
+    {
+        const std::size_t vertexCount = mesh.GetVertexCount();
+        std::vector<float> floatPositions;
+        floatPositions.reserve(vertexCount * 3);
+        for (std::size_t i = 0; i < vertexCount; ++i) {
+            const glm::vec3 pos = mesh.GetPosition(i);
+            floatPositions.push_back(pos.x);
+            floatPositions.push_back(pos.y);
+            floatPositions.push_back(pos.z);
         }
+        return floatPositions;
     }
 
     // ––– CenterMeshes –––
@@ -538,22 +1223,40 @@ namespace StaticLoader {
         }
         glm::vec3 sceneMin(FLT_MAX);
         glm::vec3 sceneMax(-FLT_MAX);
-        // Compute global bounding box.
+        // Compute global bounding box (instanced meshes contribute each instance's box corners).
         for (auto& obj : objects_) {
             auto& mesh = obj.mesh_;
-            sceneMin = glm::min(sceneMin, mesh->minBounds_);
-            sceneMax = glm::max(sceneMax, mesh->maxBounds_);
+            if (obj.instanceTransforms_.empty()) {
+                sceneMin = glm::min(sceneMin, mesh->minBounds_);
+                sceneMax = glm::max(sceneMax, mesh->maxBounds_);
+                continue;
+            }
+            for (const auto& instance : obj.instanceTransforms_) {
+                for (int corner = 0; corner < 8; ++corner) {
+                    const glm::vec3 local((corner & 1) ? mesh->maxBounds_.x : mesh->minBounds_.x,
+                        (corner & 2) ? mesh->maxBounds_.y : mesh->minBounds_.y,
+                        (corner & 4) ? mesh->maxBounds_.z : mesh->minBounds_.z);
+                    const glm::vec3 world(instance * glm::vec4(local, 1.0f));
+                    sceneMin = glm::min(sceneMin, world);
+                    sceneMax = glm::max(sceneMax, world);
+                }
+            }
         }
         glm::vec3 center = 0.5f * (sceneMin + sceneMax);
-        // Shift every mesh.
+        // Shift every mesh; instanced meshes stay in mesh space and their instances move instead.
+        const glm::mat4 shift = glm::translate(glm::mat4(1.0f), -center);
         for (auto& obj : objects_) {
-            auto& mesh = obj.mesh_;
-            for (auto& p : mesh->positions_) {
-                p -= center;
+            if (!obj.instanceTransforms_.empty()) {
+                for (auto& instance : obj.instanceTransforms_) {
+                    instance = shift * instance;
+                }
+                continue;
             }
+            auto& mesh = obj.mesh_;
+            mesh->Translate(-center);
             mesh->minBounds_ -= center;
             mesh->maxBounds_ -= center;
-            mesh->localCenter_ = 0.5f * (mesh->minBounds_ + mesh->maxBounds_);
+            mesh->localCenter_ -= center;
         }
     }
 
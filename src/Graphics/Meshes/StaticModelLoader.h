@@ -10,8 +10,16 @@
 #include <assimp/scene.h>
 
 #include "MeshInfo.h"
+#include "Graphics/Meshes/MeshCache.h"
 #include "Graphics/Meshes/Mesh.h"
 #include "Graphics/Meshes/MeshLayout.h"
+#include "Graphics/Meshes/MeshOptimizer.h"
+#include "Graphics/Meshes/MeshClusters.h"
+#include "Graphics/Meshes/LODPolicy.h"
+#include "Graphics/Meshes/MappedIOSystem.h"
+#include "Graphics/Meshes/ObjImporter.h"
+#include "Graphics/Meshes/GltfImporter.h"
+#include "Graphics/Meshes/SourceMesh.h"
 #include "Graphics/Materials/MaterialLayout.h"
 #include "Graphics/Materials/Material.h"
 #include "Graphics/Materials/MaterialParamType.h"
@@ -19,16 +27,26 @@
 
 namespace StaticLoader {
 
+    /// Timing of the material texture stage of one load (decode on workers, upload on the caller).
+    struct TextureLoadStats {
+        uint32_t textureCount_ = 0;         ///< Unique texture files decoded and uploaded.
+        uint32_t failedCount_ = 0;          ///< Files that could not be decoded.
+        double decodeMilliseconds_ = 0.0;   ///< Decode time summed over all threads.
+        double uploadMilliseconds_ = 0.0;   ///< GL upload time on the calling thread.
+        double wallMilliseconds_ = 0.0;     ///< Elapsed time of the whole stage.
+    };
+
     /**
-     * @brief Loads a model from disk (via Assimp) as a set of Mesh + Material pairs,
-     *        baking transforms, optionally centering geometry, and generating LODs.
+     * @brief Loads a model from disk (via Assimp, or GltfImporter for .gltf / .glb and, if enabled, ObjImporter for .obj files) as a set of Mesh + Material pairs,
+     *        baking transforms (or recording instances), optionally centering geometry,
+     *        and generating LODs.
      */
     class ModelLoader {
     public:
         /**
          * @param scaleFactor  Uniform scale applied to all vertices before baking the transform.
          * @param aiToMyType   Mapping from Assimp texture types to your engine’s texture types.
-         * @param maxLODs      Maximum number of LOD levels to generate (defaults to 5).
+         * @param maxLODs      Maximum number of LOD levels to generate (defaults to 5; see LODPolicy::maxLevels_).
          */
         ModelLoader(float scaleFactor = 1.0f,
             std::unordered_map<aiTextureType, TextureType> aiToMyType = {
@@ -49,6 +67,9 @@ namespace StaticLoader {
         /**
          * @brief Loads the specified model (by name), producing sub-meshes with baked transforms.
          *
+         * With an instanced @p meshLayout every aiMesh is processed once, in mesh space, and
+         * each scene node referencing it becomes an entry of MeshInfo::instanceTransforms_.
+         *
          * @param modelName   A key mapping to an actual file path (from an internal registry).
          * @param meshLayout  Which vertex attributes to load (positions, normals, etc.).
          * @param matLayout   Which material parameters and textures are relevant.
@@ -65,21 +86,148 @@ namespace StaticLoader {
          */
         const std::vector<graphics::MeshInfo>& GetLoadedObjects() const { return objects_; }
 
+        /// MaterialManager IDs created (or reused) by the last load; MeshInfo::materialIndex_ refers to these.
+        const std::vector<std::size_t>& GetMaterialIDs() const { return materialIDs_; }
+
+        /**
+         * @brief Enables/disables the binary mesh cache (enabled by default).
+         *
+         * When enabled, a warm start reads the processed meshes and material records
+         * straight from @p cacheDirectory and never touches Assimp or meshoptimizer.
+         */
+        void SetMeshCache(bool enabled, const std::filesystem::path& cacheDirectory = "../cache/meshes") {
+            useMeshCache_ = enabled;
+            cacheDirectory_ = cacheDirectory;
+        }
+
+        /**
+         * @brief Processes and simplifies sub-meshes, and decodes material textures, concurrently
+         *        on the shared work-stealing ThreadPool (enabled by default). Output order is
+         *        identical to the serial path; GL uploads always stay on the calling thread.
+         */
+        void SetParallelProcessing(bool enabled) { parallelProcessing_ = enabled; }
+
+        /**
+         * @brief Publishes meshes with LOD0 only and generates the coarse LODs on
+         *        background workers (see LODStreamer). Off by default.
+         */
+        void SetDeferredLODs(bool enabled) { deferLODs_ = enabled; }
+
+        /**
+         * @brief Stores vertices in one interleaved buffer per mesh (graphics::Mesh::packedVertices_),
+         *        written directly in the GPU order of the MeshLayout. Off by default.
+         */
+        void SetPackedVertices(bool enabled) { packedVertices_ = enabled; }
+
+        /**
+         * @brief Configures the meshoptimizer stage run on LOD0 of every imported mesh
+         *        (vertex cache, overdraw, vertex fetch; all enabled by default).
+         */
+        void SetOptimizationSettings(const MeshOptimizationSettings& settings) { optimizationSettings_ = settings; }
+
+        /**
+         * @brief Splits each LOD into meshlets with bounds and normal cones (off by default),
+         *        enabling per-cluster culling in renderer::Batch.
+         */
+        void SetClusterSettings(const MeshClusterSettings& settings) { clusterSettings_ = settings; }
+
+        /**
+         * @brief Configures error-bounded LOD generation (world-space error budgets per level,
+         *        attribute-aware simplification, minimum reduction per level).
+         */
+        void SetLODPolicy(const LODPolicy& policy) { lodPolicy_ = policy; }
+
+        /**
+         * @brief Selects the bounding volumes fitted to every mesh: sphere fit (EPOS by default),
+         *        PCA oriented boxes and per-LOD spheres (both on by default).
+         */
+        void SetBoundsSettings(const graphics::BoundsSettings& settings) { boundsSettings_ = settings; }
+        const LODPolicy& GetLODPolicy() const { return lodPolicy_; }
+
+        /**
+         * @brief Serves Assimp's file reads (model, MTL, external buffers) from memory-mapped
+         *        files through MappedIOSystem instead of buffered stdio (enabled by default).
+         */
+        void SetMappedIO(bool enabled) { mappedIO_ = enabled; }
+
+        /**
+         * @brief Imports .obj files with the native multithreaded ObjImporter instead of Assimp.
+         *        Assimp stays the fallback if the native import fails.
+         *
+         * Disabled by default: polygons are fan-triangulated and meshes of one material are not
+         * merged as aiProcess_OptimizeMeshes does, so the output can differ from Assimp's.
+         * ObjEquivalenceCheck (unittests/tools) compares both importers on a given file.
+         */
+        void SetNativeObjImport(bool enabled) { nativeObjImport_ = enabled; }
+
+        /**
+         * @brief Imports .gltf/.glb files with the native GltfImporter, which reads vertex
+         *        attributes in place from the mapped buffers (enabled by default). Assimp stays
+         *        the fallback for files it cannot handle (sparse accessors, embedded images...).
+         */
+        void SetNativeGltfImport(bool enabled) { nativeGltfImport_ = enabled; }
+
+        /**
+         * @brief Per-mesh before/after statistics of the last Assimp import (parallel to
+         *        GetLoadedObjects()). Empty when the model came from the mesh cache.
+         */
+        const std::vector<MeshOptimizationStats>& GetOptimizationStats() const { return optimizationStats_; }
+
+        /// Decode vs upload time of the textures referenced by the last loaded model.
+        const TextureLoadStats& GetTextureLoadStats() const { return textureLoadStats_; }
+
+        /// File I/O of the last Assimp import (zero when mapped I/O is off or the cache was hit).
+        const ImportIOStats& GetIOStats() const { return ioStats_; }
+
+        /// Pass timings of the last native OBJ import (zero when Assimp or the cache was used).
+        const ObjImportStats& GetObjImportStats() const { return objImportStats_; }
+
     private:
+        /// One mesh to process: an Assimp mesh, a native OBJ mesh or a glTF primitive, plus its placement.
+        struct MeshJob {
+            const aiMesh* aimesh_ = nullptr;
+            ObjMesh* objMesh_ = nullptr;
+            const SourceMesh* source_ = nullptr;        ///< glTF: copied per job (views only, plus indices).
+            glm::mat4 transform_ = glm::mat4(1.0f);
+            uint32_t materialSlot_ = 0;
+            std::vector<glm::mat4> instances_;
+        };
+
         // Configuration parameters.
         float scaleFactor_ = 1.0f;
         std::unordered_map<aiTextureType, TextureType> aiToMyType_;
-        uint8_t maxLODs_ = 8;
+        LODPolicy lodPolicy_;
+        graphics::BoundsSettings boundsSettings_;
 
         // Loaded objects and associated material IDs.
         std::vector<graphics::MeshInfo> objects_;
         std::vector<std::size_t> materialIDs_;
+        std::vector<MaterialRecord> materialRecords_;   ///< Parallel to materialIDs_.
+        std::vector<uint32_t> objectMaterialSlots_;     ///< Parallel to objects_, indexes materialRecords_.
+
+        // Binary mesh cache.
+        bool useMeshCache_ = true;
+        std::filesystem::path cacheDirectory_ = "../cache/meshes";
+
+        bool parallelProcessing_ = true;
+        bool deferLODs_ = false;
+        bool packedVertices_ = false;
+        bool mappedIO_ = true;
+        bool nativeObjImport_ = false;
+        bool nativeGltfImport_ = true;
+
+        MeshOptimizationSettings optimizationSettings_;
+        std::vector<MeshOptimizationStats> optimizationStats_;
+        MeshClusterSettings clusterSettings_;
+        TextureLoadStats textureLoadStats_;
+        ImportIOStats ioStats_;
+        ObjImportStats objImportStats_;
 
         int fallbackMaterialCounter_ = 0;
         int unnamedMaterialCounter_ = 0;
 
-        // Mapping from model name to file path (loaded from JSON config).
-        std::unordered_map<std::string, std::string> modelPaths_;
+        // Mapping from model name to file path (parsed once per config file and shared by all loaders).
+        std::shared_ptr<const std::unordered_map<std::string, std::string>> modelPaths_;
         std::filesystem::path configPath_;
 
         // Private helper functions.
@@ -87,27 +235,62 @@ namespace StaticLoader {
         std::string GetModelPath(const std::string& modelName) const;
         glm::mat4 AiToGlm(const aiMatrix4x4& m) const;
 
+        bool ImportObj(const std::string& filePath,
+            const MeshLayout& meshLayout,
+            const MaterialLayout& matLayout,
+            ObjModel& objModel,
+            std::vector<MeshJob>& jobs);
+        bool ImportGltf(const std::string& filePath,
+            const MeshLayout& meshLayout,
+            const MaterialLayout& matLayout,
+            GltfModel& gltfModel,
+            std::vector<MeshJob>& jobs);
+        /// Processes @p jobs into objects_ (in job order), then centers, caches or defers LODs.
+        void FinishLoad(const std::string& modelName,
+            std::vector<MeshJob>& jobs,
+            const MeshLayout& meshLayout,
+            bool centerModel,
+            std::optional<uint64_t> cacheKey);
+
         void LoadSceneMaterials(const aiScene* scene,
             const MaterialLayout& matLayout,
             const std::string& directory);
-        std::size_t CreateMaterialForAssimpMat(const aiMaterial* aiMat,
+        void CreateMaterials(const MaterialLayout& matLayout);   ///< materialRecords_ -> materialIDs_
+        SourceMaterial ReadAssimpMaterial(const aiMaterial* aiMat);
+        MaterialRecord ReadMaterialRecord(const SourceMaterial& source,
             const MaterialLayout& matLayout,
-            const std::string& directory);
-        void LoadMaterialProperties(const aiMaterial* aiMat,
-            const std::unique_ptr<graphics::Material>& mat,
-            const MaterialLayout& matLayout);
-        void LoadMaterialTextures(const aiMaterial* aiMat,
-            const std::unique_ptr<graphics::Material>& mat,
+            const std::string& directory) const;
+        void ReadMaterialProperties(const SourceMaterial& source,
             const MaterialLayout& matLayout,
-            const std::string& directory);
+            MaterialRecord& record) const;
+        void ReadMaterialTextures(const SourceMaterial& source,
+            const std::string& directory,
+            MaterialRecord& record) const;
+        void PreloadTextures(const std::vector<MaterialRecord>& records);
+        std::size_t CreateMaterialFromRecord(const MaterialRecord& record,
+            const MaterialLayout& matLayout) const;
 
-        std::shared_ptr<graphics::Mesh> ProcessAssimpMesh(const aiMesh* aimesh,
+        bool LoadFromCache(const std::string& modelName,
+            uint64_t cacheKey,
+            const MaterialLayout& matLayout);
+        void SaveToCache(const std::string& modelName, uint64_t cacheKey) const;
+        CachedModel MakeCachedModel() const;
+        void AttachGeometrySources(const std::string& modelName, std::optional<uint64_t> cacheKey) const;
+        void ScheduleDeferredLODs(const std::string& modelName, std::optional<uint64_t> cacheKey) const;
+        void LogOptimizationStats(const std::string& modelName) const;
+        void LogBoundsTightness(const std::string& modelName) const;
+
+        /// Bakes @p transform into the vertices, optimizes, builds LODs/clusters; consumes source.indices_.
+        std::shared_ptr<graphics::Mesh> ProcessSourceMesh(SourceMesh& source,
+            const MeshLayout& meshLayout,
+            const glm::mat4& transform,
+            MeshOptimizationStats& outStats) const;
+        /// Transformed position bounds and UV range of @p source, for quantized packed meshes.
+        graphics::QuantizationParams ComputeQuantizationParams(const SourceMesh& source,
             const MeshLayout& meshLayout,
-            const glm::mat4& transform);
+            const glm::mat4& transform) const;
 
-        void GenerateLODs(std::vector<uint32_t> srcIndices,
-            const std::vector<float>& vertices3f,
-            std::vector<std::vector<uint32_t>>& outLods) const;
+        static std::vector<float> FlattenPositions(const graphics::Mesh& mesh);
 
         void CenterMeshes();  ///< Shifts all loaded meshes so that the bounding box is centered at the origin.
         //std::unordered_map<aiTextureType, std::set<std::string>> allTextures_; //for debugging
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include "Graphics/Meshes/MeshLayout.h"
+
+namespace graphics {
+
+    /**
+     * @brief Byte layout of one interleaved vertex, derived from a MeshLayout.
+     *
+     * Attribute order matches the GPU layout built by renderer::Batch: position, normal,
+     * tangent, bitangent, then one UV set per distinct UV channel (ascending channel index).
+     * Offsets are kAbsent for attributes the layout does not contain.
+     *
+     * Quantized formats store positions as unorm16 x4 (w unused, keeps 4-byte alignment),
+     * normals/tangents/bitangents as octahedral snorm16 x2 and UVs as unorm16 x2; positions
+     * and UVs are relative to the mesh's QuantizationParams.
+     */
+    struct VertexFormat {
+        static constexpr int32_t kAbsent = -1;
+
+        uint32_t stride_ = 0;
+        int32_t positionOffset_ = kAbsent;
+        int32_t normalOffset_ = kAbsent;
+        int32_t tangentOffset_ = kAbsent;
+        int32_t bitangentOffset_ = kAbsent;
+        bool quantized_ = false;
+        std::array<int32_t, kMaxUVChannels> uvOffsets_;   ///< Indexed by UV channel.
+
+        VertexFormat() { uvOffsets_.fill(kAbsent); }
+
+        static VertexFormat FromLayout(const MeshLayout& layout) {
+            VertexFormat format;
+            format.quantized_ = layout.quantized_;
+            const uint32_t positionBytes = layout.quantized_ ? 4 * sizeof(uint16_t) : sizeof(glm::vec3);
+            const uint32_t directionBytes = layout.quantized_ ? 2 * sizeof(int16_t) : sizeof(glm::vec3);
+            const uint32_t uvBytes = layout.quantized_ ? 2 * sizeof(uint16_t) : sizeof(glm::vec2);
+            auto take = [&format](uint32_t bytes) {
+                const auto offset = static_cast<int32_t>(format.stride_);
+                format.stride_ += bytes;
+                return offset;
+                };
+            if (layout.hasPositions_)  format.positionOffset_ = take(positionBytes);
+            if (layout.hasNormals_)    format.normalOffset_ = take(directionBytes);
+            if (layout.hasTangents_)   format.tangentOffset_ = take(directionBytes);
+            if (layout.hasBitangents_) format.bitangentOffset_ = take(directionBytes);
+            const auto channels = layout.GetUVChannels();
+            for (std::size_t c = 0; c < kMaxUVChannels; ++c) {
+                if (channels.test(c)) {
+                    format.uvOffsets_[c] = take(uvBytes);
+                }
+            }
+            return format;
+        }
+
+        bool IsValid() const { return stride_ != 0; }
+        bool HasUV(uint32_t channel) const { return channel < kMaxUVChannels && uvOffsets_[channel] != kAbsent; }
+
+        bool operator==(const VertexFormat& other) const = default;
+    };
+
+} // namespace graphics
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <glm/glm.hpp>
+
+namespace graphics {
+
+    /**
+     * @brief Per-mesh ranges used to (de)quantize positions and UVs.
+     *
+     * Quantized positions/UVs are unorm16 in [0, 1]; value = offset + scale * unorm.
+     */
+    struct QuantizationParams {
+        glm::vec3 positionOffset_ = glm::vec3(0.0f);
+        glm::vec3 positionScale_ = glm::vec3(1.0f);
+        glm::vec2 uvOffset_ = glm::vec2(0.0f);
+        glm::vec2 uvScale_ = glm::vec2(1.0f);
+
+        bool operator==(const QuantizationParams& other) const = default;
+    };
+
+    /// GPU mirror of QuantizationParams (std430, see shaders/Common/Quantization.shader).
+    struct alignas(16) ObjectDequantData {
+        glm::vec4 positionOffset_;
+        glm::vec4 positionScale_;
+        glm::vec4 uvOffsetScale_;   ///< xy = offset, zw = scale
+    };
+
+    namespace quantization {
+
+        inline uint16_t EncodeUnorm16(float v) {
+            return static_cast<uint16_t>(std::lround(std::clamp(v, 0.0f, 1.0f) * 65535.0f));
+        }
+
+        inline float DecodeUnorm16(uint16_t v) {
+            return static_cast<float>(v) / 65535.0f;
+        }
+
+        inline int16_t EncodeSnorm16(float v) {
+            return static_cast<int16_t>(std::lround(std::clamp(v, -1.0f, 1.0f) * 32767.0f));
+        }
+
+        /// Matches GL's signed-normalized conversion: max(v / 32767, -1).
+        inline float DecodeSnorm16(int16_t v) {
+            return std::max(static_cast<float>(v) / 32767.0f, -1.0f);
+        }
+
+        /// Octahedral mapping of a unit vector to [-1, 1]^2.
+        inline glm::vec2 OctEncode(const glm::vec3& n) {
+            const float l1 = std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+            if (l1 <= 0.0f) {
+                return glm::vec2(0.0f, 0.0f);
+            }
+            glm::vec2 p = glm::vec2(n.x, n.y) / l1;
+            if (n.z < 0.0f) {
+                const glm::vec2 signs(p.x >= 0.0f ? 1.0f : -1.0f, p.y >= 0.0f ? 1.0f : -1.0f);
+                p = (glm::vec2(1.0f) - glm::vec2(std::abs(p.y), std::abs(p.x))) * signs;
+            }
+            return p;
+        }
+
+        inline glm::vec3 OctDecode(const glm::vec2& e) {
+            glm::vec3 n(e.x, e.y, 1.0f - std::abs(e.x) - std::abs(e.y));
+            const float t = std::max(-n.z, 0.0f);
+            n.x += n.x >= 0.0f ? -t : t;
+            n.y += n.y >= 0.0f ? -t : t;
+            const float len = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+            return len > 0.0f ? n / len : glm::vec3(0.0f, 0.0f, 1.0f);
+        }
+
+        inline uint16_t EncodeRange(float v, float offset, float scale) {
+            return EncodeUnorm16(scale != 0.0f ? (v - offset) / scale : 0.0f);
+        }
+
+        /// Builds params covering [minPos, maxPos] and [minUV, maxUV] (degenerate axes get scale 1).
+        inline QuantizationParams MakeParams(const glm::vec3& minPos, const glm::vec3& maxPos,
+            const glm::vec2& minUV, const glm::vec2& maxUV)
+        {
+            QuantizationParams q;
+            q.positionOffset_ = minPos;
+            q.positionScale_ = maxPos - minPos;
+            for (int i = 0; i < 3; ++i) {
+                if (!(q.positionScale_[i] > 0.0f)) q.positionScale_[i] = 1.0f;
+            }
+            q.uvOffset_ = minUV;
+            q.uvScale_ = maxUV - minUV;
+            for (int i = 0; i < 2; ++i) {
+                if (!(q.uvScale_[i] > 0.0f)) q.uvScale_[i] = 1.0f;
+            }
+            return q;
+        }
+
+        inline ObjectDequantData ToGpu(const QuantizationParams& q) {
+            return { glm::vec4(q.positionOffset_, 0.0f),
+                     glm::vec4(q.positionScale_, 0.0f),
+                     glm::vec4(q.uvOffset_, q.uvScale_) };
+        }
+
+    } // namespace quantization
+
+} // namespace graphics
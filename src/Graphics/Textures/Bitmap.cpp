@@ -52,7 +52,8 @@ namespace graphics {
     bool Bitmap::LoadFromFile(const std::string& filePath,
         bool flipY,
         bool force4Ch) {
-        stbi_set_flip_vertically_on_load(flipY ? 1 : 0);
+        // Thread-local flag: textures are decoded concurrently on worker threads.
+        stbi_set_flip_vertically_on_load_thread(flipY ? 1 : 0);
         const bool isHDR = (stbi_is_hdr(filePath.c_str()) != 0);
         const int desiredCh = force4Ch ? 4 : 0;
         int w = 0, h = 0, n = 0;
@@ -17,6 +17,7 @@ namespace graphics {
         uint32_t GetHeight() const override { return height_; }
         uint64_t GetBindlessHandle() const override { return bindless_handle_; }
         bool     IsBindless()        const override { return is_bindless_; }
+        bool     HasAlpha()          const override { return has_alpha_; }
 
     protected:
         void MakeBindlessIfNeeded(bool useBindless);
@@ -27,6 +28,7 @@ namespace graphics {
         uint32_t height_ = 0;
         uint64_t bindless_handle_ = 0;
         bool     is_bindless_ = false;
+        bool     has_alpha_ = false;
     };
 
 } // namespace graphics
\ No newline at end of file
@@ -12,6 +12,8 @@ namespace graphics {
         virtual uint32_t GetHeight() const = 0;
         virtual uint64_t GetBindlessHandle() const = 0;
         virtual bool IsBindless() const = 0;
+        /// True if some texels are transparent enough to be discarded by alpha testing.
+        virtual bool HasAlpha() const = 0;
     };
 
 } // namespace graphics
\ No newline at end of file
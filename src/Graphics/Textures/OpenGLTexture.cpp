@@ -3,12 +3,32 @@
 #include "Utilities/Utility.h"
 #include <stdexcept>
 #include <cmath>
+#include <cstddef>
 
 namespace graphics {
 
+    namespace {
+        // Alpha below the shaders' alpha-test threshold (0.1) in 8-bit units.
+        constexpr uint8_t kCutoutAlpha = 26;
+
+        bool HasCutoutTexels(const Bitmap& image) {
+            if (image.IsHDR() || image.components() != 4) {
+                return false;
+            }
+            const auto& data = image.data();
+            for (std::size_t i = 3; i < data.size(); i += 4) {
+                if (data[i] < kCutoutAlpha) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+
     OpenGLTexture::OpenGLTexture(const Bitmap& image, const TextureConfig& config) {
         width_ = static_cast<uint32_t>(image.width());
         height_ = static_cast<uint32_t>(image.height());
+        has_alpha_ = HasCutoutTexels(image);
 
         glCreateTextures(GL_TEXTURE_2D, 1, &texture_id_);
         if (!texture_id_) throw std::runtime_error("OpenGLTexture: Failed to create texture!");
@@ -16,6 +16,19 @@
 namespace graphics {
 
     std::shared_ptr<ITexture> TextureLoader::Load2DTexture(const std::string& filePath, const TextureConfig& config) {
+        Bitmap bitmap = Decode2DBitmap(filePath);
+        try {
+            auto texture = Create2DTexture(bitmap, config);
+            Logger::GetLogger()->info("Load2DTexture: Loaded texture from '{}'.", filePath);
+            return texture;
+        }
+        catch (const std::exception& e) {
+            Logger::GetLogger()->error("Load2DTexture: Exception creating texture from '{}': {}", filePath, e.what());
+            throw;
+        }
+    }
+
+    Bitmap TextureLoader::Decode2DBitmap(const std::string& filePath) {
         Bitmap bitmap;
         try {
             if (!bitmap.LoadFromFile(filePath, true, true) || bitmap.data().empty()) {
@@ -27,15 +40,11 @@ namespace graphics {
             Logger::GetLogger()->error("Load2DTexture: Exception loading '{}': {}", filePath, e.what());
             throw;
         }
-        try {
-            auto texture = std::make_shared<OpenGLTexture>(bitmap, config);
-            Logger::GetLogger()->info("Load2DTexture: Loaded texture from '{}'.", filePath);
-            return texture;
-        }
-        catch (const std::exception& e) {
-            Logger::GetLogger()->error("Load2DTexture: Exception creating texture from '{}': {}", filePath, e.what());
-            throw;
-        }
+        return bitmap;
+    }
+
+    std::shared_ptr<ITexture> TextureLoader::Create2DTexture(const Bitmap& bitmap, const TextureConfig& config) {
+        return std::make_shared<OpenGLTexture>(bitmap, config);
     }
 
     std::shared_ptr<ITexture> TextureLoader::LoadCubeMapTexture(const std::array<std::string, 6>& facePathsStr, const TextureConfig& config) {
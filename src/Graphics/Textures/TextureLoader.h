@@ -7,9 +7,15 @@
 
 namespace graphics {
 
+    class Bitmap;
+
     class TextureLoader {
     public:
         static std::shared_ptr<ITexture> Load2DTexture(const std::string& filePath, const TextureConfig& config);
+        /// Decodes an image file into RGBA (flipped for GL). CPU only, safe on worker threads.
+        static Bitmap Decode2DBitmap(const std::string& filePath);
+        /// Uploads a decoded image. Needs the GL context (main thread).
+        static std::shared_ptr<ITexture> Create2DTexture(const Bitmap& bitmap, const TextureConfig& config);
         static std::shared_ptr<ITexture> LoadCubeMapTexture(const std::array<std::string, 6>& facePaths, const TextureConfig& config);
         static std::shared_ptr<ITexture> LoadTextureArray(const std::string& filePath, const TextureConfig& config,
             uint32_t totalFrames, uint32_t gridX, uint32_t gridY);
@@ -160,6 +160,19 @@ namespace graphics {
         }
     }
 
+    std::shared_ptr<ITexture> TextureManager::Create2DTexture(const std::string& name, const Bitmap& bitmap, const TextureConfig& config) {
+        if (HasTexture(name)) return textures_[name];
+        try {
+            auto tex = TextureLoader::Create2DTexture(bitmap, config);
+            textures_[name] = tex;
+            return tex;
+        }
+        catch (const std::exception& e) {
+            Logger::GetLogger()->error("TextureManager: Exception creating 2D texture '{}': {}", name, e.what());
+            return nullptr;
+        }
+    }
+
     std::shared_ptr<ITexture> TextureManager::LoadCubeMapTexture(const std::string& name, const std::array<std::string, 6>& facePaths, const TextureConfig& config) {
         if (auto existing = GetTexture(name)) return existing;
         try {
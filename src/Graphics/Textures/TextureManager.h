@@ -17,8 +17,11 @@ namespace graphics {
         static TextureManager& GetInstance();
         bool LoadConfig(const std::filesystem::path& configPath);
         std::shared_ptr<ITexture> GetTexture(const std::string& name);
+        bool HasTexture(const std::string& name) const { return textures_.contains(name); }
 
         std::shared_ptr<ITexture> Load2DTexture(const std::string& name, const std::string& path, const TextureConfig& config);
+        /// Uploads an already decoded image (e.g. from a worker thread) and registers it under @p name.
+        std::shared_ptr<ITexture> Create2DTexture(const std::string& name, const Bitmap& bitmap, const TextureConfig& config);
         std::shared_ptr<ITexture> LoadCubeMapTexture(const std::string& name, const std::array<std::string, 6>& facePaths, const TextureConfig& config);
         std::shared_ptr<ITexture> LoadTextureArray(const std::string& name, const std::string& path, const TextureConfig& config, uint32_t totalFrames, uint32_t gridX, uint32_t gridY);
         std::shared_ptr<ITexture> CreateBRDFTexture(const std::string& name, int width, int height, unsigned int numSamples);
@@ -1,52 +1,226 @@
 ﻿#include "Batch.h"
 #include "Utilities/Logger.h"
 #include "Resources/ResourceManager.h"
+#include "Graphics/Materials/MaterialManager.h"
 #include <span>
 #include <numeric>
 #include <stdexcept>
 #include <algorithm> 
+#include <chrono>
+#include <limits>
 
-#include "Graphics/Buffers/VertexArray.h"
-#include "Graphics/Buffers/VertexBuffer.h"
-#include "Graphics/Buffers/IndexBuffer.h"
 #include "Graphics/Buffers/VertexBufferLayout.h"
 #include "Graphics/Buffers/IndirectBuffer.h"
+#include "Graphics/Buffers/ShaderStorageBuffer.h"
+#include "Scene/FrustumCuller.h"
 
 namespace renderer {
 
+    namespace {
+        std::vector<GLushort> NarrowIndices(const std::vector<GLuint>& indices) {
+            return std::vector<GLushort>(indices.begin(), indices.end());
+        }
+
+        // Clean commands between two dirty ones that are re-uploaded rather than split into two uploads.
+        constexpr size_t kMaxCommandMergeGap = 8;
+
+        // Initial capacity of the batch buffers: room for a quarter more before the first growth.
+        size_t WithHeadroom(size_t count) {
+            return std::max<size_t>(count + count / 4, 1);
+        }
+
+        template <typename T>
+        std::span<const std::byte> AsBytes(const T* data, size_t count) {
+            return { reinterpret_cast<const std::byte*>(data), count * sizeof(T) };
+        }
+
+        // Indices of every LOD of a mesh.
+        size_t LODIndexCount(const graphics::Mesh& mesh) {
+            size_t count = 0;
+            for (const auto& lod : mesh.lods_) {
+                count += lod.indexCount_;
+            }
+            return count;
+        }
+    }
+
     // ========================= Batch Public Methods =========================
 
-    Batch::Batch(const std::string& shaderName, int materialID)
+    Batch::Batch(const std::string& shaderName, int materialID, std::shared_ptr<GeometryArena> arena)
         : shaderName_(shaderName),
         materialID_(materialID),
+        arena_(arena ? std::move(arena) : std::make_shared<GeometryArena>()),
         isDirty_(true)
     {
         // Retrieve the mesh layout (and material layout if needed) from ResourceManager.
         auto [meshLayout, materialLayout] = ResourceManager::GetInstance().GetLayoutsFromShader(shaderName);
         meshLayout_ = meshLayout;
+        vertexFormat_ = graphics::VertexFormat::FromLayout(meshLayout_);
+
+        const auto& materials = graphics::MaterialManager::GetInstance().GetMaterials();
+        if (materialID >= 0 && static_cast<size_t>(materialID) < materials.size() && materials[materialID]) {
+            switch (materials[materialID]->GetAlphaMode()) {
+            case graphics::AlphaMode::Mask:  renderQueue_ = RenderQueue::AlphaTested; break;
+            case graphics::AlphaMode::Blend: renderQueue_ = RenderQueue::Blended; break;
+            default:                         renderQueue_ = RenderQueue::Opaque; break;
+            }
+        }
     }
 
-    Batch::~Batch() = default;
+    Batch::~Batch() {
+        ReleaseGeometry();
+    }
 
-    void Batch::AddRenderObject(const std::shared_ptr<BaseRenderObject>& renderObject) {
+    size_t Batch::AddRenderObject(const std::shared_ptr<BaseRenderObject>& renderObject) {
         if (!renderObject) {
             Logger::GetLogger()->error("Batch::AddRenderObject: received a null render object.");
-            return;
+            return kInvalidObject;
         }
         if (renderObject->GetMaterialID() != materialID_ || renderObject->GetMeshLayout() != meshLayout_) {
             Logger::GetLogger()->error("Batch::AddRenderObject: object and batch don't match.");
-            return;
+            return kInvalidObject;
+        }
+
+        size_t objectIndex = renderObjects_.size();
+        if (!freeObjectSlots_.empty()) {
+            objectIndex = freeObjectSlots_.back();
+            freeObjectSlots_.pop_back();
+            renderObjects_[objectIndex] = renderObject;
+        }
+        else {
+            renderObjects_.push_back(renderObject);
+        }
+        boundsDirty_ = true;
+
+        if (!IsUploaded()) {
+            isDirty_ = true; // The next BuildBatches() uploads it with the rest.
+            return objectIndex;
+        }
+
+        // Released meshes report no vertices until restored; restore before sizing anything.
+        if (!renderObject->GetMesh()->EnsureResident()) {
+            Logger::GetLogger()->error("Batch::AddRenderObject: could not restore the geometry of object {}.", objectIndex);
+        }
+
+        // A 16-bit batch cannot address a larger mesh: rebuild it with 32-bit indices.
+        if (indexType_ == GL_UNSIGNED_SHORT &&
+            static_cast<size_t>(renderObject->GetVertexCount()) > size_t{ std::numeric_limits<GLushort>::max() } + 1) {
+            isDirty_ = true;
+            BuildBatches();
+            return objectIndex;
+        }
+
+        if (objectIndex == drawCommands_.size()) {
+            // New objects take the last GPU slot; the next depth sort moves them into place.
+            commandOrder_.push_back(static_cast<uint32_t>(objectIndex));
+            commandSlot_.push_back(static_cast<uint32_t>(objectIndex));
+            drawCommands_.emplace_back();
+            lodInfos_.emplace_back();
+            objectRanges_.emplace_back();
+            if (vertexFormat_.quantized_) {
+                objectDequant_.emplace_back();
+            }
+        }
+        UploadObject(objectIndex);
+
+        Logger::GetLogger()->debug("Batch::AddRenderObject: uploaded object {} incrementally (shader='{}', matID={}).",
+            objectIndex, shaderName_, materialID_);
+        return objectIndex;
+    }
+
+    bool Batch::RemoveRenderObject(size_t objectIndex) {
+        if (objectIndex >= renderObjects_.size() || !renderObjects_[objectIndex]) {
+            Logger::GetLogger()->error("Batch::RemoveRenderObject: invalid objectIndex={}.", objectIndex);
+            return false;
+        }
+        renderObjects_[objectIndex].reset();
+        freeObjectSlots_.push_back(objectIndex);
+        boundsDirty_ = true;
+
+        if (!IsUploaded() || objectIndex >= drawCommands_.size()) {
+            isDirty_ = true; // Its ranges are released by the next BuildBatches().
+            return true;
         }
-        renderObjects_.push_back(renderObject);
+
+        auto& ranges = objectRanges_[objectIndex];
+        arena_->FreeVertices(formatId_, ranges.firstVertex_, ranges.vertexCount_);
+        for (const auto& [first, count] : ranges.indexRanges_) {
+            arena_->FreeIndices(first, count, indexType_);
+        }
+        ranges = {};
+        lodInfos_[objectIndex].clear();
+        if (meshLayout_.instanced_) {
+            deadInstances_ += drawCommands_[objectIndex].instanceCount_;
+        }
+        drawCommands_[objectIndex] = {};
+        StageCommand(objectIndex);
+        return true;
+    }
+
+    bool Batch::NeedsCompaction() const {
+        if (!IsUploaded()) {
+            return false;
+        }
+        // Freed geometry is already back in the arena; what stays behind are command slots and instances.
+        return freeObjectSlots_.size() > GetLiveObjectCount() / 2 ||
+            deadInstances_ > (instances_.size() - deadInstances_) / 2;
+    }
+
+    void Batch::Compact() {
+        const size_t emptySlots = freeObjectSlots_.size();
+        renderObjects_.erase(std::remove(renderObjects_.begin(), renderObjects_.end(), nullptr), renderObjects_.end());
+        freeObjectSlots_.clear();
         isDirty_ = true;
+        if (renderObjects_.empty()) {
+            return;
+        }
+
+        Logger::GetLogger()->info("Batch::Compact: reclaiming {} empty slot(s) and {} dead instances (shader='{}', matID={}).",
+            emptySlots, deadInstances_, shaderName_, materialID_);
+        BuildBatches();
     }
 
     const std::vector<std::shared_ptr<BaseRenderObject>>& Batch::GetRenderObjects() const {
         return renderObjects_;
     }
 
+    const graphics::BoundingSphere& Batch::GetBounds() const {
+        if (!boundsDirty_) {
+            return bounds_;
+        }
+        bounds_ = {};
+        bool first = true;
+        for (const auto& ro : renderObjects_) {
+            if (!ro) {
+                continue;
+            }
+            const glm::vec3 center = ro->GetCenter();
+            const float radius = ro->GetBoundingSphereRadius();
+            if (first) {
+                bounds_ = { center, radius };
+                first = false;
+                continue;
+            }
+            // Smallest sphere enclosing both spheres.
+            const glm::vec3 d = center - bounds_.center_;
+            const float dist = glm::length(d);
+            if (dist + radius <= bounds_.radius_) {
+                continue;
+            }
+            if (dist + bounds_.radius_ <= radius) {
+                bounds_ = { center, radius };
+                continue;
+            }
+            const float merged = 0.5f * (dist + radius + bounds_.radius_);
+            bounds_.center_ += d * ((merged - bounds_.radius_) / dist);
+            bounds_.radius_ = merged;
+        }
+        boundsDirty_ = false;
+        return bounds_;
+    }
+
     void Batch::BuildBatches() {
-        if (renderObjects_.empty()) {
+        if (GetLiveObjectCount() == 0) {
             Logger::GetLogger()->warn("Batch::BuildBatches: no RenderObjects in batch (shader='{}', matID={}).",
                 shaderName_, materialID_);
             return;
@@ -58,46 +232,145 @@ namespace renderer {
             return;
         }
 
+        const auto buildStart = std::chrono::steady_clock::now();
+        ReleaseGeometry();
+
+        // Released (compressed/evicted) meshes report no vertices: restore every live mesh
+        // before the totals and the index type are derived from the vertex counts.
+        for (size_t objectIndex = 0; objectIndex < renderObjects_.size(); ++objectIndex) {
+            const auto& ro = renderObjects_[objectIndex];
+            if (ro && ro->GetMesh() && !ro->GetMesh()->EnsureResident()) {
+                Logger::GetLogger()->error("Batch::BuildBatches: could not restore the geometry of object {}.", objectIndex);
+            }
+        }
+
         // 1) Build the vertex layout and compute totals.
         graphics::VertexBufferLayout vertexLayout;
         BatchGeometryTotals totals = BuildLayoutAndTotals(vertexLayout);
+        formatId_ = arena_->RegisterFormat(vertexFormat_, vertexLayout);
+
+        // Relative indices only need 16 bits when no single mesh exceeds 65536 vertices.
+        indexType_ = GL_UNSIGNED_INT;
+        if (compactIndices_) {
+            const bool fits = std::all_of(renderObjects_.begin(), renderObjects_.end(), [](const auto& ro) {
+                return !ro || static_cast<size_t>(ro->GetVertexCount()) <= size_t{ std::numeric_limits<GLushort>::max() } + 1;
+                });
+            indexType_ = fits ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+        }
 
-        // Reserve combined arrays.
-        std::vector<float> combinedVertexData;
-        combinedVertexData.reserve(totals.totalVertices_ * totals.vertexElementCount_);
+        // One arena range for all vertices and one for all indices; objects free their parts individually.
+        size_t paddedIndices = 0;
+        for (const auto& ro : renderObjects_) {
+            if (ro && ro->GetMesh()) {
+                paddedIndices += PaddedIndexCount(LODIndexCount(*ro->GetMesh()));
+            }
+        }
+        const size_t vertexBase = arena_->AllocateVertices(formatId_, static_cast<size_t>(totals.totalVertices_));
+        const size_t indexBase = arena_->AllocateIndices(paddedIndices, indexType_);
+
+        // Allocate combined arrays (vertices are written in place, interleaved).
+        std::vector<std::byte> combinedVertexData(static_cast<size_t>(totals.totalVertices_) * totals.vertexStride_);
         std::vector<GLuint> combinedIndices;
-        combinedIndices.reserve(totals.totalIndices_);
+        combinedIndices.reserve(paddedIndices);
         // Clear and reserve lod infos and draw commands.
         lodInfos_.clear();
         drawCommands_.clear();
+        objectRanges_.clear();
+        objectDequant_.clear();
+        instances_.clear();
+        deadInstances_ = 0;
         lodInfos_.reserve(renderObjects_.size());
         drawCommands_.reserve(renderObjects_.size());
 
         // 2) Combine geometry data (vertex attributes, indices, LOD info, draw commands).
-        GLuint baseVertex = 0;
-        CombineGeometryData(combinedVertexData, combinedIndices, lodInfos_, drawCommands_, baseVertex);
+        CombineGeometryData(combinedVertexData, combinedIndices, lodInfos_, drawCommands_, vertexBase, indexBase);
+        ResetCommandOrder();
 
-        // 3) Create and/or update the GPU buffers.
-        CreateGpuBuffers(vertexLayout, combinedVertexData, combinedIndices, drawCommands_);
+        // 3) Upload into the arena and create the per-batch GPU buffers.
+        CreateGpuBuffers(combinedVertexData, vertexBase, combinedIndices, indexBase, drawCommands_);
 
         isDirty_ = false;
+
+        const std::chrono::duration<double, std::milli> buildTime = std::chrono::steady_clock::now() - buildStart;
+        const size_t indexCount = combinedIndices.size();
+        const double savedKiB = static_cast<double>(indexCount * (sizeof(GLuint) - IndexSize())) / 1024.0;
+        Logger::GetLogger()->info("Batch::BuildBatches: {} object(s), {} vertices, {} {}-bit indices ({:.1f} KiB, saved {:.1f} KiB) "
+            "in {:.2f} ms (shader='{}', matID={}).",
+            GetLiveObjectCount(), totals.totalVertices_, indexCount, IndexSize() * 8,
+            static_cast<double>(indexCount * IndexSize()) / 1024.0, savedKiB, buildTime.count(), shaderName_, materialID_);
+    }
+
+    void Batch::BindGeometry() const {
+        if (drawCommandBuffer_) {
+            arena_->Bind(formatId_);
+        }
+    }
+
+    void Batch::Render(bool visibleOnly) {
+        if (!drawCommandBuffer_)
+            return;
+        BindGeometry();
+        Draw(visibleOnly);
+        arena_->Unbind();
     }
 
-    void Batch::Render() const {
+    void Batch::Draw(bool visibleOnly) {
         if (drawCommands_.empty() || !drawCommandBuffer_)
             return; // Nothing to draw
 
-        vao_->Bind();
-        drawCommandBuffer_->Bind();
+        FlushCommands();
+
+        const bool clustered = visibleOnly && useClusterCommands_ && clusterCommandRing_;
+        const size_t commandCount = clustered ? clusterCommands_.size() : drawCommands_.size();
+        if (commandCount == 0)
+            return; // Everything culled
+
+        if (dequantBuffer_) {
+            dequantBuffer_->Bind();
+        }
+        if (instanceBuffer_) {
+            instanceBuffer_->Bind();
+        }
+        // Cluster commands live in this frame's region of the ring; the indirect pointer is their offset.
+        const void* indirect = nullptr;
+        if (clustered) {
+            clusterCommandRing_->Bind(GL_DRAW_INDIRECT_BUFFER);
+            indirect = reinterpret_cast<const void*>(clusterCommandRange_.offset_);
+        }
+        else {
+            drawCommandBuffer_->Bind();
+        }
         glMultiDrawElementsIndirect(
             GL_TRIANGLES,
-            GL_UNSIGNED_INT,
-            nullptr,
-            static_cast<GLsizei>(drawCommands_.size()),
+            indexType_,
+            indirect,
+            static_cast<GLsizei>(commandCount),
             sizeof(DrawElementsIndirectCommand)
         );
         drawCommandBuffer_->Unbind();
-        vao_->Unbind();
+    }
+
+    void Batch::DrawObject(size_t objectIndex) {
+        if (!drawCommandBuffer_ || objectIndex >= drawCommands_.size())
+            return;
+        const auto& cmd = drawCommands_[objectIndex];
+        if (cmd.count_ == 0 || cmd.instanceCount_ == 0)
+            return; // Removed or culled
+        if (dequantBuffer_) {
+            dequantBuffer_->Bind();
+        }
+        if (instanceBuffer_) {
+            instanceBuffer_->Bind();
+        }
+        glDrawElementsInstancedBaseVertexBaseInstance(
+            GL_TRIANGLES,
+            static_cast<GLsizei>(cmd.count_),
+            indexType_,
+            reinterpret_cast<const void*>(static_cast<uintptr_t>(cmd.firstIndex_) * IndexSize()),
+            static_cast<GLsizei>(cmd.instanceCount_),
+            cmd.baseVertex_,
+            cmd.baseInstance_
+        );
     }
 
     void Batch::CullObject(size_t objectIndex) {
@@ -108,191 +381,544 @@ namespace renderer {
         auto& cmd = drawCommands_[objectIndex];
         if (cmd.count_ != 0) {
             cmd.count_ = 0;
-            std::span<const std::byte> cmdSpan(
-                reinterpret_cast<const std::byte*>(&cmd),
-                sizeof(DrawElementsIndirectCommand)
-            );
-            GLintptr offset = objectIndex * sizeof(DrawElementsIndirectCommand);
-            drawCommandBuffer_->UpdateData(cmdSpan, offset);
+            StageCommand(objectIndex);
         }
     }
 
     void Batch::UpdateLOD(size_t objectIndex, size_t newLOD) {
-        if (objectIndex >= renderObjects_.size() || objectIndex >= lodInfos_.size()) {
+        if (objectIndex >= renderObjects_.size() || objectIndex >= lodInfos_.size() || !renderObjects_[objectIndex]) {
             Logger::GetLogger()->error("Batch::UpdateLOD: invalid objectIndex={}.", objectIndex);
             return;
         }
         auto ro = renderObjects_[objectIndex];
-        if (!ro->SetLOD(newLOD))
+        if (!ro->SetLOD(newLOD) || lodInfos_[objectIndex].empty())
             return; // No change
 
-        size_t lodUsed = ro->GetCurrentLOD();
-        if (lodUsed >= lodInfos_[objectIndex].size())
-            lodUsed = 0;
+        // Clamp to the coarsest LOD that is resident in the IBO right now.
+        size_t lodUsed = std::min(ro->GetCurrentLOD(), lodInfos_[objectIndex].size() - 1);
         auto& lodRef = lodInfos_[objectIndex][lodUsed];
         auto& cmd = drawCommands_[objectIndex];
         cmd.count_ = static_cast<GLuint>(lodRef.indexCount_);
         cmd.firstIndex_ = static_cast<GLuint>(lodRef.indexOffsetInCombinedBuffer_);
+        StageCommand(objectIndex);
+    }
 
-        std::span<const std::byte> cmdSpan(
-            reinterpret_cast<const std::byte*>(&cmd),
-            sizeof(DrawElementsIndirectCommand)
-        );
-        GLintptr offset = objectIndex * sizeof(DrawElementsIndirectCommand);
-        drawCommandBuffer_->UpdateData(cmdSpan, offset);
+    void Batch::FlushCommands() {
+        if (!dirtyCommands_.Any() || !drawCommandBuffer_) {
+            return;
+        }
+        commandUploadStats_.commandsChanged_ += dirtyCommands_.Count();
+        commandUploadStats_.uploads_ += dirtyCommands_.Flush(kMaxCommandMergeGap, [this](size_t first, size_t count) {
+            GatherCommands(first, count, slotCommands_);
+            drawCommandBuffer_->UpdateData(AsBytes(slotCommands_.data(), count),
+                static_cast<GLintptr>(first * sizeof(DrawElementsIndirectCommand)));
+            commandUploadStats_.bytesUploaded_ += count * sizeof(DrawElementsIndirectCommand);
+            });
+    }
+
+    void Batch::SortCommandsByDepth(const glm::vec3& cameraPos) {
+        if (!IsUploaded() || commandOrder_.size() < 2) {
+            return;
+        }
+        // Empty slots sort to the back.
+        objectDepths_.resize(drawCommands_.size());
+        for (size_t objectIndex = 0; objectIndex < drawCommands_.size(); ++objectIndex) {
+            const auto& ro = renderObjects_[objectIndex];
+            const glm::vec3 d = ro ? ro->GetCenter() - cameraPos : glm::vec3(0.0f);
+            objectDepths_[objectIndex] = ro ? glm::dot(d, d) : std::numeric_limits<float>::max();
+        }
+        const auto closer = [this](uint32_t a, uint32_t b) { return objectDepths_[a] < objectDepths_[b]; };
+
+        if (!commandOrderSorted_) {
+            std::stable_sort(commandOrder_.begin(), commandOrder_.end(), closer);
+            for (size_t slot = 0; slot < commandOrder_.size(); ++slot) {
+                if (commandSlot_[commandOrder_[slot]] != slot) {
+                    commandSlot_[commandOrder_[slot]] = static_cast<uint32_t>(slot);
+                    StageCommand(commandOrder_[slot]);
+                }
+            }
+            commandOrderSorted_ = true;
+            return;
+        }
+
+        // Depths change little between frames: the previous order is nearly sorted.
+        for (size_t slot = 1; slot < commandOrder_.size(); ++slot) {
+            const uint32_t object = commandOrder_[slot];
+            size_t j = slot;
+            while (j > 0 && closer(object, commandOrder_[j - 1])) {
+                commandOrder_[j] = commandOrder_[j - 1];
+                commandSlot_[commandOrder_[j]] = static_cast<uint32_t>(j);
+                dirtyCommands_.Mark(j);
+                --j;
+            }
+            if (j != slot) {
+                commandOrder_[j] = object;
+                commandSlot_[object] = static_cast<uint32_t>(j);
+                dirtyCommands_.Mark(j);
+            }
+        }
+    }
+
+    void Batch::CullClusters(const FrustumCuller& culler, const glm::vec3& cameraPos) {
+        if (!clusterCommandRing_) {
+            return; // No object in this batch has clusters.
+        }
+
+        clusterCommands_.clear();
+        size_t testedClusters = 0;
+        for (const uint32_t objectIndex : commandOrder_) {   // Front to back, like the per-object commands.
+            const auto& objectCmd = drawCommands_[objectIndex];
+            const auto& ro = renderObjects_[objectIndex];
+            if (objectCmd.count_ == 0 || lodInfos_[objectIndex].empty() || !culler.IsObjectVisible(*ro)) {
+                continue;
+            }
+
+            const auto& mesh = ro->GetMesh();
+            const size_t lodUsed = std::min(ro->GetCurrentLOD(), lodInfos_[objectIndex].size() - 1);
+            const auto& lod = mesh->lods_[lodUsed];
+            // Instanced meshes keep the whole LOD: their cluster bounds are in mesh space.
+            if (lod.clusterCount_ == 0 || meshLayout_.instanced_) {
+                clusterCommands_.push_back(objectCmd);
+                continue;
+            }
+
+            // Cluster offsets are relative to the mesh; rebase them onto this LOD's combined range.
+            const size_t lodBase = lodInfos_[objectIndex][lodUsed].indexOffsetInCombinedBuffer_;
+            for (uint32_t c = lod.firstCluster_; c < lod.firstCluster_ + lod.clusterCount_; ++c) {
+                const auto& cluster = mesh->clusters_[c];
+                ++testedClusters;
+                if (glm::dot(glm::normalize(cluster.coneApex_ - cameraPos), cluster.coneAxis_) >= cluster.coneCutoff_) {
+                    continue; // Every triangle faces away from the camera.
+                }
+                if (!culler.IsSphereVisible(cluster.center_, cluster.radius_)) {
+                    continue;
+                }
+                DrawElementsIndirectCommand cmd = objectCmd;
+                cmd.count_ = cluster.indexCount_;
+                cmd.firstIndex_ = static_cast<GLuint>(lodBase + (cluster.indexOffset_ - lod.indexOffset_));
+                clusterCommands_.push_back(cmd);
+            }
+        }
+
+        if (!clusterCommands_.empty()) {
+            clusterCommandRange_ = clusterCommandRing_->Write(AsBytes(clusterCommands_.data(), clusterCommands_.size()),
+                alignof(DrawElementsIndirectCommand));
+        }
+        useClusterCommands_ = true;
+
+        Logger::GetLogger()->debug("Batch::CullClusters: {} command(s) from {} object(s), {} cluster(s) tested (shader='{}', matID={}).",
+            clusterCommands_.size(), drawCommands_.size(), testedClusters, shaderName_, materialID_);
+    }
+
+    void Batch::AppendLODs(const std::vector<size_t>& objectIndices) {
+        if (!IsUploaded()) {
+            return; // Not built yet; BuildBatches() will pick up every LOD.
+        }
+
+        size_t appended = 0;
+        for (size_t objectIndex : objectIndices) {
+            if (objectIndex >= renderObjects_.size() || objectIndex >= lodInfos_.size() || !renderObjects_[objectIndex]) {
+                Logger::GetLogger()->error("Batch::AppendLODs: invalid objectIndex={}.", objectIndex);
+                continue;
+            }
+            const auto& mesh = renderObjects_[objectIndex]->GetMesh();
+            auto& objectLODInfos = lodInfos_[objectIndex];
+            if (objectLODInfos.size() >= mesh->lods_.size() || !mesh->EnsureResident()) {
+                continue;
+            }
+
+            // The new LODs of one object share a single range, freed with the object.
+            size_t count = 0;
+            for (size_t l = objectLODInfos.size(); l < mesh->lods_.size(); ++l) {
+                count += mesh->lods_[l].indexCount_;
+            }
+            auto& ranges = objectRanges_[objectIndex];
+            const size_t firstIndex = arena_->AllocateIndices(count, indexType_);
+            const GLuint indexBias = compactIndices_ ? 0 : ranges.firstVertex_;
+            std::vector<GLuint> newIndices;
+            newIndices.reserve(count);
+            AppendLODIndices(*mesh, objectLODInfos.size(), indexBias, firstIndex, newIndices, objectLODInfos);
+            UploadIndices(newIndices, firstIndex);
+            ranges.indexRanges_.emplace_back(firstIndex, count);
+            appended += count;
+        }
+
+        if (appended > 0) {
+            Logger::GetLogger()->debug("Batch::AppendLODs: appended {} indices for {} object(s) (shader='{}', matID={}).",
+                appended, objectIndices.size(), shaderName_, materialID_);
+        }
     }
 
     // ========================= Helper Functions =========================
+
+    // Uploads one object added after the build into free ranges of the arena.
+    void Batch::UploadObject(size_t objectIndex) {
+        const auto& mesh = renderObjects_[objectIndex]->GetMesh();
+        if (!mesh->EnsureResident()) {
+            Logger::GetLogger()->error("Batch::UploadObject: could not restore the geometry of object {}.", objectIndex);
+        }
+        auto& ranges = objectRanges_[objectIndex];
+
+        // Vertices.
+        const size_t vCount = mesh->GetVertexCount();
+        ranges.firstVertex_ = static_cast<GLuint>(arena_->AllocateVertices(formatId_, vCount));
+        ranges.vertexCount_ = static_cast<GLuint>(vCount);
+        const graphics::QuantizationParams quantization =
+            vertexFormat_.quantized_ ? mesh->GetQuantizationParams() : graphics::QuantizationParams{};
+        if (vCount > 0) {
+            std::vector<std::byte> vertexData(vCount * vertexFormat_.stride_);
+            mesh->WriteInterleaved(vertexFormat_, vertexData.data(), quantization);
+            arena_->UploadVertices(formatId_, ranges.firstVertex_, vertexData);
+        }
+        if (vertexFormat_.quantized_) {
+            objectDequant_[objectIndex] = graphics::quantization::ToGpu(quantization);
+            UploadDequant(objectIndex);
+        }
+
+        // Every LOD in one index range.
+        const size_t indexCount = LODIndexCount(*mesh);
+        const size_t firstIndex = arena_->AllocateIndices(indexCount, indexType_);
+        std::vector<GLuint> indices;
+        indices.reserve(indexCount);
+        lodInfos_[objectIndex].clear();
+        AppendLODIndices(*mesh, 0, compactIndices_ ? 0 : ranges.firstVertex_, firstIndex, indices, lodInfos_[objectIndex]);
+        UploadIndices(indices, firstIndex);
+        ranges.indexRanges_.assign(1, { firstIndex, indexCount });
+
+        // Instances (appended; a removed object's instances stay dead until Compact()).
+        const auto [baseInstance, instanceCount] = AppendInstances(objectIndex);
+        if (meshLayout_.instanced_) {
+            UploadInstances(baseInstance);
+        }
+
+        drawCommands_[objectIndex] = MakeDrawCommand(objectIndex, baseInstance, instanceCount);
+        StageCommand(objectIndex);
+        EnsureClusterCommandCapacity();
+    }
+
+    // Appends the indices of mesh LODs [firstLOD, end) plus their LODInfo; indices[0] lands at firstIndex in the IBO.
+    void Batch::AppendLODIndices(const graphics::Mesh& mesh, size_t firstLOD, GLuint indexBias, size_t firstIndex,
+        std::vector<GLuint>& indices, std::vector<LODInfo>& lodInfos) const
+    {
+        const size_t start = indices.size();
+        for (size_t l = firstLOD; l < mesh.lods_.size(); ++l) {
+            const auto& lod = mesh.lods_[l];
+            LODInfo info;
+            info.indexOffsetInCombinedBuffer_ = firstIndex + (indices.size() - start);
+            info.indexCount_ = lod.indexCount_;
+            for (size_t idx = 0; idx < lod.indexCount_; ++idx) {
+                indices.push_back(mesh.indices_[lod.indexOffset_ + idx] + indexBias);
+            }
+            lodInfos.push_back(info);
+        }
+    }
+
+    // Instanced layouts: one transform per instance (identity for plain static objects).
+    // @return {baseInstance, instanceCount} for the object's draw command.
+    std::pair<GLuint, GLuint> Batch::AppendInstances(size_t objectIndex) {
+        if (!meshLayout_.instanced_) {
+            return { vertexFormat_.quantized_ ? static_cast<GLuint>(objectIndex) : 0u, 1u };
+        }
+        const auto baseInstance = static_cast<GLuint>(instances_.size());
+        const auto objectId = static_cast<GLuint>(objectIndex);
+        const auto instancedRO = std::dynamic_pointer_cast<InstancedRenderObject>(renderObjects_[objectIndex]);
+        if (instancedRO && instancedRO->GetInstanceCount() > 0) {
+            for (const auto& model : instancedRO->GetInstanceTransforms()) {
+                instances_.push_back({ model, glm::uvec4(objectId, 0u, 0u, 0u) });
+            }
+        }
+        else {
+            instances_.push_back({ glm::mat4(1.0f), glm::uvec4(objectId, 0u, 0u, 0u) });
+        }
+        return { baseInstance, static_cast<GLuint>(instances_.size()) - baseInstance };
+    }
+
+    // The indirect draw command of an object at its current (resident) LOD.
+    DrawElementsIndirectCommand Batch::MakeDrawCommand(size_t objectIndex, GLuint baseInstance, GLuint instanceCount) const {
+        const auto& objectLODInfos = lodInfos_[objectIndex];
+        DrawElementsIndirectCommand cmd{};
+        if (objectLODInfos.empty()) {
+            return cmd;
+        }
+        size_t lodUsed = renderObjects_[objectIndex]->GetCurrentLOD();
+        if (lodUsed >= objectLODInfos.size())
+            lodUsed = 0;
+        const auto& usedLOD = objectLODInfos[lodUsed];
+        cmd.count_ = static_cast<GLuint>(usedLOD.indexCount_);
+        cmd.instanceCount_ = instanceCount;
+        cmd.firstIndex_ = static_cast<GLuint>(usedLOD.indexOffsetInCombinedBuffer_);
+        cmd.baseVertex_ = compactIndices_ ? static_cast<GLint>(objectRanges_[objectIndex].firstVertex_) : 0;
+        cmd.baseInstance_ = baseInstance;
+        return cmd;
+    }
+
+    // Writes indices (already in this batch's index mode) starting at index firstIndex of the arena IBO.
+    void Batch::UploadIndices(const std::vector<GLuint>& indices, size_t firstIndex) {
+        if (indices.empty()) {
+            return;
+        }
+        if (indexType_ == GL_UNSIGNED_SHORT) {
+            const std::vector<GLushort> narrow = NarrowIndices(indices);
+            arena_->UploadIndices(firstIndex, indexType_, AsBytes(narrow.data(), narrow.size()));
+        }
+        else {
+            arena_->UploadIndices(firstIndex, indexType_, AsBytes(indices.data(), indices.size()));
+        }
+    }
+
+    // Returns every object's vertex and index ranges to the arena.
+    void Batch::ReleaseGeometry() {
+        for (const auto& ranges : objectRanges_) {
+            arena_->FreeVertices(formatId_, ranges.firstVertex_, ranges.vertexCount_);
+            for (const auto& [first, count] : ranges.indexRanges_) {
+                arena_->FreeIndices(first, count, indexType_);
+            }
+        }
+        objectRanges_.clear();
+    }
+
+    // Marks one draw command's GPU slot for the next FlushCommands(); commands beyond the buffer's
+    // capacity reallocate it with every command instead.
+    void Batch::StageCommand(size_t objectIndex) {
+        if (drawCommands_.size() <= commandCapacity_) {
+            dirtyCommands_.Mark(commandSlot_[objectIndex]);
+            return;
+        }
+        commandCapacity_ = WithHeadroom(drawCommands_.size());
+        std::vector<DrawElementsIndirectCommand> padded;
+        GatherCommands(0, drawCommands_.size(), padded);
+        padded.resize(commandCapacity_, DrawElementsIndirectCommand{});
+        drawCommandBuffer_ = std::make_unique<graphics::IndirectBuffer>(AsBytes(padded.data(), padded.size()), GL_DYNAMIC_DRAW);
+        dirtyCommands_.Reset(commandCapacity_);
+    }
+
+    // Identity slot order (object index == GPU slot), as CombineGeometryData lays the commands out.
+    void Batch::ResetCommandOrder() {
+        commandOrder_.resize(drawCommands_.size());
+        std::iota(commandOrder_.begin(), commandOrder_.end(), 0u);
+        commandSlot_ = commandOrder_;
+        commandOrderSorted_ = false;
+    }
+
+    // The commands of GPU slots [firstSlot, firstSlot + count), in slot order.
+    void Batch::GatherCommands(size_t firstSlot, size_t count, std::vector<DrawElementsIndirectCommand>& out) const {
+        out.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = drawCommands_[commandOrder_[firstSlot + i]];
+        }
+    }
+
+    // Uploads dequantization entries [firstObject, end), reallocating the SSBO when it is too small.
+    void Batch::UploadDequant(size_t firstObject) {
+        if (objectDequant_.size() > dequantCapacity_) {
+            dequantCapacity_ = WithHeadroom(objectDequant_.size());
+            dequantBuffer_ = std::make_unique<graphics::ShaderStorageBuffer>(kDequantBindingPoint,
+                static_cast<GLsizeiptr>(dequantCapacity_ * sizeof(graphics::ObjectDequantData)), GL_STATIC_DRAW);
+            firstObject = 0;
+        }
+        if (firstObject < objectDequant_.size()) {
+            dequantBuffer_->UpdateData(AsBytes(objectDequant_.data() + firstObject, objectDequant_.size() - firstObject),
+                static_cast<GLintptr>(firstObject * sizeof(graphics::ObjectDequantData)));
+        }
+    }
+
+    // Uploads instances [firstInstance, end), reallocating the SSBO when it is too small.
+    void Batch::UploadInstances(size_t firstInstance) {
+        if (instances_.size() > instanceCapacity_) {
+            instanceCapacity_ = WithHeadroom(instances_.size());
+            instanceBuffer_ = std::make_unique<graphics::ShaderStorageBuffer>(kInstanceBindingPoint,
+                static_cast<GLsizeiptr>(instanceCapacity_ * sizeof(InstanceData)), GL_STATIC_DRAW);
+            firstInstance = 0;
+        }
+        if (firstInstance < instances_.size()) {
+            instanceBuffer_->UpdateData(AsBytes(instances_.data() + firstInstance, instances_.size() - firstInstance),
+                static_cast<GLintptr>(firstInstance * sizeof(InstanceData)));
+        }
+    }
+
+    // Cluster command list: at most one command per cluster or per unclustered object.
+    void Batch::EnsureClusterCommandCapacity() {
+        size_t clusterCount = 0;
+        for (const auto& ro : renderObjects_) {
+            clusterCount += ro && ro->GetMesh() ? ro->GetMesh()->clusters_.size() : 0;
+        }
+        if (clusterCount == 0) {
+            return; // Objects without clusters are drawn from the per-object commands.
+        }
+        const size_t required = clusterCount + renderObjects_.size();
+        if (required <= clusterCommandCapacity_) {
+            return;
+        }
+        // Rewritten every frame: one ring region per frame in flight.
+        clusterCommandCapacity_ = clusterCommandRing_ ? WithHeadroom(required) : required;
+        clusterCommandRing_ = std::make_unique<graphics::PersistentRingBuffer>(
+            static_cast<GLsizeiptr>(clusterCommandCapacity_ * sizeof(DrawElementsIndirectCommand)));
+        clusterCommandRange_ = {};
+        clusterCommands_.clear();
+        clusterCommands_.reserve(clusterCommandCapacity_);
+        useClusterCommands_ = false;
+    }
+
     // Builds the vertex layout based on the mesh layout and computes totals.
     Batch::BatchGeometryTotals Batch::BuildLayoutAndTotals(graphics::VertexBufferLayout& vertexLayout) const {
         BatchGeometryTotals totals;
         GLuint attribIndex = 0;
-        if (meshLayout_.hasPositions_) {
-            vertexLayout.Push<float>(3, attribIndex++);
-            totals.vertexElementCount_ += 3;
-        }
-        if (meshLayout_.hasNormals_) {
-            vertexLayout.Push<float>(3, attribIndex++);
-            totals.vertexElementCount_ += 3;
-        }
-        if (meshLayout_.hasTangents_) {
-            vertexLayout.Push<float>(3, attribIndex++);
-            totals.vertexElementCount_ += 3;
-        }
-        if (meshLayout_.hasBitangents_) {
-            vertexLayout.Push<float>(3, attribIndex++);
-            totals.vertexElementCount_ += 3;
+        // One UV attribute per distinct channel, however many texture types sample it.
+        const auto uvChannels = meshLayout_.GetUVChannels();
+        if (meshLayout_.quantized_) {
+            // unorm16 positions/UVs and octahedral snorm16 directions (see graphics::VertexFormat).
+            if (meshLayout_.hasPositions_) {
+                vertexLayout.Push<GLushort>(4, attribIndex++);
+            }
+            if (meshLayout_.hasNormals_) {
+                vertexLayout.Push<GLshort>(2, attribIndex++);
+            }
+            if (meshLayout_.hasTangents_) {
+                vertexLayout.Push<GLshort>(2, attribIndex++);
+            }
+            if (meshLayout_.hasBitangents_) {
+                vertexLayout.Push<GLshort>(2, attribIndex++);
+            }
+            for (size_t c = 0; c < kMaxUVChannels; ++c) {
+                if (uvChannels.test(c)) {
+                    vertexLayout.Push<GLushort>(2, attribIndex++);
+                }
+            }
         }
-        for (size_t i = 0; i < meshLayout_.textureTypes_.size(); ++i) {
-            if (meshLayout_.textureTypes_.test(i)) {
-                vertexLayout.Push<float>(2, attribIndex++);
-                totals.vertexElementCount_ += 2;
+        else {
+            if (meshLayout_.hasPositions_) {
+                vertexLayout.Push<float>(3, attribIndex++);
+            }
+            if (meshLayout_.hasNormals_) {
+                vertexLayout.Push<float>(3, attribIndex++);
+            }
+            if (meshLayout_.hasTangents_) {
+                vertexLayout.Push<float>(3, attribIndex++);
+            }
+            if (meshLayout_.hasBitangents_) {
+                vertexLayout.Push<float>(3, attribIndex++);
+            }
+            for (size_t c = 0; c < kMaxUVChannels; ++c) {
+                if (uvChannels.test(c)) {
+                    vertexLayout.Push<float>(2, attribIndex++);
+                }
             }
         }
+        totals.vertexStride_ = vertexLayout.GetStride();
+        if (totals.vertexStride_ != vertexFormat_.stride_) {
+            throw std::logic_error("Batch: VertexBufferLayout and VertexFormat disagree on the vertex stride.");
+        }
         // Sum totals from each render object.
         for (const auto& ro : renderObjects_) {
+            if (!ro) {
+                continue;
+            }
             totals.totalVertices_ += ro->GetVertexCount();
-            totals.totalIndices_ += ro->GetIndexCount();
+            totals.totalIndices_ += ro->GetMesh() ? static_cast<int>(LODIndexCount(*ro->GetMesh())) : 0;
         }
         return totals;
     }
 
     // Combines vertex attributes, indices, LOD infos, and draw commands from all RenderObjects.
-    void Batch::CombineGeometryData(std::vector<float>& combinedVertexData,
+    // Removed (null) slots keep empty entries so object indices stay stable. The combined arrays
+    // are uploaded at vertexBase/indexBase in the arena, so ranges and commands are absolute.
+    void Batch::CombineGeometryData(std::vector<std::byte>& combinedVertexData,
         std::vector<GLuint>& combinedIndices,
         std::vector<std::vector<LODInfo>>& combinedLODInfos,
         std::vector<DrawElementsIndirectCommand>& combinedDrawCommands,
-        GLuint& baseVertex) const
+        size_t vertexBase, size_t indexBase)
     {
-        baseVertex = 0;
-        for (auto& ro : renderObjects_) {
-            auto mesh = ro->GetMesh();
-            if (!mesh) {
+        size_t vertexOffset = 0;
+        for (size_t objectIndex = 0; objectIndex < renderObjects_.size(); ++objectIndex) {
+            const auto& ro = renderObjects_[objectIndex];
+            auto mesh = ro ? ro->GetMesh() : nullptr;
+            if (ro && !mesh) {
                 Logger::GetLogger()->error("Batch::CombineGeometryData: RenderObject has no valid mesh.");
-                continue;
             }
-            const size_t vCount = mesh->positions_.size();
-
-            // Append vertex data per vertex.
-            for (size_t i = 0; i < vCount; ++i) {
-                if (meshLayout_.hasPositions_ && i < mesh->positions_.size()) {
-                    const auto& pos = mesh->positions_[i];
-                    combinedVertexData.push_back(pos.x);
-                    combinedVertexData.push_back(pos.y);
-                    combinedVertexData.push_back(pos.z);
-                }
-                if (meshLayout_.hasNormals_ && i < mesh->normals_.size()) {
-                    const auto& nor = mesh->normals_[i];
-                    combinedVertexData.push_back(nor.x);
-                    combinedVertexData.push_back(nor.y);
-                    combinedVertexData.push_back(nor.z);
-                }
-                if (meshLayout_.hasTangents_ && i < mesh->tangents_.size()) {
-                    const auto& tan = mesh->tangents_[i];
-                    combinedVertexData.push_back(tan.x);
-                    combinedVertexData.push_back(tan.y);
-                    combinedVertexData.push_back(tan.z);
-                }
-                // For each texture type.
-                for (size_t j = 0; j < meshLayout_.textureTypes_.size(); ++j) {
-                    if (meshLayout_.textureTypes_.test(j)) {
-                        TextureType texType = static_cast<TextureType>(j);
-                        auto uvIt = mesh->uvs_.find(texType);
-                        if (uvIt != mesh->uvs_.end() && i < uvIt->second.size()) {
-                            const auto& uv = uvIt->second[i];
-                            combinedVertexData.push_back(uv.x);
-                            combinedVertexData.push_back(uv.y);
-                        }
-                        else {
-                            combinedVertexData.push_back(0.f);
-                            combinedVertexData.push_back(0.f);
-                        }
-                    }
+            if (!mesh) {
+                combinedLODInfos.emplace_back();
+                objectRanges_.emplace_back();
+                if (vertexFormat_.quantized_) {
+                    objectDequant_.emplace_back();
                 }
+                combinedDrawCommands.push_back(DrawElementsIndirectCommand{});
+                continue;
+            }
+            if (!mesh->EnsureResident()) {
+                Logger::GetLogger()->error("Batch::CombineGeometryData: could not restore the geometry of object {}.", objectIndex);
+            }
+            const size_t vCount = mesh->GetVertexCount();
+
+            // Append vertex data (a memcpy for meshes already packed in this batch's format).
+            // Quantized batches keep each object's own ranges; shaders fetch them via gl_BaseInstance
+            // (or the instance's object index in instanced batches).
+            const graphics::QuantizationParams quantization =
+                vertexFormat_.quantized_ ? mesh->GetQuantizationParams() : graphics::QuantizationParams{};
+            mesh->WriteInterleaved(vertexFormat_,
+                combinedVertexData.data() + vertexOffset * vertexFormat_.stride_,
+                quantization);
+            if (vertexFormat_.quantized_) {
+                objectDequant_.push_back(graphics::quantization::ToGpu(quantization));
             }
 
-            // Build LOD info and index data for this render object.
+            // Build LOD info and index data for this render object
+            // (compact indices stay mesh-relative; the command's baseVertex_ offsets them).
+            const auto firstVertex = static_cast<GLuint>(vertexBase + vertexOffset);
+            const size_t start = combinedIndices.size();
+            const size_t firstIndex = indexBase + start;
             std::vector<LODInfo> objectLODInfos;
             objectLODInfos.reserve(mesh->lods_.size());
-            for (const auto& lod : mesh->lods_) {
-                LODInfo info;
-                info.indexOffsetInCombinedBuffer_ = combinedIndices.size();
-                info.indexCount_ = lod.indexCount_;
-                for (size_t idx = 0; idx < lod.indexCount_; ++idx) {
-                    GLuint oldIndex = mesh->indices_[lod.indexOffset_ + idx];
-                    combinedIndices.push_back(oldIndex + baseVertex);
-                }
-                objectLODInfos.push_back(info);
-            }
+            AppendLODIndices(*mesh, 0, compactIndices_ ? 0 : firstVertex, firstIndex, combinedIndices, objectLODInfos);
             combinedLODInfos.push_back(std::move(objectLODInfos));
+            objectRanges_.push_back({ firstVertex, static_cast<GLuint>(vCount),
+                { { firstIndex, combinedIndices.size() - start } } });
+            combinedIndices.resize(start + PaddedIndexCount(combinedIndices.size() - start), 0);
 
             // Create the indirect draw command for this object.
-            size_t lodUsed = ro->GetCurrentLOD();
-            if (lodUsed >= combinedLODInfos.back().size())
-                lodUsed = 0;
-            auto& usedLOD = combinedLODInfos.back()[lodUsed];
-            DrawElementsIndirectCommand cmd{};
-            cmd.count_ = static_cast<GLuint>(usedLOD.indexCount_);
-            cmd.instanceCount_ = 1;
-            cmd.firstIndex_ = static_cast<GLuint>(usedLOD.indexOffsetInCombinedBuffer_);
-            cmd.baseVertex_ = 0;
-            cmd.baseInstance_ = 0;
-            combinedDrawCommands.push_back(cmd);
-
-            baseVertex += static_cast<GLuint>(vCount);
-        }
-    }
-
-    // Creates or updates the GPU buffers (VBO, IBO, indirect command buffer) and updates the VAO.
-    void Batch::CreateGpuBuffers(const graphics::VertexBufferLayout& vertexLayout,
-        const std::vector<float>& vertexData,
-        const std::vector<GLuint>& indexData,
-        const std::vector<DrawElementsIndirectCommand>& drawCommands)
-    {
-        // Create vertex buffer.
-        std::span<const std::byte> vertexSpan(
-            reinterpret_cast<const std::byte*>(vertexData.data()),
-            vertexData.size() * sizeof(float)
-        );
-
-        vertexBuffer_ = std::make_unique<graphics::VertexBuffer>(vertexSpan, GL_STATIC_DRAW);
+            const auto [baseInstance, instanceCount] = AppendInstances(objectIndex);
+            combinedDrawCommands.push_back(MakeDrawCommand(objectIndex, baseInstance, instanceCount));
 
-        // Create index buffer.
-        std::span<const GLuint> indexSpan(indexData.data(), indexData.size());
-        indexBuffer_ = std::make_unique<graphics::IndexBuffer>(indexSpan, GL_STATIC_DRAW);
+            vertexOffset += vCount;
+        }
+    }
 
+    // Uploads the combined geometry into its arena ranges and creates the indirect command buffer
+    // (with headroom for incremental adds) and the per-object/per-instance SSBOs.
+    void Batch::CreateGpuBuffers(const std::vector<std::byte>& vertexData, size_t vertexBase,
+        const std::vector<GLuint>& indexData, size_t indexBase,
+        const std::vector<DrawElementsIndirectCommand>& drawCommands)
+    {
+        if (!vertexData.empty()) {
+            arena_->UploadVertices(formatId_, vertexBase, std::span<const std::byte>(vertexData.data(), vertexData.size()));
+        }
+        UploadIndices(indexData, indexBase);
 
         // Create indirect command buffer.
-        std::span<const std::byte> cmdSpan(
-            reinterpret_cast<const std::byte*>(drawCommands.data()),
-            drawCommands.size() * sizeof(DrawElementsIndirectCommand)
-        );
-
-        drawCommandBuffer_ = std::make_unique<graphics::IndirectBuffer>(cmdSpan, GL_DYNAMIC_DRAW);
+        commandCapacity_ = WithHeadroom(drawCommands.size());
+        std::vector<DrawElementsIndirectCommand> paddedCommands(commandCapacity_, DrawElementsIndirectCommand{});
+        std::copy(drawCommands.begin(), drawCommands.end(), paddedCommands.begin());
+        drawCommandBuffer_ = std::make_unique<graphics::IndirectBuffer>(
+            AsBytes(paddedCommands.data(), paddedCommands.size()), GL_DYNAMIC_DRAW);
+        dirtyCommands_.Reset(commandCapacity_);
+
+        clusterCommands_.clear();
+        clusterCommandRing_.reset();
+        useClusterCommands_ = false;
+        clusterCommandCapacity_ = 0;
+        EnsureClusterCommandCapacity();
+
+        // Per-object dequantization ranges for quantized layouts.
+        dequantBuffer_.reset();
+        dequantCapacity_ = 0;
+        if (!objectDequant_.empty()) {
+            UploadDequant(0);
+        }
 
-        vao_ = std::make_unique<graphics::VertexArray>();
-        vao_->AddBuffer(*vertexBuffer_, vertexLayout);
-        vao_->SetIndexBuffer(*indexBuffer_);
+        // Per-instance transforms for instanced layouts.
+        instanceBuffer_.reset();
+        instanceCapacity_ = 0;
+        if (!instances_.empty()) {
+            UploadInstances(0);
+        }
     }
-
 } // namespace renderer
\ No newline at end of file
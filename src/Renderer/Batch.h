@@ -7,14 +7,20 @@
 #include <cstddef>
 #include "Renderer/RenderObject.h"  
 #include "Graphics/Meshes/MeshLayout.h"
+#include "Graphics/Meshes/VertexFormat.h"
+#include "Graphics/Meshes/VertexQuantization.h"
+#include "Utilities/DirtyBitset.h"
+#include "Graphics/Buffers/PersistentRingBuffer.h"
+#include "Renderer/GeometryArena.h"
+#include "Renderer/DrawSortKey.h"
+
+class FrustumCuller;
 
 namespace graphics {
 
-    class VertexArray;
-    class VertexBuffer;
-    class IndexBuffer;
     class VertexBufferLayout;
     class IndirectBuffer;
+    class ShaderStorageBuffer;
 }
 
 namespace renderer {
@@ -31,7 +37,31 @@ namespace renderer {
     };
 
     /**
-     * @brief Info about one LOD range. Tracks the index offset and count within the combined IBO.
+     * @brief Per-instance data of instanced batches (std430, see shaders/Common/Instancing.shader).
+     */
+    struct alignas(16) InstanceData {
+        glm::mat4 model_;      ///< Mesh space -> world space.
+        glm::uvec4 info_;      ///< x = object index within the batch (indexes the dequantization table).
+    };
+
+    /**
+     * @brief Draw command upload counters (see Batch::FlushCommands), cumulative until reset.
+     */
+    struct CommandUploadStats {
+        size_t commandsChanged_ = 0;   ///< Distinct commands flushed (a command changed twice in a frame counts once).
+        size_t uploads_ = 0;           ///< glNamedBufferSubData calls issued for them.
+        size_t bytesUploaded_ = 0;
+
+        CommandUploadStats& operator+=(const CommandUploadStats& other) {
+            commandsChanged_ += other.commandsChanged_;
+            uploads_ += other.uploads_;
+            bytesUploaded_ += other.bytesUploaded_;
+            return *this;
+        }
+    };
+
+    /**
+     * @brief Info about one LOD range. Tracks the index offset and count within the arena IBO.
      */
     struct LODInfo {
         size_t indexOffsetInCombinedBuffer_ = 0;
@@ -41,25 +71,111 @@ namespace renderer {
     /**
      * @brief Batch groups multiple RenderObjects sharing the same shader and material.
      *
-     * It merges their vertex/index data into single GPU buffers (VBO, IBO, and an indirect draw buffer)
-     * and uses glMultiDrawElementsIndirect to issue a multi-draw call.
+     * Their vertex/index data lives in ranges of a GeometryArena shared with the other batches
+     * (one VBO and VAO per vertex format, one IBO for all), so commands carry absolute
+     * firstIndex_/baseVertex_ values; the batch owns its indirect draw buffer and issues
+     * one glMultiDrawElementsIndirect call. Batches of the same format can be drawn back to
+     * back with a single BindGeometry() (see Draw()).
+     *
+     * Batches with a quantized MeshLayout also upload one ObjectDequantData per object
+     * (SSBO at kDequantBindingPoint); each draw command's baseInstance_ is the object index.
+     *
+     * Batches with an instanced MeshLayout upload one InstanceData per instance (SSBO at
+     * kInstanceBindingPoint); each object's command draws instanceCount_ instances starting at
+     * baseInstance_, and objects without instances get a single identity transform.
+     *
+     * With compact indices (the default) indices stay relative to their mesh, each command
+     * carries the object's first vertex in baseVertex_, and the batch uses 16-bit indices
+     * when every mesh has at most 65536 vertices.
+     *
+     * After the first build, objects are added and removed incrementally: new objects take
+     * free vertex/index ranges from the arena and removed objects return theirs and leave an
+     * empty command slot that the next added object reuses. Object indices stay stable until
+     * Compact(), which rebuilds the batch from its live objects once empty slots or dead
+     * instances outweigh half of the live data (see NeedsCompaction()).
+     *
+     * Per-object command changes (culling, LOD switches, adds and removes) only edit the CPU
+     * copy in drawCommands_ and set a dirty bit; FlushCommands() uploads the dirty commands as
+     * a few merged ranges, once per frame before the batch is drawn.
+     *
+     * The GPU command buffer is ordered front to back rather than by object index:
+     * SortCommandsByDepth() keeps a slot permutation sorted by camera distance and re-uploads
+     * only the slots that moved, which is few while the camera moves smoothly.
      */
     class Batch {
     public:
-        Batch(const std::string& shaderName, int materialID);
+        /// SSBO binding of the per-object dequantization table (shaders/Common/Quantization.shader).
+        static constexpr GLuint kDequantBindingPoint = 2;
+        /// SSBO binding of the per-instance transforms (shaders/Common/Instancing.shader).
+        static constexpr GLuint kInstanceBindingPoint = 3;
+
+        /// @param arena Geometry storage shared with other batches; a private one is created if null.
+        Batch(const std::string& shaderName, int materialID, std::shared_ptr<GeometryArena> arena = nullptr);
         ~Batch();
 
-        /// @brief Adds a RenderObject to the batch.
-        void AddRenderObject(const std::shared_ptr<BaseRenderObject>& renderObject);
+        static constexpr size_t kInvalidObject = static_cast<size_t>(-1);
+
+        /**
+         * @brief Adds a RenderObject to the batch.
+         *
+         * Before the first build the object is only recorded; afterwards its geometry is
+         * uploaded right away into free space of the existing buffers.
+         * @return The object index (a reused slot if one is free), or kInvalidObject on error.
+         */
+        size_t AddRenderObject(const std::shared_ptr<BaseRenderObject>& renderObject);
 
-        /// @brief Returns the list of RenderObjects in the batch.
+        /// @brief Removes the object at @p objectIndex, freeing its GPU ranges; the slot stays empty until reused.
+        bool RemoveRenderObject(size_t objectIndex);
+
+        /// @brief Returns the RenderObjects in the batch, indexed by object index (removed slots are null).
         const std::vector<std::shared_ptr<BaseRenderObject>>& GetRenderObjects() const;
 
-        /// @brief Builds (or rebuilds) the combined GPU buffers (VBO, IBO, and IndirectBuffer).
+        /// @brief Number of non-empty object slots.
+        [[nodiscard]] size_t GetLiveObjectCount() const { return renderObjects_.size() - freeObjectSlots_.size(); }
+
+        /// @brief True once empty object slots or dead instances exceed half of the live objects/instances.
+        [[nodiscard]] bool NeedsCompaction() const;
+
+        /// @brief Drops empty slots and re-uploads the live objects (object indices change).
+        void Compact();
+
+        /// @brief Uploads every object into the arena and (re)creates the indirect command buffer.
         void BuildBatches();
 
-        /// @brief Issues the multi-draw call for the batch.
-        void Render() const;
+        /// @brief Mesh-relative (and, when they fit, 16-bit) indices; takes effect on the next build.
+        void SetCompactIndices(bool enabled) { compactIndices_ = enabled; isDirty_ = true; }
+
+        /// @brief Binds the arena VAO of this batch's vertex format (shared by every batch of that format).
+        void BindGeometry() const;
+
+        /**
+         * @brief Issues the multi-draw call for the batch; the geometry must already be bound.
+         * @param visibleOnly Use the cluster-culled command list when CullClusters() has built one;
+         *                    false draws every object (e.g. for shadow maps).
+         *
+         * Flushes pending command changes first.
+         */
+        void Draw(bool visibleOnly = true);
+
+        /// @brief BindGeometry(), Draw() and unbind, for callers drawing a single batch.
+        void Render(bool visibleOnly = true);
+
+        /// @brief Draws one object with its current command (LOD, culling); the geometry must already be bound.
+        void DrawObject(size_t objectIndex);
+
+        /// @brief Uploads the commands changed since the last flush, merging nearby ones into single uploads.
+        void FlushCommands();
+
+        /**
+         * @brief Orders the GPU commands front to back by the objects' distance to @p cameraPos.
+         *
+         * The first sort after a build is a full sort; later ones are insertion sorts over the
+         * previous order. Moved slots are uploaded by the next FlushCommands().
+         */
+        void SortCommandsByDepth(const glm::vec3& cameraPos);
+
+        [[nodiscard]] const CommandUploadStats& GetCommandUploadStats() const { return commandUploadStats_; }
+        void ResetCommandUploadStats() { commandUploadStats_ = {}; }
 
         /// @brief Sets the draw count of an object to zero (culls it).
         void CullObject(size_t objectIndex);
@@ -67,49 +183,146 @@ namespace renderer {
         /// @brief Updates the LOD for the specified object.
         void UpdateLOD(size_t objectIndex, size_t newLOD);
 
+        /**
+         * @brief Rebuilds the visible command list from the current per-object commands.
+         *
+         * Objects outside the frustum are dropped; objects whose current LOD has clusters
+         * emit one command per cluster passing the frustum and backface-cone tests, the
+         * rest keep their whole-LOD command. Cluster bounds are in mesh space, which is
+         * world space for static objects (transforms are baked by the loader). Instanced
+         * batches only get the object-level test.
+         */
+        void CullClusters(const FrustumCuller& culler, const glm::vec3& cameraPos);
+
+        /**
+         * @brief Uploads LODs that were added to the objects' meshes after BuildBatches().
+         *
+         * New index ranges are allocated in the arena's IBO (which grows on the GPU if needed)
+         * and the objects' lodInfos_ tables are extended; no vertex data is rebuilt.
+         */
+        void AppendLODs(const std::vector<size_t>& objectIndices);
+
         // Accessors.
         [[nodiscard]] const std::string& GetShaderName() const { return shaderName_; }
         [[nodiscard]] int GetMaterialID() const { return materialID_; }
         [[nodiscard]] const MeshLayout& GetMeshLayout() const { return meshLayout_; }
+        [[nodiscard]] bool HasClusters() const { return clusterCommandCapacity_ > 0; }
+        [[nodiscard]] size_t GetVisibleCommandCount() const { return clusterCommands_.size(); }
+        [[nodiscard]] size_t GetInstanceCount() const { return instances_.size(); }
+        [[nodiscard]] GLenum GetIndexType() const { return indexType_; }
+        [[nodiscard]] const std::shared_ptr<GeometryArena>& GetGeometryArena() const { return arena_; }
+        [[nodiscard]] GeometryArena::FormatId GetFormatId() const { return formatId_; }
+
+        /// @brief Queue of the batch's material (see graphics::AlphaMode), fixed at construction.
+        [[nodiscard]] RenderQueue GetRenderQueue() const { return renderQueue_; }
+
+        /// @brief Dense shader ID for draw sort keys, assigned by the BatchManager (see DrawSortKey).
+        void SetShaderSortId(uint32_t id) { shaderSortId_ = id; }
+        [[nodiscard]] uint32_t GetShaderSortId() const { return shaderSortId_; }
+
+        /// @brief Sphere enclosing the live objects' bounding spheres (recomputed after adds and removes).
+        [[nodiscard]] const graphics::BoundingSphere& GetBounds() const;
 
     private:
         // Helper types.
         struct BatchGeometryTotals {
             int totalVertices_ = 0;
             int totalIndices_ = 0;
-            int vertexElementCount_ = 0; // floats per vertex
+            GLuint vertexStride_ = 0; // bytes per vertex
+        };
+
+        // Where an object's geometry lives in the arena buffers.
+        struct ObjectRanges {
+            GLuint firstVertex_ = 0;
+            GLuint vertexCount_ = 0;
+            std::vector<std::pair<size_t, size_t>> indexRanges_;   ///< {first, count}: the initial LODs, then each AppendLODs.
         };
 
         // Helper functions.
         BatchGeometryTotals BuildLayoutAndTotals(graphics::VertexBufferLayout& vertexLayout) const;
-        void CombineGeometryData(std::vector<float>& combinedVertexData,
+        void CombineGeometryData(std::vector<std::byte>& combinedVertexData,
             std::vector<GLuint>& combinedIndices,
             std::vector<std::vector<LODInfo>>& combinedLODInfos,
             std::vector<DrawElementsIndirectCommand>& combinedDrawCommands,
-            GLuint& baseVertex) const;
-        void CreateGpuBuffers(const graphics::VertexBufferLayout& vertexLayout,
-            const std::vector<float>& vertexData,
-            const std::vector<GLuint>& indexData,
+            size_t vertexBase, size_t indexBase);
+        void CreateGpuBuffers(const std::vector<std::byte>& vertexData, size_t vertexBase,
+            const std::vector<GLuint>& indexData, size_t indexBase,
             const std::vector<DrawElementsIndirectCommand>& drawCommands);
+        void ReleaseGeometry();
+        void UploadObject(size_t objectIndex);
+        void AppendLODIndices(const graphics::Mesh& mesh, size_t firstLOD, GLuint indexBias, size_t firstIndex,
+            std::vector<GLuint>& indices, std::vector<LODInfo>& lodInfos) const;
+        std::pair<GLuint, GLuint> AppendInstances(size_t objectIndex);
+        DrawElementsIndirectCommand MakeDrawCommand(size_t objectIndex, GLuint baseInstance, GLuint instanceCount) const;
+        void UploadIndices(const std::vector<GLuint>& indices, size_t firstIndex);
+        void StageCommand(size_t objectIndex);
+        void ResetCommandOrder();
+        void GatherCommands(size_t firstSlot, size_t count, std::vector<DrawElementsIndirectCommand>& out) const;
+        void UploadDequant(size_t firstObject);
+        void UploadInstances(size_t firstInstance);
+        void EnsureClusterCommandCapacity();
+        [[nodiscard]] size_t IndexSize() const { return indexType_ == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint); }
+        // 16-bit objects are padded to an even index count so the next one starts on an arena word.
+        [[nodiscard]] size_t PaddedIndexCount(size_t count) const { return indexType_ == GL_UNSIGNED_SHORT ? (count + 1) & ~size_t{ 1 } : count; }
+        [[nodiscard]] bool IsUploaded() const { return drawCommandBuffer_ && !isDirty_; }
 
     private:
         std::string shaderName_;
         int materialID_;
         MeshLayout meshLayout_;
+        graphics::VertexFormat vertexFormat_;
 
         // List of RenderObjects in the batch.
         std::vector<std::shared_ptr<BaseRenderObject>> renderObjects_;
 
-        // GPU buffers for combined geometry.
-        std::unique_ptr<graphics::VertexArray> vao_;
-        std::unique_ptr<graphics::VertexBuffer> vertexBuffer_;   // maybe won't store them after all
-        std::unique_ptr<graphics::IndexBuffer> indexBuffer_;
+        // Vertex/index storage shared with other batches, and this batch's pool in it.
+        std::shared_ptr<GeometryArena> arena_;
+        GeometryArena::FormatId formatId_ = 0;
+        uint32_t shaderSortId_ = 0;
+        RenderQueue renderQueue_ = RenderQueue::Opaque;
+        // Cached by GetBounds().
+        mutable graphics::BoundingSphere bounds_;
+        mutable bool boundsDirty_ = true;
         std::unique_ptr<graphics::IndirectBuffer> drawCommandBuffer_;
+        std::unique_ptr<graphics::ShaderStorageBuffer> dequantBuffer_;
+        std::unique_ptr<graphics::ShaderStorageBuffer> instanceBuffer_;
 
-        // One draw command per object.
+        // One draw command per object (CPU shadow of drawCommandBuffer_) and the ones not uploaded yet.
         std::vector<DrawElementsIndirectCommand> drawCommands_;
+        DirtyBitset dirtyCommands_;       // Indexed by GPU slot.
+        CommandUploadStats commandUploadStats_;
+        // GPU slot -> object and object -> GPU slot (front to back after SortCommandsByDepth()).
+        std::vector<uint32_t> commandOrder_;
+        std::vector<uint32_t> commandSlot_;
+        bool commandOrderSorted_ = false;
+        // Scratch for SortCommandsByDepth() and FlushCommands().
+        std::vector<float> objectDepths_;
+        std::vector<DrawElementsIndirectCommand> slotCommands_;
         // For each object, an array of LODInfo.
         std::vector<std::vector<LODInfo>> lodInfos_;
+        // For each object, its vertex and index ranges in the arena (returned by RemoveRenderObject/ReleaseGeometry).
+        std::vector<ObjectRanges> objectRanges_;
+        // Empty object slots (removed objects), reused by AddRenderObject.
+        std::vector<size_t> freeObjectSlots_;
+        // Entries allocated in the command, dequantization and instance buffers.
+        size_t commandCapacity_ = 0;
+        size_t dequantCapacity_ = 0;
+        size_t instanceCapacity_ = 0;
+        // Instances of removed objects still occupying instances_ (reclaimed by Compact()).
+        size_t deadInstances_ = 0;
+        // Cluster-culled commands (rebuilt by CullClusters every frame), their ring buffer and this frame's range.
+        std::vector<DrawElementsIndirectCommand> clusterCommands_;
+        std::unique_ptr<graphics::PersistentRingBuffer> clusterCommandRing_;
+        graphics::PersistentRingBuffer::Range clusterCommandRange_;
+        size_t clusterCommandCapacity_ = 0;
+        bool useClusterCommands_ = false;
+        // For each object, its dequantization ranges (quantized layouts only).
+        std::vector<graphics::ObjectDequantData> objectDequant_;
+        // Every object's instances, contiguous per object (instanced layouts only).
+        std::vector<InstanceData> instances_;
+        // Index mode: relative indices + baseVertex_, narrowed to 16 bits when every mesh fits.
+        bool compactIndices_ = true;
+        GLenum indexType_ = GL_UNSIGNED_INT;
 
         // Flag indicating whether the batch data needs rebuilding.
         bool isDirty_ = true;
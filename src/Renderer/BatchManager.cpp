@@ -5,16 +5,115 @@
 #include "Scene/Camera.h"
 #include "Utilities/Logger.h"
 #include <algorithm>
+#include <unordered_set>
+
+namespace {
+    // Counts the state a draw of @p batch changes after @p previous, the way GeometryPass binds it.
+    void CountStateChange(renderer::StateChangeStats& stats, const renderer::Batch*& previous, const renderer::Batch& batch) {
+        ++stats.draws_;
+        const bool shaderChanged = !previous || previous->GetShaderName() != batch.GetShaderName();
+        stats.shaderSwitches_ += shaderChanged;
+        stats.materialSwitches_ += shaderChanged || previous->GetMaterialID() != batch.GetMaterialID();
+        stats.vaoSwitches_ += !previous || previous->GetGeometryArena() != batch.GetGeometryArena() ||
+            previous->GetFormatId() != batch.GetFormatId();
+        previous = &batch;
+    }
+
+    // Batches drawn whole by GeometryPass (the blended queue is drawn per object).
+    renderer::StateChangeStats CountBatchStateChanges(const std::vector<std::shared_ptr<renderer::Batch>>& order) {
+        renderer::StateChangeStats stats;
+        const renderer::Batch* previous = nullptr;
+        for (const auto& batch : order) {
+            if (batch->GetLiveObjectCount() > 0 && batch->GetRenderQueue() != renderer::RenderQueue::Blended) {
+                CountStateChange(stats, previous, *batch);
+            }
+        }
+        return stats;
+    }
+}
 
 void BatchManager::AddRenderObject(const std::shared_ptr<BaseRenderObject>& ro) {
     renderObjects_.push_back(ro);
-    built_ = false;
+    if (!built_) {
+        return; // The next BuildBatches() groups it with the rest.
+    }
+
+    auto batch = FindBatch(ro->GetShaderName(), ro->GetMaterialID());
+    const bool newBatch = !batch;
+    if (newBatch) {
+        batch = MakeBatch(ro->GetShaderName(), ro->GetMaterialID());
+    }
+    const size_t objectIndex = batch->AddRenderObject(ro);
+    if (objectIndex == renderer::Batch::kInvalidObject) {
+        renderObjects_.pop_back();
+        return;
+    }
+    if (newBatch) {
+        batch->BuildBatches();
+        // Insert after the last batch of the same format so the format groups stay adjacent;
+        // the batches behind it shift by one.
+        const auto insertIt = std::upper_bound(batches_.begin(), batches_.end(), batch->GetFormatId(),
+            [](renderer::GeometryArena::FormatId formatId, const auto& other) { return formatId < other->GetFormatId(); });
+        const auto insertIndex = static_cast<size_t>(insertIt - batches_.begin());
+        batches_.insert(insertIt, batch);
+        for (size_t b = insertIndex; b < batches_.size(); ++b) {
+            AssignHandles(b);
+        }
+        drawOrder_.clear();
+    }
+    const auto batchIndex = static_cast<size_t>(
+        std::find(batches_.begin(), batches_.end(), batch) - batches_.begin());
+    ro->SetBatchHandle({ static_cast<uint32_t>(batchIndex), static_cast<uint32_t>(objectIndex) });
+    residencyApplied_ = false;
+    blendedDrawsDirty_ = true;
+}
+
+bool BatchManager::RemoveRenderObject(const std::shared_ptr<BaseRenderObject>& ro) {
+    auto objectIt = std::find(renderObjects_.begin(), renderObjects_.end(), ro);
+    if (objectIt == renderObjects_.end())
+        return false;
+    renderObjects_.erase(objectIt);
+
+    auto batch = FindBatchForObject(ro);
+    const BatchHandle handle = ro->GetBatchHandle();
+    ro->SetBatchHandle({});
+    if (!batch)
+        return true;
+    batch->RemoveRenderObject(handle.commandIndex_);
+    blendedDrawsDirty_ = true;
+    if (batch->GetLiveObjectCount() == 0) {
+        // Erase in place to keep the format groups adjacent; the later batches shift down.
+        batches_.erase(batches_.begin() + static_cast<std::ptrdiff_t>(handle.batchIndex_));
+        drawOrder_.clear();
+        for (size_t b = handle.batchIndex_; b < batches_.size(); ++b) {
+            AssignHandles(b);
+        }
+    }
+    return true;
+}
+
+void BatchManager::CompactBatches() {
+    if (!built_)
+        return;
+    for (size_t b = 0; b < batches_.size(); ++b) {
+        if (batches_[b]->NeedsCompaction()) {
+            batches_[b]->Compact();
+            AssignHandles(b);
+            residencyApplied_ = false;
+            blendedDrawsDirty_ = true;
+        }
+    }
 }
 
 void BatchManager::Clear() {
+    for (auto& ro : renderObjects_) {
+        ro->SetBatchHandle({});
+    }
     renderObjects_.clear();
     batches_.clear();
-    objToBatch_.clear();
+    drawOrder_.clear();
+    blendedDraws_.clear();
+    blendedDrawsDirty_ = true;
     built_ = false;
 }
 
@@ -27,13 +126,25 @@ void BatchManager::BuildBatches() {
         return;
     }
     batches_.clear();
-    objToBatch_.clear();
+    drawOrder_.clear();
+    blendedDrawsDirty_ = true;
+    residencyApplied_ = false;
 
     if (!renderObjects_.empty()) {
         auto builtBatches = BuildBatchesFromObjects(renderObjects_);
         batches_.insert(batches_.end(), builtBatches.begin(), builtBatches.end());
     }
+    // Batches of one vertex format share a VAO: keep them adjacent so passes bind it once.
+    std::stable_sort(batches_.begin(), batches_.end(), [](const auto& a, const auto& b) {
+        return a->GetFormatId() < b->GetFormatId();
+        });
+    for (size_t b = 0; b < batches_.size(); ++b) {
+        AssignHandles(b);
+    }
     built_ = true;
+    if (!batches_.empty()) {
+        geometryArena_->LogStats();
+    }
 }
 
 std::vector<std::shared_ptr<renderer::Batch>> BatchManager::BuildBatchesFromObjects(
@@ -51,10 +162,9 @@ std::vector<std::shared_ptr<renderer::Batch>> BatchManager::BuildBatchesFromObje
     std::vector<std::shared_ptr<renderer::Batch>> result;
     for (auto& [shaderName, matMap] : grouping) {
         for (auto& [matID, objVec] : matMap) {
-            auto batch = std::make_shared<renderer::Batch>(shaderName, matID);
+            auto batch = MakeBatch(shaderName, matID);
             for (auto& ro : objVec) {
                 batch->AddRenderObject(ro);
-                objToBatch_[ro.get()] = batch;
             }
             batch->BuildBatches();
             result.push_back(batch);
@@ -63,34 +173,145 @@ std::vector<std::shared_ptr<renderer::Batch>> BatchManager::BuildBatchesFromObje
     return result;
 }
 
+void BatchManager::AssignHandles(size_t batchIndex) {
+    const auto& ros = batches_[batchIndex]->GetRenderObjects();
+    for (size_t i = 0; i < ros.size(); i++) {
+        if (ros[i]) {
+            ros[i]->SetBatchHandle({ static_cast<uint32_t>(batchIndex), static_cast<uint32_t>(i) });
+        }
+    }
+}
+
 std::shared_ptr<renderer::Batch> BatchManager::FindBatchForObject(const std::shared_ptr<BaseRenderObject>& ro) const {
-    auto it = objToBatch_.find(ro.get());
-    return (it != objToBatch_.end()) ? it->second : nullptr;
+    // The handle is only trusted if it still points back at this object (it may belong to another manager).
+    const BatchHandle& handle = ro->GetBatchHandle();
+    if (!handle.IsValid() || handle.batchIndex_ >= batches_.size())
+        return nullptr;
+    const auto& batch = batches_[handle.batchIndex_];
+    const auto& ros = batch->GetRenderObjects();
+    if (handle.commandIndex_ >= ros.size() || ros[handle.commandIndex_] != ro)
+        return nullptr;
+    return batch;
+}
+
+std::shared_ptr<renderer::Batch> BatchManager::FindBatch(const std::string& shaderName, int materialID) const {
+    auto it = std::find_if(batches_.begin(), batches_.end(), [&](const auto& batch) {
+        return batch->GetShaderName() == shaderName && batch->GetMaterialID() == materialID;
+        });
+    return (it != batches_.end()) ? *it : nullptr;
+}
+
+std::shared_ptr<renderer::Batch> BatchManager::MakeBatch(const std::string& shaderName, int materialID) {
+    auto batch = std::make_shared<renderer::Batch>(shaderName, materialID, geometryArena_);
+    batch->SetCompactIndices(compactIndices_);
+    const auto [it, inserted] = shaderSortIds_.try_emplace(shaderName, static_cast<uint32_t>(shaderSortIds_.size()));
+    batch->SetShaderSortId(it->second);
+    return batch;
+}
+
+void BatchManager::SortBatches(const glm::vec3& cameraPos, float farPlane) {
+    if (!built_)
+        return;
+    sortEntries_.clear();
+    sortEntries_.reserve(batches_.size());
+    for (size_t b = 0; b < batches_.size(); ++b) {
+        const auto& batch = batches_[b];
+        // Every batch has its own shader/material pair, so the key's depth field only orders
+        // batches; front to back within a batch is the command order.
+        if (batch->GetRenderQueue() != renderer::RenderQueue::Blended) {
+            batch->SortCommandsByDepth(cameraPos);
+        }
+        const auto& bounds = batch->GetBounds();
+        const float distance = std::max(glm::distance(cameraPos, bounds.center_) - bounds.radius_, 0.0f);
+        const uint64_t key = renderer::DrawSortKey::Make(static_cast<uint32_t>(batch->GetRenderQueue()), batch->GetShaderSortId(),
+            static_cast<uint32_t>(batch->GetMaterialID()), batch->GetFormatId(),
+            renderer::DrawSortKey::DepthBucket(distance, farPlane));
+        sortEntries_.push_back({ key, static_cast<uint32_t>(b) });
+    }
+    RadixSort(sortEntries_, sortScratch_);
+
+    drawOrder_.clear();
+    drawOrder_.reserve(sortEntries_.size());
+    for (const auto& entry : sortEntries_) {
+        drawOrder_.push_back(batches_[entry.index_]);
+    }
+
+    // Blended objects: depths change little between frames, so last frame's order is nearly
+    // sorted and an insertion sort (farthest first) costs close to one pass.
+    if (blendedDrawsDirty_) {
+        RebuildBlendedDraws();
+    }
+    for (auto& draw : blendedDraws_) {
+        const glm::vec3 d = draw.batch_->GetRenderObjects()[draw.objectIndex_]->GetCenter() - cameraPos;
+        draw.depth_ = glm::dot(d, d);
+    }
+    size_t moves = 0;
+    for (size_t i = 1; i < blendedDraws_.size(); ++i) {
+        const BlendedDraw draw = blendedDraws_[i];
+        size_t j = i;
+        while (j > 0 && blendedDraws_[j - 1].depth_ < draw.depth_) {
+            blendedDraws_[j] = blendedDraws_[j - 1];
+            --j;
+        }
+        blendedDraws_[j] = draw;
+        moves += i - j;
+    }
+
+    drawOrderStats_ = { CountBatchStateChanges(batches_), CountBatchStateChanges(drawOrder_) };
+    const renderer::Batch* previous = nullptr;
+    for (const auto& draw : blendedDraws_) {
+        CountStateChange(drawOrderStats_.blended_, previous, *draw.batch_);
+    }
+    drawOrderStats_.blendedSortMoves_ = moves;
+
+    const auto& before = drawOrderStats_.unsorted_;
+    const auto& after = drawOrderStats_.sorted_;
+    const auto& blended = drawOrderStats_.blended_;
+    Logger::GetLogger()->debug("BatchManager: {} batch draw(s); shader/material/VAO switches {}/{}/{} unsorted, {}/{}/{} sorted; "
+        "{} blended object(s), {}/{}/{} switches, {} sort move(s).",
+        after.draws_, before.shaderSwitches_, before.materialSwitches_, before.vaoSwitches_,
+        after.shaderSwitches_, after.materialSwitches_, after.vaoSwitches_,
+        blended.draws_, blended.shaderSwitches_, blended.materialSwitches_, blended.vaoSwitches_, moves);
+}
+
+const std::vector<std::shared_ptr<renderer::Batch>>& BatchManager::GetDrawOrder() const {
+    return drawOrder_.empty() ? batches_ : drawOrder_;
+}
+
+const std::vector<BatchManager::BlendedDraw>& BatchManager::GetBlendedDraws() const {
+    static const std::vector<BlendedDraw> kNone;
+    return blendedDrawsDirty_ ? kNone : blendedDraws_;
+}
+
+void BatchManager::RebuildBlendedDraws() {
+    blendedDraws_.clear();
+    for (const auto& batch : batches_) {
+        if (batch->GetRenderQueue() != renderer::RenderQueue::Blended)
+            continue;
+        const auto& ros = batch->GetRenderObjects();
+        for (size_t i = 0; i < ros.size(); i++) {
+            if (ros[i]) {
+                blendedDraws_.push_back({ batch.get(), i, 0.0f });
+            }
+        }
+    }
+    blendedDrawsDirty_ = false;
 }
 
 void BatchManager::UpdateLOD(const std::shared_ptr<BaseRenderObject>& ro, size_t newLOD) {
     auto batch = FindBatchForObject(ro);
     if (!batch)
         return;
-    auto& objects = batch->GetRenderObjects();
-    auto it = std::find(objects.begin(), objects.end(), ro);
-    if (it == objects.end())
-        return;
-    size_t idx = std::distance(objects.begin(), it);
-    batch->UpdateLOD(idx, newLOD);
+    batch->UpdateLOD(ro->GetBatchHandle().commandIndex_, newLOD);
 }
 
 void BatchManager::UpdateLODs(std::shared_ptr<Scene::Camera>& camera, LODEvaluator& lodEvaluator) {
     if (!built_ || !camera)
         return;
-    auto lodMap = lodEvaluator.EvaluateLODs(renderObjects_, camera);
-    for (auto& ro : renderObjects_) {
-        auto it = lodMap.find(ro.get());
-        if (it != lodMap.end()) {
-            size_t newLOD = it->second;
-            if (newLOD != ro->GetCurrentLOD()) {
-                UpdateLOD(ro, newLOD);
-            }
+    const auto lods = lodEvaluator.EvaluateLODs(renderObjects_, camera);
+    for (size_t i = 0; i < renderObjects_.size(); i++) {
+        if (lods[i] != renderObjects_[i]->GetCurrentLOD()) {
+            UpdateLOD(renderObjects_[i], lods[i]);
         }
     }
 }
@@ -102,7 +323,7 @@ void BatchManager::SetLOD(size_t forcedLOD) {
         auto& ros = batch->GetRenderObjects();
         for (size_t i = 0; i < ros.size(); i++) {
             auto ro = ros[i];
-            if (ro->SetLOD(forcedLOD)) {
+            if (ro && ro->SetLOD(forcedLOD)) {
                 batch->UpdateLOD(i, forcedLOD);
             }
         }
@@ -113,10 +334,75 @@ void BatchManager::CullObject(const std::shared_ptr<BaseRenderObject>& ro) {
     auto batch = FindBatchForObject(ro);
     if (!batch)
         return;
-    auto& ros = batch->GetRenderObjects();
-    auto it = std::find(ros.begin(), ros.end(), ro);
-    if (it == ros.end())
+    batch->CullObject(ro->GetBatchHandle().commandIndex_);
+}
+
+void BatchManager::CullClusters(const FrustumCuller& culler, const glm::vec3& cameraPos) {
+    if (!built_)
+        return;
+    for (auto& batch : batches_) {
+        batch->CullClusters(culler, cameraPos);
+    }
+}
+
+renderer::CommandUploadStats BatchManager::GetCommandUploadStats() const {
+    renderer::CommandUploadStats total;
+    for (auto& batch : batches_) {
+        total += batch->GetCommandUploadStats();
+    }
+    return total;
+}
+
+void BatchManager::ResetCommandUploadStats() {
+    for (auto& batch : batches_) {
+        batch->ResetCommandUploadStats();
+    }
+}
+
+void BatchManager::AppendStreamedLODs(uint64_t publishCount) {
+    if (!built_ || publishCount == lodPublishCount_)
+        return;
+    lodPublishCount_ = publishCount;
+    for (auto& batch : batches_) {
+        std::vector<size_t> objectIndices;
+        auto& ros = batch->GetRenderObjects();
+        for (size_t i = 0; i < ros.size(); i++) {
+            // Batch::AppendLODs skips objects that already have all of their mesh's LODs.
+            if (ros[i]) {
+                objectIndices.push_back(i);
+            }
+        }
+        if (!objectIndices.empty()) {
+            batch->AppendLODs(objectIndices);
+        }
+    }
+}
+
+void BatchManager::ApplyMeshResidency() {
+    if (!built_ || residencyApplied_)
+        return;
+    residencyApplied_ = true;
+
+    std::unordered_set<graphics::Mesh*> meshes;
+    for (auto& ro : renderObjects_) {
+        if (ro->GetMesh()->cpuReleasable_) {
+            meshes.insert(ro->GetMesh().get());
+        }
+    }
+    if (meshes.empty())
         return;
-    size_t idx = std::distance(ros.begin(), it);
-    batch->CullObject(idx);
-}
\ No newline at end of file
+
+    size_t bytesBefore = 0, bytesAfter = 0;
+    size_t counts[4] = {};
+    for (auto* mesh : meshes) {
+        bytesBefore += mesh->GetCPUMemoryBytes();
+        const auto residency = mesh->SetResidency(meshResidency_);
+        bytesAfter += mesh->GetCPUMemoryBytes();
+        ++counts[static_cast<size_t>(residency)];
+    }
+
+    constexpr double kMB = 1024.0 * 1024.0;
+    Logger::GetLogger()->info("BatchManager: CPU geometry of {} mesh(es) {:.1f} MB -> {:.1f} MB "
+        "(full {}, positions+indices {}, compressed {}, evicted {}).",
+        meshes.size(), bytesBefore / kMB, bytesAfter / kMB, counts[0], counts[1], counts[2], counts[3]);
+}
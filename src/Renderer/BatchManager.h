@@ -4,43 +4,116 @@
 #include <vector>
 #include <unordered_map>
 #include "Batch.h"
+#include "DrawSortKey.h"
+#include "Utilities/RadixSort.h"
 
 class BaseRenderObject;
 namespace Scene {
     class Camera;
 }
 class LODEvaluator;
+class FrustumCuller;
 
 class BatchManager {
 public:
+    // One object of a blended batch, drawn on its own so blended geometry can be ordered per object.
+    struct BlendedDraw {
+        renderer::Batch* batch_ = nullptr;
+        size_t objectIndex_ = 0;
+        float depth_ = 0.0f;    // Squared distance from the camera to the object's center.
+    };
+
     BatchManager() = default;
     ~BatchManager() = default;
 
-    // Adds a render object and marks the batches as stale.
+    // Adds a render object. Before the first build it only marks the batches as stale;
+    // afterwards it is uploaded into its batch (or a new one) without rebuilding the others.
     void AddRenderObject(const std::shared_ptr<BaseRenderObject>& ro);
 
+    // Removes a render object from its batch (freeing its GPU ranges); false if it is not managed here.
+    bool RemoveRenderObject(const std::shared_ptr<BaseRenderObject>& ro);
+
+    // Compacts the batches whose freed holes outweigh half of their live data.
+    void CompactBatches();
+
     // Builds (or rebuilds) batches if needed.
     void BuildBatches();
 
     // Clears all render objects and batches.
     void Clear();
 
-    // Returns the final set of batches.
+    // Mesh-relative, 16-bit-when-possible indices for batches built from now on (on by default).
+    void SetCompactIndices(bool enabled) { compactIndices_ = enabled; built_ = false; }
+
+    // Returns the final set of batches; after a build they are grouped by vertex format.
     const std::vector<std::shared_ptr<renderer::Batch>>& GetBatches() const;
 
-    // LOD and culling updates.
+    // Orders the batches by their 64-bit sort key (queue, shader, material, vertex format, depth
+    // bucket) with a radix sort, front to back within identical state, and the objects of blended
+    // batches back to front with an insertion sort over last frame's order. Call once per frame.
+    void SortBatches(const glm::vec3& cameraPos, float farPlane);
+    // The batches in the last SortBatches() order (build order until the first sort after a change).
+    const std::vector<std::shared_ptr<renderer::Batch>>& GetDrawOrder() const;
+    // Objects of the blended batches, farthest first, as of the last SortBatches() (empty until then).
+    const std::vector<BlendedDraw>& GetBlendedDraws() const;
+    // Shader/material/VAO switches of the last sorted frame, before and after sorting.
+    const renderer::DrawOrderStats& GetDrawOrderStats() const { return drawOrderStats_; }
+
+    // Vertex/index storage shared by every batch of this manager.
+    const std::shared_ptr<renderer::GeometryArena>& GetGeometryArena() const { return geometryArena_; }
+
+    // LOD and culling updates. Objects are found through their BatchHandle, so each call is O(1).
     void UpdateLOD(const std::shared_ptr<BaseRenderObject>& ro, size_t newLOD);
     void UpdateLODs(std::shared_ptr<Scene::Camera>& camera, LODEvaluator& lodEvaluator);
     void SetLOD(size_t forcedLOD);
     void CullObject(const std::shared_ptr<BaseRenderObject>& ro);
+    void CullClusters(const FrustumCuller& culler, const glm::vec3& cameraPos);
+
+    // Draw command uploads of all batches: distinct commands changed versus uploads issued (see Batch::FlushCommands).
+    renderer::CommandUploadStats GetCommandUploadStats() const;
+    void ResetCommandUploadStats();
+
+    // Uploads LODs that were streamed into already-batched meshes (no full rebuild). Meshes are
+    // shared between scenes, so this compares every object with its mesh whenever
+    // @p publishCount (LODStreamer::GetPublishCount()) moved, whichever scene published them.
+    void AppendStreamedLODs(uint64_t publishCount);
+
+    // CPU data kept for releasable meshes once their batches are uploaded (Compressed by default).
+    // Rebuilds restore full data first; the policy is re-applied by the next ApplyMeshResidency().
+    void SetMeshResidency(graphics::MeshResidency residency) { meshResidency_ = residency; residencyApplied_ = false; }
+    graphics::MeshResidency GetMeshResidency() const { return meshResidency_; }
+
+    // Applies the residency policy once per build and logs CPU geometry memory before/after.
+    // Call only when no worker reads the meshes (e.g. no LODs are being generated).
+    void ApplyMeshResidency();
 
 private:
     std::vector<std::shared_ptr<BaseRenderObject>> renderObjects_;
     std::vector<std::shared_ptr<renderer::Batch>> batches_;
-    std::unordered_map<BaseRenderObject*, std::shared_ptr<renderer::Batch>> objToBatch_;
+    std::shared_ptr<renderer::GeometryArena> geometryArena_ = std::make_shared<renderer::GeometryArena>();
+    // Per-frame draw order; cleared whenever batches_ changes.
+    std::vector<std::shared_ptr<renderer::Batch>> drawOrder_;
+    std::vector<SortKeyEntry> sortEntries_;
+    std::vector<SortKeyEntry> sortScratch_;
+    renderer::DrawOrderStats drawOrderStats_;
+    // Kept across frames so the next sort starts from a nearly sorted list; rebuilt when objects change.
+    std::vector<BlendedDraw> blendedDraws_;
+    bool blendedDrawsDirty_ = true;
+    // Dense IDs for the shader field of the sort keys.
+    std::unordered_map<std::string, uint32_t> shaderSortIds_;
     bool built_ = false;
+    bool compactIndices_ = true;
+    graphics::MeshResidency meshResidency_ = graphics::MeshResidency::Compressed;
+    bool residencyApplied_ = false;
+    uint64_t lodPublishCount_ = 0;
 
     std::vector<std::shared_ptr<renderer::Batch>> BuildBatchesFromObjects(
         const std::vector<std::shared_ptr<BaseRenderObject>>& objs);
+    // Stamps every object of batches_[batchIndex] with its BatchHandle (after builds, compaction or batch moves).
+    void AssignHandles(size_t batchIndex);
+    // O(1) lookup through the object's BatchHandle; null if the object is not batched here.
     std::shared_ptr<renderer::Batch> FindBatchForObject(const std::shared_ptr<BaseRenderObject>& ro) const;
+    std::shared_ptr<renderer::Batch> FindBatch(const std::string& shaderName, int materialID) const;
+    std::shared_ptr<renderer::Batch> MakeBatch(const std::string& shaderName, int materialID);
+    void RebuildBlendedDraws();
 };
\ No newline at end of file
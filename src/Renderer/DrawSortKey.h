@@ -0,0 +1,74 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace renderer {
+
+    /// Geometry pass queues in draw order; the pass field of a DrawSortKey.
+    enum class RenderQueue : uint8_t {
+        Opaque = 0,
+        AlphaTested = 1,    ///< After the opaque queue, so discarding shaders do not disable early-Z for it.
+        Blended = 2         ///< Drawn per object, back to front, without depth writes.
+    };
+
+    /**
+     * @brief 64-bit draw order key, sorted as an unsigned integer (see RadixSort).
+     *
+     * From the most significant bits: pass (4), shader (12), material (16), vertex format (8)
+     * and depth bucket (24). Draws with the same shader stay adjacent, then those with the
+     * same material and VAO. Each batch has a unique shader/material pair, so the depth bucket
+     * never separates two batches in practice; front-to-back order comes from
+     * Batch::SortCommandsByDepth() within each batch. Fields wider than their bits are truncated.
+     */
+    namespace DrawSortKey {
+        constexpr unsigned kPassBits = 4;
+        constexpr unsigned kShaderBits = 12;
+        constexpr unsigned kMaterialBits = 16;
+        constexpr unsigned kFormatBits = 8;
+        constexpr unsigned kDepthBits = 24;
+
+        constexpr unsigned kDepthShift = 0;
+        constexpr unsigned kFormatShift = kDepthShift + kDepthBits;
+        constexpr unsigned kMaterialShift = kFormatShift + kFormatBits;
+        constexpr unsigned kShaderShift = kMaterialShift + kMaterialBits;
+        constexpr unsigned kPassShift = kShaderShift + kShaderBits;
+        static_assert(kPassShift + kPassBits == 64, "DrawSortKey fields must fill 64 bits.");
+
+        constexpr uint64_t Field(uint64_t value, unsigned bits, unsigned shift) {
+            return (value & ((uint64_t{ 1 } << bits) - 1)) << shift;
+        }
+
+        constexpr uint64_t Make(uint32_t pass, uint32_t shader, uint32_t material, uint32_t format, uint32_t depth) {
+            return Field(pass, kPassBits, kPassShift) | Field(shader, kShaderBits, kShaderShift) |
+                Field(material, kMaterialBits, kMaterialShift) | Field(format, kFormatBits, kFormatShift) |
+                Field(depth, kDepthBits, kDepthShift);
+        }
+
+        /// Quantizes a view distance in [0, farPlane] to the depth field (0 = nearest).
+        inline uint32_t DepthBucket(float distance, float farPlane) {
+            constexpr uint32_t kMaxBucket = (1u << kDepthBits) - 1;
+            const float t = farPlane > 0.0f ? std::clamp(distance / farPlane, 0.0f, 1.0f) : 0.0f;
+            return static_cast<uint32_t>(t * static_cast<float>(kMaxBucket));
+        }
+    }
+
+    /// GL state changes a draw order costs, counted the way GeometryPass binds state.
+    struct StateChangeStats {
+        size_t draws_ = 0;
+        size_t shaderSwitches_ = 0;
+        size_t materialSwitches_ = 0;   ///< Includes rebinding after a shader switch.
+        size_t vaoSwitches_ = 0;
+    };
+
+    /// State changes of one frame: batches in build order (unsorted_) versus sort-key order
+    /// (sorted_), and the per-object draws of the blended queue.
+    struct DrawOrderStats {
+        StateChangeStats unsorted_;
+        StateChangeStats sorted_;
+        StateChangeStats blended_;
+        size_t blendedSortMoves_ = 0;   ///< Insertion sort moves; near zero while the camera moves smoothly.
+    };
+
+} // namespace renderer
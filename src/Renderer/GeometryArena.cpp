@@ -0,0 +1,171 @@
+#include "GeometryArena.h"
+#include "Utilities/Logger.h"
+#include <algorithm>
+#include <stdexcept>
+
+#include "Graphics/Buffers/VertexArray.h"
+#include "Graphics/Buffers/VertexBuffer.h"
+#include "Graphics/Buffers/IndexBuffer.h"
+#include "Graphics/Buffers/VertexBufferLayout.h"
+
+namespace renderer {
+
+    namespace {
+        // First allocation of each buffer; later growth is 1.5x.
+        constexpr size_t kInitialVertexBytes = 4 * 1024 * 1024;
+        constexpr size_t kInitialIndexWords = 1024 * 1024;
+
+        constexpr size_t kWordBytes = sizeof(GLuint);
+
+        size_t IndexBytes(GLenum indexType) {
+            return indexType == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint);
+        }
+
+        size_t IndexWords(size_t count, GLenum indexType) {
+            return (count * IndexBytes(indexType) + kWordBytes - 1) / kWordBytes;
+        }
+
+        size_t GrownCapacity(size_t capacity, size_t required) {
+            return std::max(capacity + required, capacity + capacity / 2);
+        }
+    }
+
+    GeometryArena::GeometryArena() = default;
+    GeometryArena::~GeometryArena() = default;
+
+    GeometryArena::FormatId GeometryArena::RegisterFormat(const graphics::VertexFormat& format,
+        const graphics::VertexBufferLayout& layout)
+    {
+        for (size_t i = 0; i < formats_.size(); ++i) {
+            if (formats_[i]->format_ == format) {
+                return static_cast<FormatId>(i);
+            }
+        }
+        if (layout.GetStride() != format.stride_) {
+            throw std::logic_error("GeometryArena: VertexBufferLayout and VertexFormat disagree on the vertex stride.");
+        }
+
+        auto pool = std::make_unique<FormatPool>();
+        pool->format_ = format;
+        const size_t capacity = std::max<size_t>(kInitialVertexBytes / format.stride_, 1);
+        pool->vertexBuffer_ = std::make_unique<graphics::VertexBuffer>(capacity * format.stride_, GL_STATIC_DRAW);
+        pool->vertices_.Reset(capacity);
+        pool->vao_ = std::make_unique<graphics::VertexArray>();
+        pool->vao_->AddBuffer(*pool->vertexBuffer_, layout);
+        if (!indexBuffer_) {
+            indexBuffer_ = std::make_unique<graphics::IndexBuffer>(kInitialIndexWords, GL_STATIC_DRAW, GL_UNSIGNED_INT);
+            indexWords_.Reset(kInitialIndexWords);
+        }
+        pool->vao_->SetIndexBuffer(*indexBuffer_);
+
+        Logger::GetLogger()->info("GeometryArena: new vertex format #{} ({} bytes per vertex, {}quantized).",
+            formats_.size(), format.stride_, format.quantized_ ? "" : "not ");
+        formats_.push_back(std::move(pool));
+        return static_cast<FormatId>(formats_.size() - 1);
+    }
+
+    size_t GeometryArena::AllocateVertices(FormatId format, size_t count) {
+        auto& pool = *formats_.at(format);
+        size_t first = pool.vertices_.Allocate(count);
+        if (first == RangeAllocator::kInvalid) {
+            GrowVertices(pool, count);
+            first = pool.vertices_.Allocate(count);
+        }
+        return first;
+    }
+
+    void GeometryArena::FreeVertices(FormatId format, size_t firstVertex, size_t count) {
+        formats_.at(format)->vertices_.Free(firstVertex, count);
+    }
+
+    void GeometryArena::UploadVertices(FormatId format, size_t firstVertex, std::span<const std::byte> data) {
+        auto& pool = *formats_.at(format);
+        pool.vertexBuffer_->UpdateData(data, static_cast<GLintptr>(firstVertex * pool.format_.stride_));
+    }
+
+    size_t GeometryArena::AllocateIndices(size_t count, GLenum indexType) {
+        const size_t words = IndexWords(count, indexType);
+        size_t firstWord = indexWords_.Allocate(words);
+        if (firstWord == RangeAllocator::kInvalid) {
+            GrowIndices(words);
+            firstWord = indexWords_.Allocate(words);
+        }
+        return firstWord * kWordBytes / IndexBytes(indexType);
+    }
+
+    void GeometryArena::FreeIndices(size_t firstIndex, size_t count, GLenum indexType) {
+        indexWords_.Free(firstIndex * IndexBytes(indexType) / kWordBytes, IndexWords(count, indexType));
+    }
+
+    void GeometryArena::UploadIndices(size_t firstIndex, GLenum indexType, std::span<const std::byte> data) {
+        indexBuffer_->UpdateBytes(data, static_cast<GLintptr>(firstIndex * IndexBytes(indexType)));
+    }
+
+    void GeometryArena::Bind(FormatId format) const {
+        formats_.at(format)->vao_->Bind();
+    }
+
+    void GeometryArena::Unbind() const {
+        if (!formats_.empty()) {
+            formats_.front()->vao_->Unbind();
+        }
+    }
+
+    void GeometryArena::GrowVertices(FormatPool& pool, size_t minVertices) {
+        const size_t stride = pool.format_.stride_;
+        const size_t oldCapacity = pool.vertices_.GetCapacity();
+        const size_t newCapacity = GrownCapacity(oldCapacity, minVertices);
+        auto grown = std::make_unique<graphics::VertexBuffer>(newCapacity * stride, GL_STATIC_DRAW);
+        grown->CopyFrom(*pool.vertexBuffer_, 0, 0, static_cast<GLsizeiptr>(oldCapacity * stride));
+        pool.vertexBuffer_ = std::move(grown);
+        pool.vao_->SetVertexBuffer(*pool.vertexBuffer_, static_cast<GLsizei>(stride));
+        pool.vertices_.Grow(newCapacity);
+        ++growths_;
+        Logger::GetLogger()->info("GeometryArena: grew the vertex buffer of a {}-byte format to {:.1f} MB.",
+            stride, static_cast<double>(newCapacity * stride) / (1024.0 * 1024.0));
+    }
+
+    void GeometryArena::GrowIndices(size_t minWords) {
+        const size_t oldCapacity = indexWords_.GetCapacity();
+        const size_t newCapacity = GrownCapacity(oldCapacity, minWords);
+        auto grown = std::make_unique<graphics::IndexBuffer>(newCapacity, GL_STATIC_DRAW, GL_UNSIGNED_INT);
+        grown->CopyFrom(*indexBuffer_, 0, 0, static_cast<GLsizeiptr>(oldCapacity * kWordBytes));
+        indexBuffer_ = std::move(grown);
+        for (auto& pool : formats_) {
+            pool->vao_->SetIndexBuffer(*indexBuffer_);
+        }
+        indexWords_.Grow(newCapacity);
+        ++growths_;
+        Logger::GetLogger()->info("GeometryArena: grew the index buffer to {:.1f} MB.",
+            static_cast<double>(newCapacity * kWordBytes) / (1024.0 * 1024.0));
+    }
+
+    GeometryArena::Stats GeometryArena::GetStats() const {
+        Stats stats;
+        stats.formats_ = formats_.size();
+        stats.growths_ = growths_;
+        for (const auto& pool : formats_) {
+            const size_t stride = pool->format_.stride_;
+            stats.vertexCapacityBytes_ += pool->vertices_.GetCapacity() * stride;
+            stats.vertexUsedBytes_ += pool->vertices_.GetUsed() * stride;
+            stats.vertexFragmentedBytes_ += pool->vertices_.GetFragmentedFree() * stride;
+            stats.freeBlocks_ += pool->vertices_.GetFreeBlockCount();
+        }
+        stats.indexCapacityBytes_ = indexWords_.GetCapacity() * kWordBytes;
+        stats.indexUsedBytes_ = indexWords_.GetUsed() * kWordBytes;
+        stats.indexFragmentedBytes_ = indexWords_.GetFragmentedFree() * kWordBytes;
+        stats.freeBlocks_ += indexWords_.GetFreeBlockCount();
+        return stats;
+    }
+
+    void GeometryArena::LogStats() const {
+        const Stats stats = GetStats();
+        constexpr double kMB = 1024.0 * 1024.0;
+        Logger::GetLogger()->info("GeometryArena: {} format(s); vertices {:.1f}/{:.1f} MB ({:.1f} MB fragmented), "
+            "indices {:.1f}/{:.1f} MB ({:.1f} MB fragmented), {} free block(s), {} growth(s).",
+            stats.formats_, stats.vertexUsedBytes_ / kMB, stats.vertexCapacityBytes_ / kMB, stats.vertexFragmentedBytes_ / kMB,
+            stats.indexUsedBytes_ / kMB, stats.indexCapacityBytes_ / kMB, stats.indexFragmentedBytes_ / kMB,
+            stats.freeBlocks_, stats.growths_);
+    }
+
+} // namespace renderer
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+#include <glad/glad.h>
+#include "Graphics/Meshes/VertexFormat.h"
+#include "Utilities/RangeAllocator.h"
+
+namespace graphics {
+
+    class VertexArray;
+    class VertexBuffer;
+    class IndexBuffer;
+    class VertexBufferLayout;
+}
+
+namespace renderer {
+
+    /**
+     * @brief Shared geometry storage for batches: one vertex buffer and VAO per vertex format,
+     *        and one index buffer for every format.
+     *
+     * Batches sub-allocate vertex and index ranges (first-fit free lists, see RangeAllocator)
+     * instead of owning buffers, so consecutive batches of the same format draw without
+     * rebinding anything. The index buffer holds 16- and 32-bit ranges side by side; it is
+     * allocated in 4-byte words, so every range starts at a multiple of its index size and
+     * draw commands keep addressing it through firstIndex_. Buffers grow by 1.5x with a
+     * GPU-side copy when no free range fits, and every VAO is repointed at the new buffer.
+     */
+    class GeometryArena {
+    public:
+        using FormatId = uint32_t;
+
+        /// Occupancy of the arena; "fragmented" is free space outside each buffer's largest free block.
+        struct Stats {
+            size_t formats_ = 0;
+            size_t vertexCapacityBytes_ = 0;
+            size_t vertexUsedBytes_ = 0;
+            size_t vertexFragmentedBytes_ = 0;
+            size_t indexCapacityBytes_ = 0;
+            size_t indexUsedBytes_ = 0;
+            size_t indexFragmentedBytes_ = 0;
+            size_t freeBlocks_ = 0;
+            size_t growths_ = 0;
+        };
+
+        GeometryArena();
+        ~GeometryArena();
+
+        GeometryArena(const GeometryArena&) = delete;
+        GeometryArena& operator=(const GeometryArena&) = delete;
+
+        /// Returns the pool of @p format, creating its vertex buffer and VAO (with @p layout) on first use.
+        FormatId RegisterFormat(const graphics::VertexFormat& format, const graphics::VertexBufferLayout& layout);
+
+        /// @return the first vertex of @p count vertices in the format's vertex buffer.
+        size_t AllocateVertices(FormatId format, size_t count);
+        void FreeVertices(FormatId format, size_t firstVertex, size_t count);
+        void UploadVertices(FormatId format, size_t firstVertex, std::span<const std::byte> data);
+
+        /// @return the first index (in units of @p indexType) of @p count indices in the shared index buffer.
+        size_t AllocateIndices(size_t count, GLenum indexType);
+        void FreeIndices(size_t firstIndex, size_t count, GLenum indexType);
+        void UploadIndices(size_t firstIndex, GLenum indexType, std::span<const std::byte> data);
+
+        /// Binds the VAO of @p format (its vertex buffer plus the shared index buffer).
+        void Bind(FormatId format) const;
+        void Unbind() const;
+
+        [[nodiscard]] Stats GetStats() const;
+        void LogStats() const;
+
+    private:
+        struct FormatPool {
+            graphics::VertexFormat format_;
+            std::unique_ptr<graphics::VertexBuffer> vertexBuffer_;
+            std::unique_ptr<graphics::VertexArray> vao_;
+            RangeAllocator vertices_;
+        };
+
+        void GrowVertices(FormatPool& pool, size_t minVertices);
+        void GrowIndices(size_t minWords);
+
+        std::vector<std::unique_ptr<FormatPool>> formats_;
+        std::unique_ptr<graphics::IndexBuffer> indexBuffer_;
+        RangeAllocator indexWords_;     ///< In 4-byte words.
+        size_t growths_ = 0;
+    };
+
+} // namespace renderer
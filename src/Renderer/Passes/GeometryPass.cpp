@@ -28,7 +28,7 @@ void GeometryPass::Execute(const std::shared_ptr<Scene::Scene>& scene) {
     PROFILE_FUNCTION(Blue);
     glEnable(GL_DEPTH_TEST);
     glDepthFunc(GL_LESS);
-    glEnable(GL_BLEND);
+    glDisable(GL_BLEND);    // Only the blended queue blends.
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
     {
@@ -59,25 +59,68 @@ void GeometryPass::Execute(const std::shared_ptr<Scene::Scene>& scene) {
         PROFILE_BLOCK("Render Static Batches", Cyan);
         auto& materialManager = graphics::MaterialManager::GetInstance();
         auto& shaderManager = graphics::ShaderManager::GetInstance();
-        const auto& staticBatches = scene->GetStaticBatches();
+        // Sort-key order runs the opaque queue, then the alpha-tested one, keeping batches with
+        // the same shader, material and VAO adjacent: each piece of state is only rebound when it
+        // differs from the previous draw (BatchManager counts switches the same way).
+        const renderer::GeometryArena* boundArena = nullptr;
+        renderer::GeometryArena::FormatId boundFormat = 0;
+        const std::string* boundShaderName = nullptr;
+        std::shared_ptr<graphics::Shader> shader;
+        int boundMaterial = -1;
+        auto bindState = [&](const renderer::Batch& batch) {
+            if (!boundShaderName || *boundShaderName != batch.GetShaderName()) {
+                shader = shaderManager.GetShader(batch.GetShaderName());
+                if (!shader) {
+                    Logger::GetLogger()->error("GeometryPass: Shader '{}' not found.", batch.GetShaderName());
+                    boundShaderName = nullptr;
+                    return false;
+                }
+                shader->Bind();
+                if (shadowed_) {
+                    shader->SetUniform("u_ShadowMatrix", shadowMatrix_);
+                }
+                boundShaderName = &batch.GetShaderName();
+                boundMaterial = -1;
+            }
+            if (batch.GetMaterialID() != boundMaterial) {
+                materialManager.UnbindMaterial();
+                materialManager.BindMaterial(batch.GetMaterialID(), shader);
+                boundMaterial = batch.GetMaterialID();
+            }
+            if (batch.GetGeometryArena().get() != boundArena || batch.GetFormatId() != boundFormat) {
+                batch.BindGeometry();
+                boundArena = batch.GetGeometryArena().get();
+                boundFormat = batch.GetFormatId();
+            }
+            return true;
+            };
 
-        for (auto& batch : staticBatches) {
+        for (auto& batch : scene->GetStaticDrawOrder()) {
             PROFILE_BLOCK("Render Batch", Purple);
-            if (batch->GetRenderObjects().empty())
-                continue;
-
-            auto shader = shaderManager.GetShader(batch->GetShaderName());
-            if (!shader) {
-                Logger::GetLogger()->error("GeometryPass: Shader '{}' not found.", batch->GetShaderName());
+            if (batch->GetLiveObjectCount() == 0 || batch->GetRenderQueue() == renderer::RenderQueue::Blended)
                 continue;
+            if (bindState(*batch)) {
+                batch->Draw();
             }
-            shader->Bind();
-            materialManager.BindMaterial(batch->GetMaterialID(), shader);
-            if (shadowed_) {
-                shader->SetUniform("u_ShadowMatrix", shadowMatrix_);
+        }
+
+        // Blended queue: one draw per object, farthest first, testing but not writing depth.
+        const auto& blendedDraws = scene->GetStaticBlendedDraws();
+        if (!blendedDraws.empty()) {
+            PROFILE_BLOCK("Render Blended Objects", Purple);
+            glEnable(GL_BLEND);
+            glDepthMask(GL_FALSE);
+            for (const auto& draw : blendedDraws) {
+                if (bindState(*draw.batch_)) {
+                    draw.batch_->DrawObject(draw.objectIndex_);
+                }
             }
-            batch->Render();
-            materialManager.UnbindMaterial();
+            glDepthMask(GL_TRUE);
+        }
+
+        materialManager.UnbindMaterial();
+        if (boundArena) {
+            boundArena->Unbind();
         }
     }
 
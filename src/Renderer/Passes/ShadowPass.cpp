@@ -9,6 +9,8 @@ ShadowPass::ShadowPass(const std::shared_ptr<Scene::Scene>& scene, GLsizei shado
     shadowMap_ = std::make_shared<graphics::ShadowMap>(shadowResolution, shadowResolution);
     auto& shaderManager = graphics::ShaderManager::GetInstance();
     shadowShader_ = shaderManager.GetShader("basicShadowMap");
+    quantizedShadowShader_ = shaderManager.GetShader("basicShadowMapQuantized");
+    instancedShadowShader_ = shaderManager.GetShader("basicShadowMapInstanced");
 
     auto lightManager = scene->GetLightManager();
     glm::mat4 lightView = lightManager->ComputeLightView(0);
@@ -31,12 +33,44 @@ void ShadowPass::Execute(const std::shared_ptr<Scene::Scene>& scene) {
     glEnable(GL_POLYGON_OFFSET_FILL);
     glPolygonOffset(1.f, 2.f);
 
-    shadowShader_->Bind();
-    shadowShader_->SetUniform("u_ShadowMatrix", shadowMatrix_);
-
+    // Quantized batches need the variant that dequantizes positions,
+    // instanced batches the one that applies the per-instance transforms.
+    struct ShadowVariant {
+        const std::shared_ptr<graphics::Shader>& shader_;
+        bool quantized_;
+        bool instanced_;
+    };
+    const ShadowVariant variants[] = {
+        { shadowShader_, false, false },
+        { quantizedShadowShader_, true, false },
+        { instancedShadowShader_, false, true },
+    };
     const auto& staticBatches = scene->GetStaticBatches();
-    for (auto& batch : staticBatches) {
-        batch->Render();
+    const renderer::GeometryArena* boundArena = nullptr;
+    renderer::GeometryArena::FormatId boundFormat = 0;
+    for (const auto& variant : variants) {
+        const auto& shader = variant.shader_;
+        bool bound = false;
+        for (auto& batch : staticBatches) {
+            const auto& layout = batch->GetMeshLayout();
+            if (layout.quantized_ != variant.quantized_ || layout.instanced_ != variant.instanced_ || !shader) {
+                continue;
+            }
+            if (!bound) {
+                shader->Bind();
+                shader->SetUniform("u_ShadowMatrix", shadowMatrix_);
+                bound = true;
+            }
+            if (batch->GetGeometryArena().get() != boundArena || batch->GetFormatId() != boundFormat) {
+                batch->BindGeometry();
+                boundArena = batch->GetGeometryArena().get();
+                boundFormat = batch->GetFormatId();
+            }
+            batch->Draw(/*visibleOnly=*/false); // The light sees more than the camera.
+        }
+    }
+    if (boundArena) {
+        boundArena->Unbind();
     }
 
     glDisable(GL_POLYGON_OFFSET_FILL);
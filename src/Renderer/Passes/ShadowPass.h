@@ -24,6 +24,8 @@ public:
 private:
     std::shared_ptr<graphics::ShadowMap> shadowMap_;
     std::shared_ptr<graphics::Shader> shadowShader_;
+    std::shared_ptr<graphics::Shader> quantizedShadowShader_;
+    std::shared_ptr<graphics::Shader> instancedShadowShader_;
     glm::mat4 shadowMatrix_;
     bool calculated_ = false;
 };
\ No newline at end of file
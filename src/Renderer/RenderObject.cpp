@@ -2,6 +2,7 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 // --- BaseRenderObject ---
 bool BaseRenderObject::SetLOD(size_t lod) {
@@ -46,14 +47,20 @@ bool RenderObject::SetLOD(size_t lod) {
 }
 
 float RenderObject::GetBoundingSphereRadius() const {
-    float baseRadius = BaseRenderObject::GetBoundingSphereRadius();
+    return BaseRenderObject::GetBoundingSphereRadius() * GetErrorScale();
+}
+
+glm::mat4 RenderObject::GetModelMatrix() const {
+    return transform_->GetModelMatrix();
+}
+
+float RenderObject::GetErrorScale() const {
     glm::mat4 model = transform_->GetModelMatrix();
     glm::vec3 scale;
     scale.x = glm::length(glm::vec3(model[0]));
     scale.y = glm::length(glm::vec3(model[1]));
     scale.z = glm::length(glm::vec3(model[2]));
-    float maxScale = std::max({ scale.x, scale.y, scale.z });
-    return baseRadius * maxScale;
+    return std::max({ scale.x, scale.y, scale.z });
 }
 
 glm::vec3 RenderObject::GetCenter() const {
@@ -81,4 +88,41 @@ StaticRenderObject::StaticRenderObject(std::shared_ptr<graphics::Mesh> mesh,
 
 glm::vec3 StaticRenderObject::GetWorldCenter() const {
     return mesh_->localCenter_;
-}
\ No newline at end of file
+}
+
+// --- InstancedRenderObject ---
+InstancedRenderObject::InstancedRenderObject(std::shared_ptr<graphics::Mesh> mesh,
+    MeshLayout meshLayout,
+    int materialID,
+    std::string shaderName,
+    std::vector<glm::mat4> instanceTransforms)
+    : BaseRenderObject(std::move(mesh), std::move(meshLayout), materialID, std::move(shaderName))
+    , instanceTransforms_(std::move(instanceTransforms))
+{
+    if (instanceTransforms_.empty()) {
+        worldCenter_ = mesh_->localCenter_;
+        worldRadius_ = mesh_->boundingSphereRadius_;
+        return;
+    }
+
+    // Transform the mesh sphere by every instance, then enclose the results.
+    maxInstanceScale_ = 0.0f;
+    std::vector<glm::vec4> spheres;
+    spheres.reserve(instanceTransforms_.size());
+    glm::vec3 minCenter(std::numeric_limits<float>::max());
+    glm::vec3 maxCenter(std::numeric_limits<float>::lowest());
+    for (const auto& model : instanceTransforms_) {
+        const glm::vec3 center(model * glm::vec4(mesh_->localCenter_, 1.0f));
+        const float maxScale = std::max({ glm::length(glm::vec3(model[0])),
+            glm::length(glm::vec3(model[1])),
+            glm::length(glm::vec3(model[2])) });
+        spheres.emplace_back(center, mesh_->boundingSphereRadius_ * maxScale);
+        maxInstanceScale_ = std::max(maxInstanceScale_, maxScale);
+        minCenter = glm::min(minCenter, center);
+        maxCenter = glm::max(maxCenter, center);
+    }
+    worldCenter_ = 0.5f * (minCenter + maxCenter);
+    for (const auto& sphere : spheres) {
+        worldRadius_ = std::max(worldRadius_, glm::distance(worldCenter_, glm::vec3(sphere)) + sphere.w);
+    }
+}
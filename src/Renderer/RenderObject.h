@@ -1,12 +1,26 @@
 ﻿#pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 #include <glm/glm.hpp>
 #include "Graphics/Meshes/Mesh.h"
 #include "Graphics/Meshes/MeshLayout.h"
 #include "Scene/Transform.h"
 
+/**
+ * Where an object sits in the static batches: its batch's index in BatchManager::GetBatches()
+ * and its draw command index within that batch. Assigned and kept current by BatchManager.
+ */
+struct BatchHandle {
+    static constexpr uint32_t kInvalid = ~0u;
+    uint32_t batchIndex_ = kInvalid;
+    uint32_t commandIndex_ = kInvalid;
+
+    bool IsValid() const { return batchIndex_ != kInvalid; }
+};
+
 /**
  * Base class for renderable objects.
  */
@@ -35,16 +49,24 @@ public:
     virtual glm::vec3 GetCenter() const;
     virtual glm::vec3 GetWorldCenter() const { return GetCenter(); }
     virtual float ComputeDistanceTo(const glm::vec3& pos) const;
+    /// Largest scale from mesh to world units; converts MeshLOD::error_ for screen-space LOD selection.
+    virtual float GetErrorScale() const { return 1.0f; }
+    /// Mesh to world transform (identity for meshes with baked transforms).
+    virtual glm::mat4 GetModelMatrix() const { return glm::mat4(1.0f); }
 
-    int GetVertexCount() const { return mesh_->positions_.size(); }
+    int GetVertexCount() const { return static_cast<int>(mesh_->GetVertexCount()); }
     int GetIndexCount() const { return mesh_->indices_.size(); }
 
+    const BatchHandle& GetBatchHandle() const { return batchHandle_; }
+    void SetBatchHandle(const BatchHandle& handle) { batchHandle_ = handle; }
+
 protected:
     std::shared_ptr<graphics::Mesh> mesh_;
     MeshLayout meshLayout_;
     int materialID_;
     std::string shaderName_;
     size_t currentLOD_ = 0;
+    BatchHandle batchHandle_;
 };
 
 class RenderObject : public BaseRenderObject {
@@ -64,6 +86,8 @@ public:
     glm::vec3 GetCenter() const override;
     glm::vec3 GetWorldCenter() const override;
     float ComputeDistanceTo(const glm::vec3& pos) const override;
+    float GetErrorScale() const override;
+    glm::mat4 GetModelMatrix() const override;
 
 private:
     std::shared_ptr<Transform> transform_;
@@ -79,3 +103,32 @@ public:
 
     glm::vec3 GetWorldCenter() const override;
 };
+
+/**
+ * Static mesh drawn once per instance transform (instanced MeshLayouts).
+ *
+ * The mesh stays in mesh space; culling and LOD use one sphere enclosing every instance.
+ */
+class InstancedRenderObject : public BaseRenderObject {
+public:
+    InstancedRenderObject(std::shared_ptr<graphics::Mesh> mesh,
+        MeshLayout meshLayout,
+        int materialID,
+        std::string shaderName,
+        std::vector<glm::mat4> instanceTransforms);
+    ~InstancedRenderObject() override = default;
+
+    const std::vector<glm::mat4>& GetInstanceTransforms() const { return instanceTransforms_; }
+    size_t GetInstanceCount() const { return instanceTransforms_.size(); }
+
+    float GetBoundingSphereRadius() const override { return worldRadius_; }
+    glm::vec3 GetCenter() const override { return worldCenter_; }
+    glm::vec3 GetWorldCenter() const override { return worldCenter_; }
+    float GetErrorScale() const override { return maxInstanceScale_; }
+
+private:
+    std::vector<glm::mat4> instanceTransforms_;
+    glm::vec3 worldCenter_ = glm::vec3(0.0f);
+    float worldRadius_ = 0.0f;
+    float maxInstanceScale_ = 1.0f;
+};
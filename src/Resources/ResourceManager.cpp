@@ -29,6 +29,14 @@ std::pair<MeshLayout, MaterialLayout> ResourceManager::GetLayoutsFromShader(cons
             MeshLayout{ true, true, true, false, { TextureType::Diffuse } },
             MaterialLayout{ {MaterialParamType::Ambient, MaterialParamType::Diffuse, MaterialParamType::Specular, MaterialParamType::Shininess, MaterialParamType::Opacity, MaterialParamType::Emissive }, { TextureType::Diffuse, TextureType::Height, TextureType::Normal, TextureType::MetalRoughness, TextureType::AO, TextureType::Emissive, TextureType::BRDFLut, TextureType::Ambient } }
         }},
+        {"bistroShaderShadowedQuantized", {
+            MeshLayout{ true, true, true, false, { TextureType::Diffuse }, true },
+            MaterialLayout{ {MaterialParamType::Ambient, MaterialParamType::Diffuse, MaterialParamType::Specular, MaterialParamType::Shininess, MaterialParamType::Opacity, MaterialParamType::Emissive }, { TextureType::Diffuse, TextureType::Height, TextureType::Normal, TextureType::MetalRoughness, TextureType::AO, TextureType::Emissive, TextureType::BRDFLut, TextureType::Ambient } }
+        }},
+        {"bistroShaderShadowedInstanced", {
+            MeshLayout{ true, true, true, false, { TextureType::Diffuse }, false, true },
+            MaterialLayout{ {MaterialParamType::Ambient, MaterialParamType::Diffuse, MaterialParamType::Specular, MaterialParamType::Shininess, MaterialParamType::Opacity, MaterialParamType::Emissive }, { TextureType::Diffuse, TextureType::Height, TextureType::Normal, TextureType::MetalRoughness, TextureType::AO, TextureType::Emissive, TextureType::BRDFLut, TextureType::Ambient } }
+        }},
         {"simpleLightsShadowed", {
             MeshLayout{ true, true, false, false, {} },
             MaterialLayout{ { MaterialParamType::Ambient, MaterialParamType::Diffuse, MaterialParamType::Specular, MaterialParamType::Shininess }, {} }
@@ -1,4 +1,5 @@
 #include "FrustumCuller.h"
+#include "Renderer/RenderObject.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_access.hpp>
 #include <cmath>
@@ -68,4 +69,43 @@ bool FrustumCuller::IsSphereVisible(const glm::vec3& center, float radius) const
         }
     }
     return true;
-}
\ No newline at end of file
+}
+
+bool FrustumCuller::IsOrientedBoxVisible(const graphics::OrientedBox& box, const glm::mat4& model) const
+{
+    const glm::vec3 center(model * glm::vec4(box.center_, 1.0f));
+    const glm::mat3 linear(model);
+    const glm::vec3 axes[3] = {
+        linear * box.axes_[0] * box.halfExtents_.x,
+        linear * box.axes_[1] * box.halfExtents_.y,
+        linear * box.axes_[2] * box.halfExtents_.z };
+    for (auto& plane : m_Planes) {
+        const glm::vec3 normal(plane.a, plane.b, plane.c);
+        // Projected half-size of the box onto the plane normal.
+        const float extent = std::abs(glm::dot(normal, axes[0])) +
+            std::abs(glm::dot(normal, axes[1])) +
+            std::abs(glm::dot(normal, axes[2]));
+        if (PlaneDistance(plane, center) < -extent) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FrustumCuller::IsObjectVisible(const BaseRenderObject& object) const
+{
+    const auto& mesh = object.GetMesh();
+    if (m_ObjectVolume == CullVolume::Sphere || dynamic_cast<const InstancedRenderObject*>(&object)) {
+        return IsSphereVisible(object.GetWorldCenter(), object.GetBoundingSphereRadius());
+    }
+
+    const glm::mat4 model = object.GetModelMatrix();
+    const graphics::BoundingSphere sphere = mesh->GetLODSphere(object.GetCurrentLOD());
+    if (!IsSphereVisible(glm::vec3(model * glm::vec4(sphere.center_, 1.0f)), sphere.radius_ * object.GetErrorScale())) {
+        return false;
+    }
+    if (m_ObjectVolume == CullVolume::OrientedBox && mesh->orientedBox_.IsValid()) {
+        return IsOrientedBoxVisible(mesh->orientedBox_, model);
+    }
+    return true;
+}
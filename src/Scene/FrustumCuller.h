@@ -1,12 +1,22 @@
 #pragma once
 #include <glm/glm.hpp>
 #include <array>
+#include <cstdint>
+#include "Graphics/Meshes/BoundingVolumes.h"
 
 class Camera;
+class BaseRenderObject;
+
+/// Which mesh volume IsObjectVisible tests (clusters always use their own spheres).
+enum class CullVolume : uint8_t {
+    Sphere,         ///< Mesh bounding sphere.
+    LODSphere,      ///< Sphere of the LOD the object currently draws (tighter for coarse LODs).
+    OrientedBox     ///< LOD sphere first, then the mesh OBB for objects the sphere cannot reject.
+};
 
 /**
  * Simple frustum culler that extracts 6 planes (left, right, bottom, top, near, far)
- * from the camera’s projection * view matrix. Then does sphere-plane tests.
+ * from the camera’s projection * view matrix. Then does sphere/box-plane tests.
  */
 class FrustumCuller {
 public:
@@ -16,6 +26,15 @@ public:
     // Return true if a bounding sphere is inside (or intersects) the frustum
     bool IsSphereVisible(const glm::vec3& center, float radius) const;
 
+    // Return true if the box, transformed by model, is inside (or intersects) the frustum
+    bool IsOrientedBoxVisible(const graphics::OrientedBox& box, const glm::mat4& model) const;
+
+    // Tests the render object with the volume selected by SetObjectVolume (instanced objects use their sphere)
+    bool IsObjectVisible(const BaseRenderObject& object) const;
+
+    void SetObjectVolume(CullVolume volume) { m_ObjectVolume = volume; }
+    CullVolume GetObjectVolume() const { return m_ObjectVolume; }
+
 private:
     // Each plane: ax + by + cz + d = 0
     struct Plane {
@@ -23,6 +42,7 @@ private:
     };
 
     std::array<Plane, 6> m_Planes;
+    CullVolume m_ObjectVolume = CullVolume::OrientedBox;
 
     void NormalizePlane(Plane& plane);
     float PlaneDistance(const Plane& plane, const glm::vec3& point) const {
@@ -1,22 +1,19 @@
 #include "LODEvaluator.h"
 #include "Renderer/RenderObject.h"
 #include "Scene/Camera.h"
+#include "Scene/Screen.h"
 #include <glm/glm.hpp>
 #include <algorithm> // for std::min, std::max
 #include <cmath>
 
-std::unordered_map<BaseRenderObject*, size_t> LODEvaluator::EvaluateLODs(
+std::vector<size_t> LODEvaluator::EvaluateLODs(
     const std::vector<std::shared_ptr<BaseRenderObject>>& objects,
     const std::shared_ptr<Scene::Camera>& camera)
 {
-    std::unordered_map<BaseRenderObject*, size_t> lodMap;
-
+    // No camera => everything at LOD0
+    std::vector<size_t> selected(objects.size(), 0);
     if (!camera) {
-        // No camera => everything at LOD0
-        for (auto& ro : objects) {
-            lodMap[ro.get()] = 0;
-        }
-        return lodMap;
+        return selected;
     }
 
     // Compute dynamic thresholds based on the camera's far plane.
@@ -28,29 +25,50 @@ std::unordered_map<BaseRenderObject*, size_t> LODEvaluator::EvaluateLODs(
 
     glm::vec3 camPos = camera->GetPosition();
 
-    for (auto& ro : objects) {
+    // Pixels per world unit at distance 1: projected error = error * pixelsPerUnit / distance.
+    const float viewportHeight = static_cast<float>(std::max(Screen::height_, 1));
+    const float pixelsPerUnit = viewportHeight / (2.0f * std::tan(glm::radians(camera->GetFOV()) * 0.5f));
+    const float nearPlane = std::max(camera->GetNearPlane(), 1e-4f);
+
+    for (size_t objectIndex = 0; objectIndex < objects.size(); ++objectIndex) {
+        const auto& ro = objects[objectIndex];
         glm::vec3 worldCenter = ro->GetCenter();
         float radius = ro->GetBoundingSphereRadius();
         float distance = glm::distance(camPos, worldCenter) - radius;
         if (distance < 0.0f) distance = 0.0f;
 
+        const auto& lods = ro->GetMesh()->lods_;
+        const bool hasErrors = lods.size() > 1 && lods.back().error_ > 0.0f;
+
         size_t lodLevel = 0;
-        // Now use our computed thresholds
-        for (int i = 0; i < 4; ++i) {
-            if (distance > thresholds[i]) {
-                lodLevel++;
+        if (hasErrors) {
+            // Errors grow with the LOD index: take the coarsest one that still looks like LOD0.
+            const float scale = pixelsPerUnit * ro->GetErrorScale() / std::max(distance, nearPlane);
+            for (size_t i = lods.size() - 1; i > 0; --i) {
+                if (lods[i].error_ * scale <= m_MaxPixelError) {
+                    lodLevel = i;
+                    break;
+                }
             }
-            else {
-                break;
+        }
+        else {
+            // Now use our computed thresholds
+            for (int i = 0; i < 4; ++i) {
+                if (distance > thresholds[i]) {
+                    lodLevel++;
+                }
+                else {
+                    break;
+                }
             }
         }
 
-        // Clamp to max available LOD for the object's mesh.
+        // Clamp to the LODs resident right now; coarse LODs may still be streaming in.
         size_t maxLOD = std::max<size_t>(1, ro->GetMesh()->GetLODCount()) - 1;
         lodLevel = std::min(lodLevel, maxLOD);
 
-        lodMap[ro.get()] = lodLevel;
+        selected[objectIndex] = lodLevel;
     }
 
-    return lodMap;
+    return selected;
 }
\ No newline at end of file
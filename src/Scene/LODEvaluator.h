@@ -1,6 +1,5 @@
 #pragma once
 
-#include <unordered_map>
 #include <vector>
 #include <memory>
 
@@ -11,13 +10,21 @@ namespace Scene
 }
 
 /**
- * A simple LOD evaluator that uses distance thresholds.
- * If distance > m_Distances[i], LOD increments.
+ * Picks a LOD per object.
+ *
+ * Meshes whose LODs carry simplification errors (MeshLOD::error_) get the coarsest LOD whose
+ * error, projected at the object's distance, stays below m_MaxPixelError pixels. Meshes
+ * without errors (primitives) fall back to distance thresholds: if distance > threshold[i],
+ * the LOD increments.
  */
 class LODEvaluator {
 public:
-    // Evaluate LOD for each object based on camera position and return new LOD indices.
-    std::unordered_map<BaseRenderObject*, size_t> EvaluateLODs(
+    /// Largest projected simplification error (in pixels) a selected LOD may show; 1 by default.
+    void SetMaxPixelError(float pixels) { m_MaxPixelError = pixels; }
+    float GetMaxPixelError() const { return m_MaxPixelError; }
+
+    // Evaluate LOD for each object based on camera position and return new LOD indices (parallel to objects).
+    std::vector<size_t> EvaluateLODs(
         const std::vector<std::shared_ptr<BaseRenderObject>>& objects,
         const std::shared_ptr<Scene::Camera>& camera);
 
@@ -26,4 +33,5 @@ private:
     // For instance, if farPlane is 150 and the ratios are 0.25, 0.5, 0.75, 1.0,
     // the thresholds will be 37.5, 75, 112.5, and 150.
     float m_Ratios[4] = { 0.25f, 0.50f, 0.75f, 1.0f };
+    float m_MaxPixelError = 1.0f;
 };
\ No newline at end of file
@@ -3,8 +3,10 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include "Utilities/Logger.h"
 #include "Resources/ResourceManager.h"
-#include "Graphics/Meshes/StaticModelLoader.h"
+#include "Graphics/Meshes/ModelRegistry.h"
+#include "Graphics/Meshes/LODStreamer.h"
 #include "Renderer/RenderObject.h"
+#include <algorithm>
 #include <cfloat>  // For FLT_MAX
 
 namespace Scene {
@@ -27,13 +29,10 @@ namespace Scene {
         // Create a default camera.
         camera_ = std::make_shared<Camera>();
 
-        // Create the per-frame UBO using a Std140 layout.
-        frameDataUBO_ = std::make_unique<graphics::UniformBuffer>(
-            sizeof(FrameCommonData),
-            FRAME_DATA_BINDING_POINT,
-            graphics::UniformBufferLayout::Std140,
-            GL_DYNAMIC_DRAW
-        );
+        // Create the per-frame UBO ring (each write is padded to the UBO offset alignment).
+        const auto frameDataStride = static_cast<GLsizeiptr>(std::max(sizeof(FrameCommonData),
+            graphics::PersistentRingBuffer::GetOffsetAlignment(GL_UNIFORM_BUFFER)));
+        frameDataRing_ = std::make_unique<graphics::PersistentRingBuffer>(frameDataStride * FRAME_DATA_WRITES_PER_FRAME);
 
         // Initialize LOD evaluator and frustum culler.
         lodEvaluator_ = std::make_unique<LODEvaluator>();
@@ -62,6 +61,8 @@ namespace Scene {
         if (staticBatchManager_)
             staticBatchManager_->Clear();
         staticObjects_.clear();
+        pendingStaticObjects_.clear();
+        loadedModels_.clear();
         staticBatchesDirty_ = true;
 
         // Reinitialize the light manager.
@@ -90,18 +91,69 @@ namespace Scene {
         auto& resourceManager = ResourceManager::GetInstance();
         auto [meshLayout, matLayout] = resourceManager.GetLayoutsFromShader(shaderName);
 
-        // Use the StaticModelLoader to load the model.
-        StaticLoader::ModelLoader loader(scaleFactor);
-        bool success = loader.LoadStaticModel(modelName, meshLayout, matLayout, /*centerModel=*/true);
-        if (!success) {
+        // Models are shared through the registry: a model another scene (or an earlier
+        // instance of this one) already loaded with the same settings is not loaded again.
+        StaticLoader::ModelRequest request;
+        request.modelName_ = modelName;
+        request.meshLayout_ = meshLayout;
+        request.matLayout_ = matLayout;
+        request.scaleFactor_ = scaleFactor;
+        request.centerModel_ = true;
+        request.deferredLODs_ = deferredLODs_;
+        request.packedVertices_ = true;
+        request.clusterSettings_.enabled_ = clusterCulling_;
+        auto model = StaticLoader::ModelRegistry::GetInstance().Acquire(request);
+        if (!model) {
             Logger::GetLogger()->error("Failed to load static model '{}'.", modelName);
             return false;
         }
+        loadedModels_.push_back(model);
+
+        const auto& loadedObjects = model->objects_;
+        if (!model->optimizationStats_.empty()) {
+            modelOptimizationStats_[modelName] = StaticLoader::SummarizeStats(model->optimizationStats_);
+        }
 
-        const auto& loadedObjects = loader.GetLoadedObjects();
+        // Instanced meshes: record every instance as a scene graph node under a model root,
+        // then read the global transforms back for the render objects.
+        std::vector<std::vector<int>> instanceNodes(loadedObjects.size());
+        if (meshLayout.instanced_) {
+            const int modelNode = sceneGraph_->AddNode(-1, modelName);
+            for (size_t i = 0; i < loadedObjects.size(); ++i) {
+                const auto& meshInfo = loadedObjects[i];
+                const int objectIndex = static_cast<int>(staticObjects_.size() + i);
+                for (size_t k = 0; k < meshInfo.instanceTransforms_.size(); ++k) {
+                    const int node = sceneGraph_->AddNode(modelNode,
+                        modelName + "/mesh" + std::to_string(i) + "#" + std::to_string(k));
+                    sceneGraph_->SetLocalTransform(node, meshInfo.instanceTransforms_[k]);
+                    sceneGraph_->AddMeshReference(node, objectIndex, meshInfo.materialIndex_);
+                    instanceNodes[i].push_back(node);
+                }
+            }
+            sceneGraph_->RecalculateGlobalTransforms();
+        }
 
         // Create render objects for each sub-mesh.
-        for (const auto& meshInfo : loadedObjects) {
+        const size_t firstNewObject = staticObjects_.size();
+        size_t instanceCount = 0;
+        for (size_t i = 0; i < loadedObjects.size(); ++i) {
+            const auto& meshInfo = loadedObjects[i];
+            if (!instanceNodes[i].empty()) {
+                std::vector<glm::mat4> transforms;
+                transforms.reserve(instanceNodes[i].size());
+                for (int node : instanceNodes[i]) {
+                    transforms.push_back(sceneGraph_->GetNodes()[node].globalTransform_);
+                }
+                instanceCount += transforms.size();
+                staticObjects_.push_back(std::make_shared<InstancedRenderObject>(
+                    meshInfo.mesh_,
+                    meshLayout,
+                    meshInfo.materialIndex_,
+                    shaderName,
+                    std::move(transforms)
+                ));
+                continue;
+            }
             auto renderObj = std::make_shared<StaticRenderObject>(
                 meshInfo.mesh_,
                 meshLayout,
@@ -112,9 +164,14 @@ namespace Scene {
         }
 
         lastShaderName_ = shaderName;
-        staticBatchesDirty_ = true;
+        pendingStaticObjects_.insert(pendingStaticObjects_.end(),
+            staticObjects_.begin() + static_cast<std::ptrdiff_t>(firstNewObject), staticObjects_.end());
 
         Logger::GetLogger()->info("Loaded static model '{}' with {} sub-mesh(es).", modelName, loadedObjects.size());
+        if (instanceCount > 0) {
+            Logger::GetLogger()->info("Model '{}' draws {} instance(s) of {} mesh(es).",
+                modelName, instanceCount, loadedObjects.size());
+        }
         return true;
     }
 
@@ -141,7 +198,7 @@ namespace Scene {
         );
 
         staticObjects_.push_back(renderObj);
-        staticBatchesDirty_ = true;
+        pendingStaticObjects_.push_back(renderObj);
 
         Logger::GetLogger()->info("Loaded primitive '{}' successfully.", primitiveName);
         return true;
@@ -149,19 +206,34 @@ namespace Scene {
 
     void Scene::BuildStaticBatchesIfNeeded()
     {
-        if (!staticBatchesDirty_)
+        if (!staticBatchesDirty_ && pendingStaticObjects_.empty() && !staticObjectsRemoved_)
             return;
 
-        Logger::GetLogger()->info("Building static batches.");
-
-        staticBatchesDirty_ = false;
-        if (staticBatchManager_) {
-            staticBatchManager_->Clear();
-            for (const auto& renderObj : staticObjects_) {
+        if (staticBatchesDirty_) {
+            Logger::GetLogger()->info("Building static batches.");
+
+            staticBatchesDirty_ = false;
+            pendingStaticObjects_.clear();
+            if (staticBatchManager_) {
+                staticBatchManager_->Clear();
+                for (const auto& renderObj : staticObjects_) {
+                    staticBatchManager_->AddRenderObject(renderObj);
+                }
+                staticBatchManager_->BuildBatches();
+            }
+        }
+        else if (staticBatchManager_) {
+            // Objects loaded after the first build go into the existing batches.
+            if (!pendingStaticObjects_.empty()) {
+                Logger::GetLogger()->info("Adding {} static object(s) to the batches.", pendingStaticObjects_.size());
+            }
+            for (const auto& renderObj : pendingStaticObjects_) {
                 staticBatchManager_->AddRenderObject(renderObj);
             }
-            staticBatchManager_->BuildBatches();
+            pendingStaticObjects_.clear();
+            staticBatchManager_->CompactBatches();
         }
+        staticObjectsRemoved_ = false;
 
         // If shadows are enabled, update the light manager's bounding box.
         if (turnOnShadows_) {
@@ -170,6 +242,24 @@ namespace Scene {
         }
     }
 
+    bool Scene::RemoveStaticObject(const std::shared_ptr<BaseRenderObject>& renderObject)
+    {
+        auto it = std::find(staticObjects_.begin(), staticObjects_.end(), renderObject);
+        if (it == staticObjects_.end())
+            return false;
+        staticObjects_.erase(it);
+
+        auto pendingIt = std::find(pendingStaticObjects_.begin(), pendingStaticObjects_.end(), renderObject);
+        if (pendingIt != pendingStaticObjects_.end()) {
+            pendingStaticObjects_.erase(pendingIt);
+        }
+        else if (staticBatchManager_ && !staticBatchesDirty_) {
+            staticBatchManager_->RemoveRenderObject(renderObject);
+        }
+        staticObjectsRemoved_ = true;
+        return true;
+    }
+
     const std::vector<std::shared_ptr<renderer::Batch>>& Scene::GetStaticBatches() const
     {
         return staticBatchManager_->GetBatches();
@@ -187,16 +277,18 @@ namespace Scene {
         frameData.proj_ = camera_->GetProjectionMatrix();
         frameData.cameraPos_ = glm::vec4(camera_->GetPosition(), 1.0f);
 
-        frameDataUBO_->UpdateData(
+        frameDataRange_ = frameDataRing_->Write(
             { reinterpret_cast<const std::byte*>(&frameData), sizeof(frameData) },
-            0
+            graphics::PersistentRingBuffer::GetOffsetAlignment(GL_UNIFORM_BUFFER)
         );
         Logger::GetLogger()->debug("Updated frame data UBO.");
     }
 
     void Scene::BindFrameDataUBO() const
     {
-        frameDataUBO_->Bind();
+        if (frameDataRange_.size_ > 0) {
+            frameDataRing_->BindRange(GL_UNIFORM_BUFFER, FRAME_DATA_BINDING_POINT, frameDataRange_);
+        }
         Logger::GetLogger()->debug("Bound frame data UBO.");
     }
 
@@ -211,9 +303,23 @@ namespace Scene {
         frustumCuller_->ExtractFrustumPlanes(VP);
         Logger::GetLogger()->debug("Extracted frustum planes.");
 
+        // Pick up any LODs finished by background workers since the last frame. The meshes may be
+        // shared with other scenes, which may have published them already.
+        auto& lodStreamer = StaticLoader::LODStreamer::GetInstance();
+        lodStreamer.PublishCompleted();
+
         if (staticBatchManager_) {
+            staticBatchManager_->AppendStreamedLODs(lodStreamer.GetPublishCount());
+            // Release CPU geometry only once no worker reads the meshes anymore.
+            if (lodStreamer.GetPendingCount() == 0) {
+                staticBatchManager_->ApplyMeshResidency();
+            }
             staticBatchManager_->UpdateLODs(camera_, *lodEvaluator_);
             Logger::GetLogger()->debug("Updated LODs for static batches.");
+            if (clusterCulling_) {
+                staticBatchManager_->CullClusters(*frustumCuller_, camera_->GetPosition());
+            }
+            staticBatchManager_->SortBatches(camera_->GetPosition(), camera_->GetFarPlane());
         }
     }
 
@@ -240,6 +346,12 @@ namespace Scene {
 
             glm::vec3 localMin = renderObj->GetMesh()->minBounds_;
             glm::vec3 localMax = renderObj->GetMesh()->maxBounds_;
+            if (std::dynamic_pointer_cast<InstancedRenderObject>(renderObj)) {
+                // Mesh bounds are in mesh space; use the sphere enclosing all instances.
+                const glm::vec3 extent(renderObj->GetBoundingSphereRadius());
+                localMin = renderObj->GetWorldCenter() - extent;
+                localMax = renderObj->GetWorldCenter() + extent;
+            }
 
             worldBox.combinePoint(localMin);
             worldBox.combinePoint(localMax);
@@ -10,11 +10,14 @@
 #include "Renderer/Batch.h"
 #include "Renderer/BatchManager.h"
 #include "Graphics/Buffers/UniformBuffer.h"
+#include "Graphics/Buffers/PersistentRingBuffer.h"
 #include "Graphics/Buffers/ShaderStorageBuffer.h"
 #include "Scene/Camera.h"
 #include "Scene/FrustumCuller.h"
 #include "Scene/LODEvaluator.h"
 #include "Scene/SceneGraph.h"
+#include "Graphics/Meshes/MeshOptimizer.h"
+#include "Graphics/Meshes/ModelRegistry.h"
 #include "LightManager.h"
 #include "Graphics/Effects/PostProcessingEffects/PostProcessingEffectType.h"
 
@@ -72,10 +75,20 @@ namespace Scene {
             int materialID = 0
         );
 
-        /// Builds static render batches if there have been changes.
+        /// Builds static render batches on first use; later loads and removals update them incrementally.
         void BuildStaticBatchesIfNeeded();
+        /// Removes a static object from the scene and its batch; false if the scene does not own it.
+        bool RemoveStaticObject(const std::shared_ptr<BaseRenderObject>& renderObject);
+        /// Returns the static objects, in load order.
+        const std::vector<std::shared_ptr<BaseRenderObject>>& GetStaticObjects() const { return staticObjects_; }
         /// Returns the static render batches.
         const std::vector<std::shared_ptr<renderer::Batch>>& GetStaticBatches() const;
+        /// Returns the static render batches in this frame's sort-key order (see BatchManager::SortBatches).
+        const std::vector<std::shared_ptr<renderer::Batch>>& GetStaticDrawOrder() const { return staticBatchManager_->GetDrawOrder(); }
+        /// Objects of the blended static batches this frame, farthest first.
+        const std::vector<BatchManager::BlendedDraw>& GetStaticBlendedDraws() const { return staticBatchManager_->GetBlendedDraws(); }
+        /// Shader/material/VAO switches of the static batches this frame, before and after sorting.
+        const renderer::DrawOrderStats& GetDrawOrderStats() const { return staticBatchManager_->GetDrawOrderStats(); }
 
         /// Updates the per-frame UBO with current camera/view data.
         void UpdateFrameDataUBO() const;
@@ -112,6 +125,28 @@ namespace Scene {
         void SetShadowMapSize(int shadowSize) { shadowMapSize_ = shadowSize; }
         int GetShadowMapSize() const { return shadowMapSize_; }
 
+        /// When enabled, models are shown with LOD0 first and coarse LODs stream in from background workers.
+        void SetDeferredLODGeneration(bool enable) { deferredLODs_ = enable; }
+        bool GetDeferredLODGeneration() const { return deferredLODs_; }
+
+        /// When enabled, models are split into meshlets and static batches draw only the clusters
+        /// passing the frustum and backface-cone tests.
+        void SetClusterCulling(bool enable) { clusterCulling_ = enable; }
+        bool GetClusterCulling() const { return clusterCulling_; }
+
+        /// What loaded meshes keep in CPU memory once static batches are uploaded (see graphics::MeshResidency).
+        void SetMeshResidency(graphics::MeshResidency residency) { staticBatchManager_->SetMeshResidency(residency); }
+        graphics::MeshResidency GetMeshResidency() const { return staticBatchManager_->GetMeshResidency(); }
+
+        /// Draw command uploads of the static batches since the last reset (commands changed vs. uploads issued).
+        renderer::CommandUploadStats GetCommandUploadStats() const { return staticBatchManager_->GetCommandUploadStats(); }
+        void ResetCommandUploadStats() { staticBatchManager_->ResetCommandUploadStats(); }
+
+        /// Aggregated LOD0 optimization stats per model (only for models imported without the mesh cache).
+        const std::unordered_map<std::string, StaticLoader::MeshOptimizationStats>& GetModelOptimizationStats() const {
+            return modelOptimizationStats_;
+        }
+
     private:
         // Scene graph for dynamic/hierarchical objects.
         std::unique_ptr<SceneGraph> sceneGraph_;
@@ -121,7 +156,10 @@ namespace Scene {
 
         // List of static render objects.
         std::vector<std::shared_ptr<BaseRenderObject>> staticObjects_;
+        // Objects loaded since the batches were built; added incrementally unless a full rebuild is due.
+        std::vector<std::shared_ptr<BaseRenderObject>> pendingStaticObjects_;
         bool staticBatchesDirty_ = true;
+        bool staticObjectsRemoved_ = false;
 
         // Manager for batching static render objects.
         std::unique_ptr<BatchManager> staticBatchManager_;
@@ -129,8 +167,9 @@ namespace Scene {
         // The active camera.
         std::shared_ptr<Camera> camera_;
 
-        // UBO for per-frame data (e.g. view/projection matrices).
-        std::unique_ptr<graphics::UniformBuffer> frameDataUBO_;
+        // Per-frame data (e.g. view/projection matrices): a persistently mapped ring, bound as a UBO range.
+        std::unique_ptr<graphics::PersistentRingBuffer> frameDataRing_;
+        mutable graphics::PersistentRingBuffer::Range frameDataRange_;
 
         // SSBO for per-object data (e.g. model matrices).
         std::unique_ptr<graphics::ShaderStorageBuffer> objectDataSSBO_;
@@ -143,6 +182,12 @@ namespace Scene {
         // Active post-processing effect.
         PostProcessingEffectType postProcessingEffect_ = PostProcessingEffectType::None;
 
+        // Registry entries this scene draws from; holding them keeps the shared geometry resident.
+        std::vector<std::shared_ptr<const StaticLoader::LoadedModel>> loadedModels_;
+
+        // LOD0 optimization results per model name.
+        std::unordered_map<std::string, StaticLoader::MeshOptimizationStats> modelOptimizationStats_;
+
         // Cache for last used shader name.
         std::string lastShaderName_;
 
@@ -151,11 +196,15 @@ namespace Scene {
         bool showGrid_ = false;
         bool showDebugLights_ = false;
         bool turnOnShadows_ = false;
+        bool deferredLODs_ = true;
+        bool clusterCulling_ = true;
 
         int shadowMapSize_ = 1024;
 
         // Binding points for the UBO and SSBO.
         static constexpr GLuint FRAME_DATA_BINDING_POINT = 0;
+        // Frame data uploads one frame may make before its ring region is full.
+        static constexpr GLsizeiptr FRAME_DATA_WRITES_PER_FRAME = 4;
     };
 
 } // namespace Scene
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include "Utilities/DirtyBitset.h"
+
+#include <bit>
+
+void DirtyBitset::Reset(std::size_t count) {
+    words_.assign((count + 63) / 64, 0);
+    dirtyCount_ = 0;
+}
+
+void DirtyBitset::Mark(std::size_t index) {
+    const std::size_t word = index / 64;
+    if (word >= words_.size()) {
+        words_.resize(word + 1, 0);
+    }
+    const uint64_t bit = uint64_t{ 1 } << (index % 64);
+    if ((words_[word] & bit) == 0) {
+        words_[word] |= bit;
+        ++dirtyCount_;
+    }
+}
+
+std::size_t DirtyBitset::Flush(std::size_t maxGap, const std::function<void(std::size_t, std::size_t)>& fn) {
+    if (dirtyCount_ == 0) {
+        return 0;
+    }
+
+    std::size_t ranges = 0;
+    std::size_t rangeFirst = 0;
+    std::size_t rangeEnd = 0;       // One past the last dirty element of the open range.
+    bool open = false;
+    for (std::size_t w = 0; w < words_.size(); ++w) {
+        uint64_t bits = words_[w];
+        while (bits != 0) {
+            const std::size_t index = w * 64 + static_cast<std::size_t>(std::countr_zero(bits));
+            bits &= bits - 1;
+            if (open && index - rangeEnd <= maxGap) {
+                rangeEnd = index + 1;
+                continue;
+            }
+            if (open) {
+                fn(rangeFirst, rangeEnd - rangeFirst);
+                ++ranges;
+            }
+            rangeFirst = index;
+            rangeEnd = index + 1;
+            open = true;
+        }
+        words_[w] = 0;
+    }
+    if (open) {
+        fn(rangeFirst, rangeEnd - rangeFirst);
+        ++ranges;
+    }
+    dirtyCount_ = 0;
+    return ranges;
+}
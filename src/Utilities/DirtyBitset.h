@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief One dirty bit per element of a CPU shadow copy, flushed as merged [first, first + count) ranges.
+ *
+ * Callers mark elements as they change and walk the ranges once before the data is used,
+ * so many single-element edits become a few contiguous uploads. Not thread-safe.
+ */
+class DirtyBitset {
+public:
+    DirtyBitset() = default;
+
+    /// Resizes to @p count elements; all bits are cleared.
+    void Reset(std::size_t count);
+
+    /// Marks element @p index dirty (grows the set if needed).
+    void Mark(std::size_t index);
+
+    bool Any() const { return dirtyCount_ > 0; }
+    /// Number of distinct dirty elements.
+    std::size_t Count() const { return dirtyCount_; }
+
+    /**
+     * @brief Calls @p fn(first, count) for every dirty range in ascending order, then clears all bits.
+     * @param maxGap Clean runs of at most this many elements between two dirty ones are merged into one range.
+     * @return the number of ranges emitted.
+     */
+    std::size_t Flush(std::size_t maxGap, const std::function<void(std::size_t, std::size_t)>& fn);
+
+private:
+    std::vector<uint64_t> words_;
+    std::size_t dirtyCount_ = 0;
+};
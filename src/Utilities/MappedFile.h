@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+/**
+ * @brief Read-only memory mapping of a whole file (RAII).
+ *
+ * Wraps CreateFileMapping/MapViewOfFile on Windows and mmap elsewhere so that
+ * large binary blobs can be consumed without copying them through a stream.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::filesystem::path& path) { Open(path); }
+    ~MappedFile() { Close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /// Maps the file; returns false if it cannot be opened or is empty.
+    bool Open(const std::filesystem::path& path);
+    void Close();
+
+    bool IsOpen() const { return data_ != nullptr; }
+    const std::byte* Data() const { return data_; }
+    std::size_t Size() const { return size_; }
+    std::span<const std::byte> Bytes() const { return { data_, size_ }; }
+
+private:
+    const std::byte* data_ = nullptr;
+    std::size_t size_ = 0;
+#ifdef _WIN32
+    void* fileHandle_ = nullptr;
+    void* mappingHandle_ = nullptr;
+#else
+    int fd_ = -1;
+#endif
+};
@@ -0,0 +1,43 @@
+#include "Utilities/RadixSort.h"
+
+#include <array>
+#include <cstddef>
+
+void RadixSort(std::vector<SortKeyEntry>& entries, std::vector<SortKeyEntry>& scratch) {
+    const std::size_t count = entries.size();
+    if (count < 2) {
+        return;
+    }
+    scratch.resize(count);
+
+    constexpr int kBytes = sizeof(uint64_t);
+    std::array<std::array<std::size_t, 256>, kBytes> histograms{};
+    for (const auto& entry : entries) {
+        for (int b = 0; b < kBytes; ++b) {
+            ++histograms[b][(entry.key_ >> (b * 8)) & 0xFF];
+        }
+    }
+
+    bool inScratch = false;
+    for (int b = 0; b < kBytes; ++b) {
+        const auto& src = inScratch ? scratch : entries;
+        auto& dst = inScratch ? entries : scratch;
+        auto& offsets = histograms[b];
+        if (offsets[(src.front().key_ >> (b * 8)) & 0xFF] == count) {
+            continue; // Every key has this byte: the pass would not move anything.
+        }
+        std::size_t offset = 0;
+        for (auto& bucket : offsets) {
+            const std::size_t size = bucket;
+            bucket = offset;
+            offset += size;
+        }
+        for (const auto& entry : src) {
+            dst[offsets[(entry.key_ >> (b * 8)) & 0xFF]++] = entry;
+        }
+        inScratch = !inScratch;
+    }
+    if (inScratch) {
+        entries.swap(scratch);
+    }
+}
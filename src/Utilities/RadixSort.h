@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/// A 64-bit sort key and the index of the item it orders.
+struct SortKeyEntry {
+    uint64_t key_ = 0;
+    uint32_t index_ = 0;
+};
+
+/**
+ * @brief Stable LSD radix sort of @p entries by ascending key_, one byte per pass.
+ *
+ * A single counting pass builds the histograms of all eight key bytes; bytes that are equal
+ * in every entry (e.g. unused high fields) are skipped. @p scratch is resized to the entry
+ * count and can be kept by the caller to avoid reallocating every frame.
+ */
+void RadixSort(std::vector<SortKeyEntry>& entries, std::vector<SortKeyEntry>& scratch);
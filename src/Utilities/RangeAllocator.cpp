@@ -0,0 +1,75 @@
+#include "Utilities/RangeAllocator.h"
+
+#include <algorithm>
+#include <iterator>
+
+void RangeAllocator::Reset(std::size_t capacity, std::size_t usedPrefix) {
+    usedPrefix = std::min(usedPrefix, capacity);
+    free_.clear();
+    capacity_ = capacity;
+    used_ = usedPrefix;
+    if (capacity > usedPrefix) {
+        free_.emplace(usedPrefix, capacity - usedPrefix);
+    }
+}
+
+std::size_t RangeAllocator::Allocate(std::size_t size) {
+    if (size == 0) {
+        return 0;
+    }
+    for (auto it = free_.begin(); it != free_.end(); ++it) {
+        if (it->second < size) {
+            continue;
+        }
+        const std::size_t offset = it->first;
+        const std::size_t remaining = it->second - size;
+        free_.erase(it);
+        if (remaining > 0) {
+            free_.emplace(offset + size, remaining);
+        }
+        used_ += size;
+        return offset;
+    }
+    return kInvalid;
+}
+
+void RangeAllocator::Free(std::size_t offset, std::size_t size) {
+    if (size == 0 || offset == kInvalid) {
+        return;
+    }
+    used_ -= std::min(size, used_);
+
+    // Merge with the free block that follows and the one that precedes.
+    auto next = free_.lower_bound(offset);
+    if (next != free_.end() && next->first == offset + size) {
+        size += next->second;
+        next = free_.erase(next);
+    }
+    if (next != free_.begin()) {
+        auto prev = std::prev(next);
+        if (prev->first + prev->second == offset) {
+            prev->second += size;
+            return;
+        }
+    }
+    free_.emplace(offset, size);
+}
+
+void RangeAllocator::Grow(std::size_t newCapacity) {
+    if (newCapacity <= capacity_) {
+        return;
+    }
+    const std::size_t oldCapacity = capacity_;
+    capacity_ = newCapacity;
+    // Free() also merges the new tail with a free block ending at the old capacity.
+    used_ += newCapacity - oldCapacity;
+    Free(oldCapacity, newCapacity - oldCapacity);
+}
+
+std::size_t RangeAllocator::GetLargestFree() const {
+    std::size_t largest = 0;
+    for (const auto& [offset, size] : free_) {
+        largest = std::max(largest, size);
+    }
+    return largest;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+
+/**
+ * @brief First-fit free-list allocator of [offset, offset + size) ranges inside a growable capacity.
+ *
+ * Units are up to the caller (vertices, indices, bytes). Freed ranges are coalesced with
+ * their neighbours and Grow() appends free space at the end, so a caller can back it with
+ * a GPU buffer that is reallocated (and copied) when Allocate fails. Not thread-safe.
+ */
+class RangeAllocator {
+public:
+    static constexpr std::size_t kInvalid = static_cast<std::size_t>(-1);
+
+    RangeAllocator() = default;
+
+    /// Forgets every allocation: [0, usedPrefix) is allocated, the rest of @p capacity is free.
+    void Reset(std::size_t capacity, std::size_t usedPrefix = 0);
+
+    /// @return the offset of a free range of @p size units, or kInvalid if no free range fits.
+    std::size_t Allocate(std::size_t size);
+
+    /// Returns a range obtained from Allocate (or from the used prefix of Reset).
+    void Free(std::size_t offset, std::size_t size);
+
+    /// Extends the capacity; the new space is free (and merged with a free tail).
+    void Grow(std::size_t newCapacity);
+
+    std::size_t GetCapacity() const { return capacity_; }
+    std::size_t GetUsed() const { return used_; }
+    std::size_t GetFree() const { return capacity_ - used_; }
+    std::size_t GetLargestFree() const;
+    std::size_t GetFreeBlockCount() const { return free_.size(); }
+
+    /// Free space outside the largest free block, i.e. what only compaction can make usable again.
+    std::size_t GetFragmentedFree() const { return GetFree() - GetLargestFree(); }
+
+private:
+    std::map<std::size_t, std::size_t> free_;   ///< offset -> size, non-adjacent.
+    std::size_t capacity_ = 0;
+    std::size_t used_ = 0;
+};
@@ -0,0 +1,175 @@
+#include "Utilities/ThreadPool.h"
+
+#include <algorithm>
+#include <exception>
+
+namespace {
+    // Index of the pool worker running on this thread (npos for foreign threads).
+    constexpr std::size_t kNotAWorker = static_cast<std::size_t>(-1);
+    thread_local std::size_t tlsWorkerIndex = kNotAWorker;
+    thread_local const ThreadPool* tlsWorkerPool = nullptr;
+}
+
+ThreadPool::ThreadPool(std::size_t threadCount) {
+    threadCount = std::max<std::size_t>(1, threadCount);
+    queues_.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        queues_.push_back(std::make_unique<WorkerQueue>());
+    }
+    workers_.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        workers_.emplace_back([this, i]() { WorkerLoop(i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        stop_ = true;
+    }
+    wakeCv_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+ThreadPool& ThreadPool::GetInstance() {
+    static ThreadPool instance;
+    return instance;
+}
+
+std::size_t ThreadPool::DefaultThreadCount() {
+    const unsigned hw = std::thread::hardware_concurrency();
+    return hw > 1 ? hw - 1 : 1;
+}
+
+void ThreadPool::Enqueue(Task task) {
+    // Workers push onto their own deque; everyone else spreads work round-robin.
+    const std::size_t target = (tlsWorkerPool == this)
+        ? tlsWorkerIndex
+        : nextQueue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    {
+        std::lock_guard<std::mutex> lock(queues_[target]->mutex_);
+        queues_[target]->tasks_.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        ++pendingTasks_;
+    }
+    wakeCv_.notify_one();
+}
+
+void ThreadPool::EnqueueBackground(Task task) {
+    {
+        std::lock_guard<std::mutex> lock(background_.mutex_);
+        background_.tasks_.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        ++pendingTasks_;
+    }
+    wakeCv_.notify_one();
+}
+
+bool ThreadPool::PopBackground(Task& out) {
+    std::lock_guard<std::mutex> lock(background_.mutex_);
+    if (background_.tasks_.empty()) {
+        return false;
+    }
+    out = std::move(background_.tasks_.front());
+    background_.tasks_.pop_front();
+    return true;
+}
+
+bool ThreadPool::PopLocal(std::size_t index, Task& out) {
+    auto& queue = *queues_[index];
+    std::lock_guard<std::mutex> lock(queue.mutex_);
+    if (queue.tasks_.empty()) {
+        return false;
+    }
+    out = std::move(queue.tasks_.back());
+    queue.tasks_.pop_back();
+    return true;
+}
+
+bool ThreadPool::Steal(std::size_t thief, Task& out) {
+    const std::size_t count = queues_.size();
+    for (std::size_t offset = 1; offset <= count; ++offset) {
+        auto& victim = *queues_[(thief + offset) % count];
+        std::lock_guard<std::mutex> lock(victim.mutex_);
+        if (!victim.tasks_.empty()) {
+            out = std::move(victim.tasks_.front());
+            victim.tasks_.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ThreadPool::RunPendingTask() {
+    Task task;
+    const bool isWorker = (tlsWorkerPool == this);
+    const std::size_t self = isWorker ? tlsWorkerIndex : 0;
+    if ((isWorker && PopLocal(self, task)) || Steal(self, task)) {
+        --pendingTasks_;
+        task();
+        return true;
+    }
+    return false;
+}
+
+void ThreadPool::WorkerLoop(std::size_t index) {
+    tlsWorkerIndex = index;
+    tlsWorkerPool = this;
+    while (true) {
+        Task task;
+        if (PopLocal(index, task) || Steal(index, task) || PopBackground(task)) {
+            --pendingTasks_;
+            task();
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        wakeCv_.wait(lock, [this]() { return stop_ || pendingTasks_ > 0; });
+        if (stop_ && pendingTasks_ == 0) {
+            return;
+        }
+    }
+}
+
+void ThreadPool::ParallelFor(std::size_t count, const std::function<void(std::size_t)>& body) {
+    if (count == 0) {
+        return;
+    }
+
+    std::atomic<std::size_t> remaining{ count };
+    std::exception_ptr firstError;
+    std::mutex errorMutex;
+
+    for (std::size_t i = 0; i < count; ++i) {
+        Enqueue([&, i]() {
+            try {
+                body(i);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!firstError) {
+                    firstError = std::current_exception();
+                }
+            }
+            remaining.fetch_sub(1, std::memory_order_acq_rel);
+        });
+    }
+
+    // Help out instead of sleeping; the remaining tasks may be running elsewhere.
+    while (remaining.load(std::memory_order_acquire) > 0) {
+        if (!RunPendingTask()) {
+            std::this_thread::yield();
+        }
+    }
+
+    if (firstError) {
+        std::rethrow_exception(firstError);
+    }
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Work-stealing thread pool.
+ *
+ * Every worker owns a deque: it pops its own work LIFO (cache friendly) and,
+ * when empty, steals FIFO from the other workers. Tasks submitted from outside
+ * the pool are distributed round-robin. Threads that wait on pool work
+ * (ParallelFor) execute pending tasks instead of blocking.
+ *
+ * Long-running background work (SubmitBackground) sits in a separate FIFO that
+ * only idle workers drain: waiting threads never pick it up, so a frame or a
+ * load cannot stall behind it.
+ */
+class ThreadPool {
+public:
+    using Task = std::function<void()>;
+
+    explicit ThreadPool(std::size_t threadCount = DefaultThreadCount());
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// Process-wide pool sized to the hardware (minus the main thread).
+    static ThreadPool& GetInstance();
+    static std::size_t DefaultThreadCount();
+
+    std::size_t GetThreadCount() const { return workers_.size(); }
+
+    /// Queues a callable and returns a future for its result.
+    template <typename F>
+    auto Submit(F&& func) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+        using R = std::invoke_result_t<std::decay_t<F>>;
+        auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(func));
+        auto future = task->get_future();
+        Enqueue([task]() { (*task)(); });
+        return future;
+    }
+
+    /// Like Submit, but runs only on workers with no foreground work left (never inside RunPendingTask).
+    template <typename F>
+    auto SubmitBackground(F&& func) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+        using R = std::invoke_result_t<std::decay_t<F>>;
+        auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(func));
+        auto future = task->get_future();
+        EnqueueBackground([task]() { (*task)(); });
+        return future;
+    }
+
+    /**
+     * @brief Runs body(i) for i in [0, count) across the pool and waits for completion.
+     *
+     * The calling thread helps with the work. The first exception thrown by a
+     * body is rethrown here after all iterations have finished.
+     */
+    void ParallelFor(std::size_t count, const std::function<void(std::size_t)>& body);
+
+    /// Executes one queued foreground task on the calling thread, if any. @return true if a task ran.
+    bool RunPendingTask();
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex_;
+        std::deque<Task> tasks_;
+    };
+
+    void Enqueue(Task task);
+    void EnqueueBackground(Task task);
+    void WorkerLoop(std::size_t index);
+    bool PopLocal(std::size_t index, Task& out);
+    bool Steal(std::size_t thief, Task& out);
+    bool PopBackground(Task& out);
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+    WorkerQueue background_;
+    std::vector<std::thread> workers_;
+
+    std::mutex wakeMutex_;
+    std::condition_variable wakeCv_;
+    std::atomic<std::size_t> pendingTasks_{ 0 };
+    std::atomic<std::size_t> nextQueue_{ 0 };
+    std::atomic<bool> stop_{ false };
+};
@@ -13,4 +13,5 @@
 //#include "TestPBR.h"
 #include "TestComputeShader.h"
 #include "TestComputeShader.h"
-#include "TestDamagedHelmet.h"
\ No newline at end of file
+#include "TestDamagedHelmet.h"
+#include "TestBatchBenchmark.h"
\ No newline at end of file
@@ -0,0 +1,130 @@
+#include "TestBatchBenchmark.h"
+#include "Renderer/BatchManager.h"
+#include "Renderer/RenderObject.h"
+#include "Graphics/Materials/MaterialManager.h"
+#include "Resources/MeshManager.h"
+#include "Resources/ResourceManager.h"
+#include "Utilities/Logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <imgui.h>
+
+namespace {
+    constexpr const char* kShaderName = "simpleLightsShadowed";
+    constexpr std::size_t kObjectCounts[] = { 1'000, 10'000, 100'000 };
+    constexpr int kRepetitions = 5;
+
+    using Clock = std::chrono::steady_clock;
+
+    double NanosecondsPerObject(Clock::time_point start, std::size_t objectCount) {
+        const std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+        return elapsed.count() / static_cast<double>(objectCount);
+    }
+
+    /// The cube primitive plus a coarser LOD1 (its first two triangles), so LOD switches change commands.
+    std::shared_ptr<graphics::Mesh> MakeTwoLODCube() {
+        auto mesh = std::make_shared<graphics::Mesh>(*graphics::MeshManager::GetInstance().GetMesh("cube"));
+        graphics::MeshLOD lod1;
+        lod1.indexOffset_ = static_cast<uint32_t>(mesh->indices_.size());
+        lod1.indexCount_ = 6;
+        mesh->indices_.insert(mesh->indices_.end(), mesh->indices_.begin(), mesh->indices_.begin() + 6);
+        mesh->lods_.push_back(lod1);
+        return mesh;
+    }
+
+    int BenchmarkMaterialID(const MaterialLayout& matLayout) {
+        auto& materialManager = graphics::MaterialManager::GetInstance();
+        if (auto id = materialManager.GetMaterialIDByName("batchBenchmarkMat")) {
+            return static_cast<int>(*id);
+        }
+        auto material = std::make_unique<graphics::Material>(matLayout);
+        material->SetName("batchBenchmarkMat");
+        material->AssignToPackedParams(MaterialParamType::Diffuse, glm::vec3(0.8f));
+        return static_cast<int>(materialManager.AddMaterial(std::move(material)).value_or(0));
+    }
+}
+
+TestBatchBenchmark::Result TestBatchBenchmark::Measure(std::size_t objectCount) {
+    auto [meshLayout, matLayout] = ResourceManager::GetInstance().GetLayoutsFromShader(kShaderName);
+    const int materialID = BenchmarkMaterialID(matLayout);
+    const auto mesh = MakeTwoLODCube();
+
+    std::vector<std::shared_ptr<BaseRenderObject>> objects;
+    objects.reserve(objectCount);
+    for (std::size_t i = 0; i < objectCount; ++i) {
+        objects.push_back(std::make_shared<StaticRenderObject>(mesh, meshLayout, materialID, kShaderName));
+    }
+
+    Result result;
+    result.objects_ = objectCount;
+
+    BatchManager batchManager;
+    const auto buildStart = Clock::now();
+    for (const auto& object : objects) {
+        batchManager.AddRenderObject(object);
+    }
+    batchManager.BuildBatches();
+    result.buildMilliseconds_ = std::chrono::duration<double, std::milli>(Clock::now() - buildStart).count();
+    result.batches_ = batchManager.GetBatches().size();
+
+    result.updateLODNanoseconds_ = result.cullNanoseconds_ = 1e30;
+    for (int repetition = 0; repetition < kRepetitions; ++repetition) {
+        // LOD1 then back to LOD0: every call changes the object's draw command.
+        auto start = Clock::now();
+        for (const auto& object : objects) {
+            batchManager.UpdateLOD(object, 1);
+        }
+        for (const auto& object : objects) {
+            batchManager.UpdateLOD(object, 0);
+        }
+        result.updateLODNanoseconds_ = std::min(result.updateLODNanoseconds_, NanosecondsPerObject(start, 2 * objectCount));
+
+        start = Clock::now();
+        for (const auto& object : objects) {
+            batchManager.CullObject(object);
+        }
+        result.cullNanoseconds_ = std::min(result.cullNanoseconds_, NanosecondsPerObject(start, objectCount));
+        // The next repetition's switch to LOD1 restores the culled commands.
+    }
+    return result;
+}
+
+void TestBatchBenchmark::RunBenchmark() {
+    results_.clear();
+    for (std::size_t objectCount : kObjectCounts) {
+        const Result result = Measure(objectCount);
+        Logger::GetLogger()->info("BatchBenchmark: {} objects in {} batch(es), built in {:.1f} ms; "
+            "UpdateLOD {:.1f} ns/object, CullObject {:.1f} ns/object.",
+            result.objects_, result.batches_, result.buildMilliseconds_,
+            result.updateLODNanoseconds_, result.cullNanoseconds_);
+        results_.push_back(result);
+    }
+}
+
+void TestBatchBenchmark::OnImGuiRender()
+{
+    ImGui::Begin("Batch Benchmark");
+    ImGui::TextWrapped("UpdateLOD / CullObject cost per object (best of %d passes).", kRepetitions);
+    if (ImGui::Button("Run (1k, 10k, 100k objects)")) {
+        RunBenchmark();
+    }
+    if (!results_.empty() && ImGui::BeginTable("BatchBenchmarkResults", 5, ImGuiTableFlags_Borders)) {
+        ImGui::TableSetupColumn("Objects");
+        ImGui::TableSetupColumn("Batches");
+        ImGui::TableSetupColumn("Build (ms)");
+        ImGui::TableSetupColumn("UpdateLOD (ns)");
+        ImGui::TableSetupColumn("CullObject (ns)");
+        ImGui::TableHeadersRow();
+        for (const auto& result : results_) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::Text("%zu", result.objects_);
+            ImGui::TableNextColumn(); ImGui::Text("%zu", result.batches_);
+            ImGui::TableNextColumn(); ImGui::Text("%.1f", result.buildMilliseconds_);
+            ImGui::TableNextColumn(); ImGui::Text("%.1f", result.updateLODNanoseconds_);
+            ImGui::TableNextColumn(); ImGui::Text("%.1f", result.cullNanoseconds_);
+        }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
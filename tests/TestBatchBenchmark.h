@@ -0,0 +1,32 @@
+#pragma once
+#include "Test.h"
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * Times BatchManager::UpdateLOD and BatchManager::CullObject on 1k, 10k and 100k synthetic
+ * static objects. Both go through the objects' BatchHandles, so the time per object should
+ * stay flat as the count grows.
+ */
+class TestBatchBenchmark : public Test {
+public:
+    TestBatchBenchmark() = default;
+    ~TestBatchBenchmark() override = default;
+
+    void OnImGuiRender() override;
+
+private:
+    struct Result {
+        std::size_t objects_ = 0;
+        std::size_t batches_ = 0;
+        double buildMilliseconds_ = 0.0;
+        double updateLODNanoseconds_ = 0.0;     ///< Per object, best of kRepetitions passes.
+        double cullNanoseconds_ = 0.0;          ///< Per object, best of kRepetitions passes.
+    };
+
+    void RunBenchmark();
+    Result Measure(std::size_t objectCount);
+
+    std::vector<Result> results_;
+};
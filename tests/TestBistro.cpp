@@ -33,7 +33,7 @@ void TestBistro::OnEnter() {
     //    return;
     //}
 
-    if (!scene_->LoadStaticModelIntoScene("bistroExterior", "bistroShaderShadowed", 0.01)) {
+    if (!scene_->LoadStaticModelIntoScene("bistroExterior", "bistroShaderShadowedQuantized", 0.01)) {
         Logger::GetLogger()->error("Failed to load 'bistroExterior' model in TestBistro");
         return;
     }
@@ -0,0 +1,181 @@
+#include "UnitTest.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <vector>
+
+#include "Graphics/Meshes/BoundingVolumes.h"
+#include "Graphics/Meshes/ObjImporter.h"
+
+using namespace graphics;
+
+namespace {
+
+    constexpr SphereFit kFits[] = { SphereFit::BoxDiagonal, SphereFit::Ritter, SphereFit::EPOS };
+
+    glm::vec3 PointAt(const std::vector<float>& positions3f, std::size_t v) {
+        return glm::vec3(positions3f[v * 3], positions3f[v * 3 + 1], positions3f[v * 3 + 2]);
+    }
+
+    /// Largest distance by which a point lies outside @p sphere, relative to its radius (<= 0 when contained).
+    float SphereOvershoot(const std::vector<float>& positions3f, const BoundingSphere& sphere) {
+        float worst = -1.0f;
+        for (std::size_t v = 0; v < positions3f.size() / 3; ++v) {
+            worst = std::max(worst, glm::length(PointAt(positions3f, v) - sphere.center_) - sphere.radius_);
+        }
+        return worst / std::max(sphere.radius_, 1e-6f);
+    }
+
+    /// Same for @p box, relative to its largest half extent.
+    float BoxOvershoot(const std::vector<float>& positions3f, const OrientedBox& box) {
+        float worst = -1.0f;
+        for (std::size_t v = 0; v < positions3f.size() / 3; ++v) {
+            const glm::vec3 d = PointAt(positions3f, v) - box.center_;
+            for (int axis = 0; axis < 3; ++axis) {
+                worst = std::max(worst, std::abs(glm::dot(d, box.axes_[axis])) - box.halfExtents_[axis]);
+            }
+        }
+        const float extent = std::max({ box.halfExtents_.x, box.halfExtents_.y, box.halfExtents_.z });
+        return worst / std::max(extent, 1e-6f);
+    }
+
+    float AxisAlignedVolume(const std::vector<float>& positions3f) {
+        glm::vec3 min(FLT_MAX), max(-FLT_MAX);
+        for (std::size_t v = 0; v < positions3f.size() / 3; ++v) {
+            min = glm::min(min, PointAt(positions3f, v));
+            max = glm::max(max, PointAt(positions3f, v));
+        }
+        const glm::vec3 size = max - min;
+        return size.x * size.y * size.z;
+    }
+
+    /// Box of the given proportions, filled with random points and rotated off the coordinate axes.
+    std::vector<float> RotatedCloud(const glm::vec3& halfSize, std::size_t count, uint32_t seed) {
+        const glm::vec3 a = glm::normalize(glm::vec3(1.0f, 1.0f, 0.0f));
+        const glm::vec3 b = glm::normalize(glm::vec3(-1.0f, 1.0f, 1.0f));
+        const glm::vec3 c = glm::cross(a, b);
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::vector<float> positions3f;
+        for (std::size_t i = 0; i < count; ++i) {
+            const glm::vec3 p = glm::vec3(3.0f, -2.0f, 5.0f) +
+                a * (unit(rng) * halfSize.x) + b * (unit(rng) * halfSize.y) + c * (unit(rng) * halfSize.z);
+            positions3f.insert(positions3f.end(), { p.x, p.y, p.z });
+        }
+        return positions3f;
+    }
+
+    /// Checks every fitted volume of @p positions3f; @return the EPOS radius over the box-diagonal radius.
+    float CheckVolumes(const std::vector<float>& positions3f) {
+        constexpr float kTolerance = 1e-5f;
+        const BoundingSphere diagonal = ComputeBoundingSphere(positions3f, {}, SphereFit::BoxDiagonal);
+        for (SphereFit fit : kFits) {
+            const BoundingSphere sphere = ComputeBoundingSphere(positions3f, {}, fit);
+            CHECK(SphereOvershoot(positions3f, sphere) <= kTolerance);
+            CHECK(sphere.radius_ <= diagonal.radius_ * (1.0f + kTolerance));
+        }
+        const OrientedBox box = ComputeOrientedBox(positions3f);
+        CHECK(box.IsValid());
+        CHECK(BoxOvershoot(positions3f, box) <= kTolerance);
+        CHECK(box.Volume() <= AxisAlignedVolume(positions3f) * (1.0f + kTolerance));
+        for (int i = 0; i < 3; ++i) {
+            CHECK_NEAR(glm::length(box.axes_[i]), 1.0f, 1e-4f);
+            CHECK_NEAR(glm::dot(box.axes_[i], box.axes_[(i + 1) % 3]), 0.0f, 1e-4f);
+        }
+        return ComputeBoundingSphere(positions3f, {}, SphereFit::EPOS).radius_ / diagonal.radius_;
+    }
+
+}
+
+TEST_CASE(BoundingVolumesContainRandomClouds) {
+    CheckVolumes(RotatedCloud(glm::vec3(1.0f), 5000, 1));
+    CheckVolumes(RotatedCloud(glm::vec3(4.0f, 1.0f, 0.25f), 5000, 2));
+}
+
+TEST_CASE(FittedSpheresAreTighterThanTheBoxDiagonal) {
+    // Points on a sphere: the half-diagonal sphere is sqrt(3) times the minimal one.
+    std::mt19937 rng(3);
+    std::normal_distribution<float> normal;
+    std::vector<float> shell;
+    for (int i = 0; i < 5000; ++i) {
+        const glm::vec3 p = glm::vec3(-1.0f, 4.0f, 2.0f) + 2.0f * glm::normalize(glm::vec3(normal(rng), normal(rng), normal(rng)));
+        shell.insert(shell.end(), { p.x, p.y, p.z });
+    }
+    const float radiusRatio = CheckVolumes(shell);
+    CHECK(radiusRatio < 0.65f);
+    CHECK(ComputeBoundingSphere(shell, {}, SphereFit::EPOS).radius_ < 2.0f * 1.05f);
+}
+
+TEST_CASE(OrientedBoxesAreTighterOnRotatedPlanks) {
+    // A thin plank off the coordinate axes: its AABB is mostly empty.
+    const auto plank = RotatedCloud(glm::vec3(5.0f, 0.5f, 0.05f), 5000, 4);
+    CheckVolumes(plank);
+    CHECK(ComputeOrientedBox(plank).Volume() < 0.1f * AxisAlignedVolume(plank));
+}
+
+TEST_CASE(IndexedSpheresOnlyEncloseReferencedVertices) {
+    // Two far-apart clusters; the indices reference only the first one.
+    std::vector<float> positions3f = RotatedCloud(glm::vec3(1.0f), 100, 5);
+    const auto far = RotatedCloud(glm::vec3(1.0f), 100, 6);
+    for (std::size_t i = 0; i < far.size(); ++i) {
+        positions3f.push_back(far[i] + (i % 3 == 0 ? 100.0f : 0.0f));
+    }
+    std::vector<uint32_t> indices(100);
+    for (uint32_t i = 0; i < 100; ++i) {
+        indices[i] = i;
+    }
+    const std::vector<float> firstCluster(positions3f.begin(), positions3f.begin() + 300);
+    for (SphereFit fit : kFits) {
+        const BoundingSphere sphere = ComputeBoundingSphere(positions3f, indices, fit);
+        CHECK(SphereOvershoot(firstCluster, sphere) <= 1e-5f);
+        CHECK(sphere.radius_ < 10.0f);
+    }
+}
+
+TEST_CASE(DegeneratePointSetsStayValid) {
+    const std::vector<float> single = { 1.0f, 2.0f, 3.0f };
+    for (SphereFit fit : kFits) {
+        const BoundingSphere sphere = ComputeBoundingSphere(single, {}, fit);
+        CHECK(sphere.center_ == glm::vec3(1.0f, 2.0f, 3.0f));
+        CHECK(sphere.radius_ == 0.0f);
+    }
+    const OrientedBox box = ComputeOrientedBox(single);
+    CHECK(box.IsValid());
+    CHECK(BoxOvershoot(single, box) <= 0.0f);
+}
+
+TEST_CASE(BoundingVolumesContainTheSampleModels) {
+    const std::filesystem::path objs = unittest::AssetPath("Objs");
+    int checked = 0;
+    for (const char* name : { "bunny.obj", "dragon.obj", "pig_triangulated.obj" }) {
+        const auto path = objs / name;
+        if (!std::filesystem::exists(path)) {
+            continue;
+        }
+        StaticLoader::ObjModel model;
+        CHECK(StaticLoader::ObjImporter().Import(path, model));
+        double diagonalVolume = 0.0, sphereVolume = 0.0, aabbVolume = 0.0, boxVolume = 0.0;
+        for (const auto& mesh : model.meshes_) {
+            std::vector<float> positions3f;
+            positions3f.reserve(mesh.positions_.size() * 3);
+            for (const auto& p : mesh.positions_) {
+                positions3f.insert(positions3f.end(), { p.x, p.y, p.z });
+            }
+            CheckVolumes(positions3f);
+            diagonalVolume += ComputeBoundingSphere(positions3f, {}, SphereFit::BoxDiagonal).Volume();
+            sphereVolume += ComputeBoundingSphere(positions3f, {}, SphereFit::EPOS).Volume();
+            aabbVolume += AxisAlignedVolume(positions3f);
+            boxVolume += ComputeOrientedBox(positions3f).Volume();
+        }
+        std::printf("  %s: EPOS sphere %.1f%% of the half-diagonal sphere volume, OBB %.1f%% of the AABB\n",
+            name, 100.0 * sphereVolume / diagonalVolume, 100.0 * boxVolume / aabbVolume);
+        ++checked;
+    }
+    if (checked == 0) {
+        unittest::Skip("no sample models under " + objs.string());
+    }
+}
@@ -0,0 +1,82 @@
+#include "UnitTest.h"
+
+#include <utility>
+#include <vector>
+
+#include "Utilities/DirtyBitset.h"
+
+namespace {
+
+    using Ranges = std::vector<std::pair<std::size_t, std::size_t>>;
+
+    Ranges FlushAll(DirtyBitset& bits, std::size_t maxGap, std::size_t* returned = nullptr) {
+        Ranges ranges;
+        const std::size_t count = bits.Flush(maxGap, [&ranges](std::size_t first, std::size_t n) { ranges.push_back({ first, n }); });
+        if (returned) *returned = count;
+        return ranges;
+    }
+
+}
+
+TEST_CASE(DirtyBitsetCountsDistinctElements) {
+    DirtyBitset bits;
+    bits.Reset(10);
+    CHECK(!bits.Any());
+    bits.Mark(3);
+    bits.Mark(3);
+    bits.Mark(9);
+    CHECK(bits.Any());
+    CHECK(bits.Count() == 2);
+}
+
+TEST_CASE(DirtyBitsetMergesRangesWithinTheGap) {
+    DirtyBitset bits;
+    bits.Reset(256);
+    for (std::size_t i : { 5, 6, 7, 10, 40, 63, 64, 65 }) {
+        bits.Mark(i);
+    }
+    std::size_t returned = 0;
+    CHECK(FlushAll(bits, 0, &returned) == Ranges({ { 5, 3 }, { 10, 1 }, { 40, 1 }, { 63, 3 } }));
+    CHECK(returned == 4);
+    CHECK(!bits.Any());
+
+    for (std::size_t i : { 5, 6, 7, 10, 40, 63, 64, 65 }) {
+        bits.Mark(i);
+    }
+    // 7 -> 10 leaves a gap of 2 clean elements; 10 -> 40 a gap of 29.
+    CHECK(FlushAll(bits, 2) == Ranges({ { 5, 6 }, { 40, 1 }, { 63, 3 } }));
+}
+
+TEST_CASE(DirtyBitsetFlushClearsEverything) {
+    DirtyBitset bits;
+    bits.Reset(8);
+    bits.Mark(1);
+    FlushAll(bits, 0);
+    CHECK(bits.Count() == 0);
+    std::size_t returned = 1;
+    CHECK(FlushAll(bits, 0, &returned).empty());
+    CHECK(returned == 0);
+}
+
+TEST_CASE(DirtyBitsetGrowsOnMark) {
+    DirtyBitset bits;
+    bits.Reset(4);
+    bits.Mark(1000);
+    bits.Mark(2);
+    CHECK(bits.Count() == 2);
+    CHECK(FlushAll(bits, 0) == Ranges({ { 2, 1 }, { 1000, 1 } }));
+
+    bits.Mark(7);
+    bits.Reset(16);
+    CHECK(!bits.Any());
+    CHECK(FlushAll(bits, 0).empty());
+}
+
+TEST_CASE(DirtyBitsetRangesAcrossWordBoundaries) {
+    DirtyBitset bits;
+    bits.Reset(300);
+    for (std::size_t i = 60; i < 200; ++i) {
+        bits.Mark(i);
+    }
+    CHECK(FlushAll(bits, 0) == Ranges({ { 60, 140 } }));
+}
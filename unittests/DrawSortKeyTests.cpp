@@ -0,0 +1,58 @@
+#include "UnitTest.h"
+
+#include "Renderer/DrawSortKey.h"
+
+using namespace renderer;
+
+TEST_CASE(DrawSortKeyOrdersFieldsByPriority) {
+    namespace key = DrawSortKey;
+    // Each field outranks everything less significant, even at its maximum value.
+    CHECK(key::Make(1, 0, 0, 0, 0) > key::Make(0, 0xFFF, 0xFFFF, 0xFF, 0xFFFFFF));
+    CHECK(key::Make(0, 1, 0, 0, 0) > key::Make(0, 0, 0xFFFF, 0xFF, 0xFFFFFF));
+    CHECK(key::Make(0, 0, 1, 0, 0) > key::Make(0, 0, 0, 0xFF, 0xFFFFFF));
+    CHECK(key::Make(0, 0, 0, 1, 0) > key::Make(0, 0, 0, 0, 0xFFFFFF));
+    CHECK(key::Make(0, 0, 0, 0, 1) > key::Make(0, 0, 0, 0, 0));
+
+    // Queues sort opaque, alpha tested, blended.
+    CHECK(key::Make(static_cast<uint32_t>(RenderQueue::Opaque), 5, 5, 5, 5) <
+        key::Make(static_cast<uint32_t>(RenderQueue::AlphaTested), 0, 0, 0, 0));
+    CHECK(key::Make(static_cast<uint32_t>(RenderQueue::AlphaTested), 5, 5, 5, 5) <
+        key::Make(static_cast<uint32_t>(RenderQueue::Blended), 0, 0, 0, 0));
+}
+
+TEST_CASE(DrawSortKeyPlacesFieldsAtTheirShifts) {
+    namespace key = DrawSortKey;
+    CHECK(key::Make(0xA, 0xBCD, 0x1234, 0x56, 0x789ABC) == 0xABCD123456789ABCull);
+    CHECK(key::kDepthShift == 0 && key::kFormatShift == 24 && key::kMaterialShift == 32 &&
+        key::kShaderShift == 48 && key::kPassShift == 60);
+}
+
+TEST_CASE(DrawSortKeyTruncatesWideFields) {
+    namespace key = DrawSortKey;
+    // Overflowing values wrap inside their own field and never touch a neighbour.
+    CHECK(key::Make(0, 0x1001, 0, 0, 0) == key::Make(0, 0x001, 0, 0, 0));
+    CHECK(key::Make(0, 0, 0x10000, 0, 0) == 0);
+    CHECK(key::Make(0, 0, 0, 0x1FF, 0) == key::Make(0, 0, 0, 0xFF, 0));
+    CHECK(key::Make(0, 0, 0, 0, 0xFFFFFFFF) == 0xFFFFFF);
+}
+
+TEST_CASE(DepthBucketIsMonotonicAndClamped) {
+    namespace key = DrawSortKey;
+    constexpr uint32_t kMaxBucket = (1u << key::kDepthBits) - 1;
+    CHECK(key::DepthBucket(0.0f, 100.0f) == 0);
+    CHECK(key::DepthBucket(100.0f, 100.0f) == kMaxBucket);
+    CHECK(key::DepthBucket(250.0f, 100.0f) == kMaxBucket);
+    CHECK(key::DepthBucket(-5.0f, 100.0f) == 0);
+    CHECK(key::DepthBucket(10.0f, 0.0f) == 0);      // No far plane yet.
+
+    uint32_t previous = 0;
+    bool monotonic = true;
+    for (int i = 0; i <= 1000; ++i) {
+        const uint32_t bucket = key::DepthBucket(static_cast<float>(i) * 0.1f, 100.0f);
+        monotonic &= bucket >= previous;
+        previous = bucket;
+    }
+    CHECK(monotonic);
+    // Objects 1 cm apart at 100 m still get distinct buckets.
+    CHECK(key::DepthBucket(50.0f, 100.0f) < key::DepthBucket(50.01f, 100.0f));
+}
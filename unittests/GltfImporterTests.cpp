@@ -0,0 +1,206 @@
+#include "UnitTest.h"
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "Graphics/Meshes/GltfImporter.h"
+
+using namespace StaticLoader;
+
+namespace {
+
+    // A unit quad in the XY plane: 4 float3 positions (48 bytes), then 6 uint16 indices (12 bytes).
+    const float kPositions[] = { 0, 0, 0,  1, 0, 0,  1, 1, 0,  0, 1, 0 };
+    const uint16_t kIndices[] = { 0, 1, 2,  0, 2, 3 };
+
+    std::vector<std::byte> QuadBuffer() {
+        std::vector<std::byte> bytes(sizeof(kPositions) + sizeof(kIndices));
+        std::memcpy(bytes.data(), kPositions, sizeof(kPositions));
+        std::memcpy(bytes.data() + sizeof(kPositions), kIndices, sizeof(kIndices));
+        return bytes;
+    }
+
+    /// Document with one quad mesh placed by a translated node; @p buffer is the "buffers" entry.
+    std::string QuadDocument(const std::string& buffer, int mode = 4, bool withIndices = true) {
+        const std::string indices = withIndices ? R"(, "indices": 1)" : "";
+        return R"({
+  "asset": { "version": "2.0" },
+  "scene": 0,
+  "scenes": [ { "nodes": [ 0 ] } ],
+  "nodes": [ { "mesh": 0, "translation": [ 1, 2, 3 ] } ],
+  "meshes": [ { "name": "quad", "primitives": [ { "attributes": { "POSITION": 0 })" + indices +
+            R"(, "mode": )" + std::to_string(mode) + R"( } ] } ],
+  "accessors": [
+    { "bufferView": 0, "componentType": 5126, "count": 4, "type": "VEC3" },
+    { "bufferView": 1, "componentType": 5123, "count": 6, "type": "SCALAR" }
+  ],
+  "bufferViews": [
+    { "buffer": 0, "byteOffset": 0, "byteLength": 48 },
+    { "buffer": 0, "byteOffset": 48, "byteLength": 12 }
+  ],
+  "buffers": [ )" + buffer + R"( ]
+})";
+    }
+
+    std::filesystem::path TestDirectory() {
+        const auto dir = std::filesystem::temp_directory_path() / "OpenGLPlaygroundTests" / "gltf";
+        std::filesystem::create_directories(dir);
+        return dir;
+    }
+
+    void WriteFile(const std::filesystem::path& path, const void* data, std::size_t size) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    }
+
+    void WriteFile(const std::filesystem::path& path, const std::string& text) {
+        WriteFile(path, text.data(), text.size());
+    }
+
+    std::vector<std::byte> ReadFile(const std::filesystem::path& path) {
+        std::ifstream file(path, std::ios::binary);
+        std::vector<char> chars((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        std::vector<std::byte> bytes(chars.size());
+        std::memcpy(bytes.data(), chars.data(), chars.size());
+        return bytes;
+    }
+
+    std::string Base64(const std::vector<std::byte>& bytes) {
+        static const char* kAlphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        std::string out;
+        for (std::size_t i = 0; i < bytes.size(); i += 3) {
+            uint32_t chunk = static_cast<uint32_t>(bytes[i]) << 16;
+            if (i + 1 < bytes.size()) chunk |= static_cast<uint32_t>(bytes[i + 1]) << 8;
+            if (i + 2 < bytes.size()) chunk |= static_cast<uint32_t>(bytes[i + 2]);
+            out += kAlphabet[(chunk >> 18) & 63];
+            out += kAlphabet[(chunk >> 12) & 63];
+            out += i + 1 < bytes.size() ? kAlphabet[(chunk >> 6) & 63] : '=';
+            out += i + 2 < bytes.size() ? kAlphabet[chunk & 63] : '=';
+        }
+        return out;
+    }
+
+    /// GLB container: 12-byte header, JSON chunk (space padded), BIN chunk (zero padded).
+    std::vector<std::byte> MakeGlb(std::string json, std::vector<std::byte> bin) {
+        while (json.size() % 4 != 0) json += ' ';
+        while (bin.size() % 4 != 0) bin.push_back(std::byte{ 0 });
+        const uint32_t total = static_cast<uint32_t>(12 + 8 + json.size() + 8 + bin.size());
+        std::vector<std::byte> out;
+        auto append = [&out](const void* data, std::size_t size) {
+            const auto* bytes = static_cast<const std::byte*>(data);
+            out.insert(out.end(), bytes, bytes + size);
+            };
+        const uint32_t header[3] = { 0x46546C67, 2, total };
+        append(header, sizeof(header));
+        const uint32_t jsonChunk[2] = { static_cast<uint32_t>(json.size()), 0x4E4F534A };
+        append(jsonChunk, sizeof(jsonChunk));
+        append(json.data(), json.size());
+        const uint32_t binChunk[2] = { static_cast<uint32_t>(bin.size()), 0x004E4942 };
+        append(binChunk, sizeof(binChunk));
+        append(bin.data(), bin.size());
+        return out;
+    }
+
+    /// The quad as every variant of the document should produce it.
+    void CheckQuad(const GltfModel& model) {
+        CHECK(model.primitives_.size() == 1);
+        CHECK(model.placements_.size() == 1);
+        CHECK(model.materials_.size() == 1);    // The default material.
+        if (model.primitives_.size() != 1 || model.placements_.size() != 1) {
+            return;
+        }
+        const SourceMesh& source = model.primitives_[0].source_;
+        CHECK(model.primitives_[0].name_ == "quad");
+        CHECK(source.vertexCount_ == 4);
+        CHECK(source.indices_ == std::vector<uint32_t>({ 0, 1, 2, 0, 2, 3 }));
+        for (std::size_t i = 0; i < 4; ++i) {
+            CHECK(source.positions_[i] == glm::vec3(kPositions[i * 3], kPositions[i * 3 + 1], kPositions[i * 3 + 2]));
+        }
+        // Normals are generated for a primitive without NORMAL: +Z for a CCW quad in XY.
+        CHECK(static_cast<bool>(source.normals_));
+        if (source.normals_) {
+            for (std::size_t i = 0; i < 4; ++i) {
+                CHECK(glm::length(source.normals_[i] - glm::vec3(0.0f, 0.0f, 1.0f)) < 1e-6f);
+            }
+        }
+        const glm::mat4& world = model.placements_[0].transform_;
+        CHECK(world[3] == glm::vec4(1.0f, 2.0f, 3.0f, 1.0f));
+    }
+
+}
+
+TEST_CASE(GltfReadsExternalPercentEncodedBuffers) {
+    const auto dir = TestDirectory();
+    const auto buffer = QuadBuffer();
+    WriteFile(dir / "quad data.bin", buffer.data(), buffer.size());
+    const auto path = dir / "external.gltf";
+    WriteFile(path, QuadDocument(R"({ "uri": "quad%20data.bin", "byteLength": 60 })"));
+
+    GltfModel model;
+    CHECK(GltfImporter().Import(path, model));
+    CheckQuad(model);
+    CHECK(model.mappedBuffers_.size() == 1);
+
+    // The mesh cache hashes exactly the buffers Import() maps.
+    const auto referenced = GltfImporter::ReferencedFiles(path, ReadFile(path));
+    CHECK(referenced.size() == 1);
+    CHECK(!referenced.empty() && referenced[0] == dir / "quad data.bin");
+}
+
+TEST_CASE(GltfReadsDataUriBuffers) {
+    const auto dir = TestDirectory();
+    const auto path = dir / "embedded.gltf";
+    WriteFile(path, QuadDocument(R"({ "uri": "data:application/octet-stream;base64,)" + Base64(QuadBuffer()) +
+        R"(", "byteLength": 60 })"));
+
+    GltfModel model;
+    CHECK(GltfImporter().Import(path, model));
+    CheckQuad(model);
+    CHECK(model.decodedBuffers_.size() == 1);
+    CHECK(GltfImporter::ReferencedFiles(path, ReadFile(path)).empty());
+}
+
+TEST_CASE(GltfReadsTheGlbBinChunk) {
+    const auto dir = TestDirectory();
+    const auto path = dir / "binary.glb";
+    const auto glb = MakeGlb(QuadDocument(R"({ "byteLength": 60 })"), QuadBuffer());
+    WriteFile(path, glb.data(), glb.size());
+
+    GltfModel model;
+    CHECK(GltfImporter().Import(path, model));
+    CheckQuad(model);
+    CHECK(model.mappedBuffers_.empty());
+    CHECK(GltfImporter::ReferencedFiles(path, glb).empty());
+}
+
+TEST_CASE(GltfConvertsTriangleStrips) {
+    const auto dir = TestDirectory();
+    const auto buffer = QuadBuffer();
+    WriteFile(dir / "strip.bin", buffer.data(), buffer.size());
+    const auto path = dir / "strip.gltf";
+    // Non-indexed strip (0, 1, 2, 3): the odd triangle is flipped to keep the winding.
+    WriteFile(path, QuadDocument(R"({ "uri": "strip.bin", "byteLength": 60 })", 5, false));
+
+    GltfModel model;
+    CHECK(GltfImporter().Import(path, model));
+    CHECK(model.primitives_.size() == 1);
+    if (!model.primitives_.empty()) {
+        CHECK(model.primitives_[0].source_.indices_ == std::vector<uint32_t>({ 0, 1, 2, 2, 1, 3 }));
+    }
+}
+
+TEST_CASE(GltfFailsOnAMissingBuffer) {
+    const auto dir = TestDirectory();
+    const auto path = dir / "missing.gltf";
+    WriteFile(path, QuadDocument(R"({ "uri": "does-not-exist.bin", "byteLength": 60 })"));
+
+    GltfModel model;
+    CHECK(!GltfImporter().Import(path, model));
+    // Still reported, so the cache key changes once the file appears.
+    CHECK(GltfImporter::ReferencedFiles(path, ReadFile(path)).size() == 1);
+}
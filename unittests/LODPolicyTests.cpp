@@ -0,0 +1,107 @@
+#include "UnitTest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Graphics/Meshes/LODPolicy.h"
+
+using namespace StaticLoader;
+
+namespace {
+
+    constexpr uint32_t kGridSide = 65;     // 64 x 64 quads, 8192 triangles.
+
+    /// A gently curved unit heightfield, so every level has some error to report.
+    struct GridMesh {
+        std::vector<float> positions3f_;
+        std::vector<uint32_t> indices_;
+    };
+
+    GridMesh MakeGrid() {
+        GridMesh grid;
+        for (uint32_t y = 0; y < kGridSide; ++y) {
+            for (uint32_t x = 0; x < kGridSide; ++x) {
+                const float u = static_cast<float>(x) / (kGridSide - 1);
+                const float v = static_cast<float>(y) / (kGridSide - 1);
+                grid.positions3f_.insert(grid.positions3f_.end(),
+                    { u, v, 0.05f * std::sin(u * 6.0f) * std::cos(v * 5.0f) });
+            }
+        }
+        for (uint32_t y = 0; y + 1 < kGridSide; ++y) {
+            for (uint32_t x = 0; x + 1 < kGridSide; ++x) {
+                const uint32_t i = y * kGridSide + x;
+                grid.indices_.insert(grid.indices_.end(), { i, i + 1, i + kGridSide + 1, i, i + kGridSide + 1, i + kGridSide });
+            }
+        }
+        return grid;
+    }
+
+}
+
+TEST_CASE(LODChainReducesTrianglesAndAccumulatesError) {
+    const GridMesh grid = MakeGrid();
+    LODPolicy policy;
+    policy.sloppyFallback_ = false;     // Keeps every step within its budget (see below).
+    const auto chain = GenerateLODChain(grid.indices_, grid.positions3f_, {}, policy);
+
+    CHECK(chain.size() > 1);
+    CHECK(chain.size() <= policy.maxLevels_);
+    CHECK(!chain.empty() && chain[0].indices_ == grid.indices_);
+    CHECK(!chain.empty() && chain[0].error_ == 0.0f);
+    const std::size_t vertexCount = grid.positions3f_.size() / 3;
+    for (std::size_t level = 1; level < chain.size(); ++level) {
+        const auto& previous = chain[level - 1];
+        const auto& current = chain[level];
+        CHECK(current.indices_.size() % 3 == 0);
+        CHECK(current.indices_.size() <= previous.indices_.size() * policy.maxTriangleRatio_);
+        CHECK(current.error_ >= previous.error_);
+        // The grid spans one unit, so errors are directly comparable to the relative limit.
+        CHECK(current.error_ <= policy.maxRelativeError_);
+        CHECK(std::all_of(current.indices_.begin(), current.indices_.end(),
+            [vertexCount](uint32_t index) { return index < vertexCount; }));
+    }
+}
+
+TEST_CASE(LODChainRespectsMaxLevels) {
+    const GridMesh grid = MakeGrid();
+    LODPolicy policy;
+    policy.maxLevels_ = 2;
+    const auto chain = GenerateLODChain(grid.indices_, grid.positions3f_, {}, policy);
+    CHECK(chain.size() <= 2);
+}
+
+TEST_CASE(LODChainKeepsSmallMeshesAtLOD0) {
+    const GridMesh grid = MakeGrid();
+    LODPolicy policy;
+    policy.minTriangles_ = static_cast<uint32_t>(grid.indices_.size() / 3);
+    const auto chain = GenerateLODChain(grid.indices_, grid.positions3f_, {}, policy);
+    CHECK(chain.size() == 1);
+    CHECK(GenerateLODChain({}, grid.positions3f_, {}, LODPolicy{}).size() == 1);
+}
+
+TEST_CASE(LODAttributesFollowTheWeightedChannels) {
+    graphics::Mesh mesh;
+    mesh.positions_ = { {0, 0, 0}, {1, 0, 0}, {0, 1, 0} };
+    mesh.normals_ = { {0, 0, 1}, {0, 1, 0}, {1, 0, 0} };
+    mesh.uvs_ = { { {0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f} } };
+
+    LODPolicy policy;
+    policy.normalWeight_ = 0.5f;
+    policy.uvWeight_ = 0.1f;
+    const LODAttributes both = GatherLODAttributes(mesh, policy);
+    CHECK(both.floatsPerVertex_ == 5);
+    CHECK(both.weights_ == std::vector<float>({ 0.5f, 0.5f, 0.5f, 0.1f, 0.1f }));
+    CHECK(both.data_.size() == 15);
+    // Vertex 1: normal (0, 1, 0) then UV (1, 0).
+    CHECK(std::vector<float>(both.data_.begin() + 5, both.data_.begin() + 10) ==
+        std::vector<float>({ 0.0f, 1.0f, 0.0f, 1.0f, 0.0f }));
+
+    policy.uvWeight_ = 0.0f;
+    CHECK(GatherLODAttributes(mesh, policy).floatsPerVertex_ == 3);
+
+    // A weighted attribute the mesh lacks is skipped rather than read as zeros.
+    mesh.normals_.clear();
+    CHECK(GatherLODAttributes(mesh, policy).floatsPerVertex_ == 0);
+    CHECK(GatherLODAttributes(mesh, policy).data_.empty());
+}
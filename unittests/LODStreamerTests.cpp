@@ -0,0 +1,117 @@
+#include "UnitTest.h"
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Graphics/Meshes/LODStreamer.h"
+
+using namespace StaticLoader;
+
+namespace {
+
+    /// Two triangles (a quad) with LOD0 covering both.
+    std::shared_ptr<graphics::Mesh> MakeQuadMesh() {
+        auto mesh = std::make_shared<graphics::Mesh>();
+        mesh->positions_ = { {0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0} };
+        mesh->indices_ = { 0, 1, 2, 0, 2, 3 };
+        graphics::MeshLOD lod0;
+        lod0.indexCount_ = 6;
+        mesh->lods_.push_back(lod0);
+        return mesh;
+    }
+
+    /// The result of draining the streamer like the render loop does, once per "frame".
+    struct Drained {
+        std::vector<std::shared_ptr<graphics::Mesh>> published_;
+        std::uint64_t publishingCalls_ = 0;     ///< PublishCompleted() calls that returned meshes.
+        bool idle_ = false;
+    };
+
+    Drained PublishUntilIdle(LODStreamer& streamer) {
+        Drained drained;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (std::chrono::steady_clock::now() < deadline) {
+            auto meshes = streamer.PublishCompleted();
+            if (!meshes.empty()) {
+                ++drained.publishingCalls_;
+                drained.published_.insert(drained.published_.end(), meshes.begin(), meshes.end());
+            }
+            if (streamer.GetPendingCount() == 0) {
+                drained.idle_ = true;
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return drained;
+    }
+
+}
+
+TEST_CASE(LODStreamerAppendsChainsAndCountsPublications) {
+    auto& streamer = LODStreamer::GetInstance();
+    const std::uint64_t countBefore = streamer.GetPublishCount();
+    auto first = MakeQuadMesh();
+    auto second = MakeQuadMesh();
+    int completions = 0;
+
+    streamer.Submit({ first, second }, [](const graphics::Mesh&) {
+        LODLevel level;
+        level.indices_ = { 0, 1, 2 };
+        level.error_ = 0.25f;
+        level.bounds_ = { glm::vec3(0.5f, 0.5f, 0.0f), 0.75f };
+        return LODStreamer::LODChain{ level };
+        }, [&completions]() { ++completions; });
+
+    const Drained drained = PublishUntilIdle(streamer);
+    CHECK(drained.idle_);
+    CHECK(drained.published_.size() == 2);
+    CHECK(completions == 1);
+    // One increment per PublishCompleted() call that added LODs, however the two meshes were split.
+    CHECK(streamer.GetPublishCount() - countBefore == drained.publishingCalls_);
+    for (const auto& mesh : { first, second }) {
+        CHECK(mesh->lods_.size() == 2);
+        CHECK(mesh->indices_ == std::vector<uint32_t>({ 0, 1, 2, 0, 2, 3, 0, 1, 2 }));
+        if (mesh->lods_.size() == 2) {
+            CHECK(mesh->lods_[1].indexOffset_ == 6);
+            CHECK(mesh->lods_[1].indexCount_ == 3);
+            CHECK(mesh->lods_[1].error_ == 0.25f);
+            CHECK(mesh->lods_[1].radius_ == 0.75f);
+        }
+    }
+}
+
+TEST_CASE(LODStreamerDoesNotCountEmptyOrFailedChains) {
+    auto& streamer = LODStreamer::GetInstance();
+    const std::uint64_t countBefore = streamer.GetPublishCount();
+    auto empty = MakeQuadMesh();
+    auto failing = MakeQuadMesh();
+    int completions = 0;
+
+    streamer.Submit({ empty }, [](const graphics::Mesh&) { return LODStreamer::LODChain{}; },
+        [&completions]() { ++completions; });
+    streamer.Submit({ failing }, [](const graphics::Mesh&) -> LODStreamer::LODChain {
+        throw std::runtime_error("simplifier failed");
+        }, [&completions]() { ++completions; });
+
+    const Drained drained = PublishUntilIdle(streamer);
+    CHECK(drained.idle_);
+    CHECK(drained.published_.empty());
+    CHECK(completions == 2);
+    // Scenes compare this counter to decide whether to re-check their objects' LODs.
+    CHECK(streamer.GetPublishCount() == countBefore);
+    CHECK(empty->lods_.size() == 1);
+    CHECK(failing->lods_.size() == 1);
+    CHECK(failing->indices_.size() == 6);
+}
+
+TEST_CASE(LODStreamerCompletesAnEmptySubmissionImmediately) {
+    auto& streamer = LODStreamer::GetInstance();
+    bool completed = false;
+    streamer.Submit({}, [](const graphics::Mesh&) { return LODStreamer::LODChain{}; },
+        [&completed]() { completed = true; });
+    CHECK(completed);
+    CHECK(streamer.GetPendingCount() == 0);
+}
@@ -0,0 +1,74 @@
+#include "UnitTest.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "Utilities/RadixSort.h"
+
+namespace {
+
+    /// What RadixSort must produce: std::stable_sort by key_.
+    std::vector<SortKeyEntry> Reference(std::vector<SortKeyEntry> entries) {
+        std::stable_sort(entries.begin(), entries.end(),
+            [](const SortKeyEntry& a, const SortKeyEntry& b) { return a.key_ < b.key_; });
+        return entries;
+    }
+
+    bool SameOrder(const std::vector<SortKeyEntry>& a, const std::vector<SortKeyEntry>& b) {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(),
+            [](const SortKeyEntry& x, const SortKeyEntry& y) { return x.key_ == y.key_ && x.index_ == y.index_; });
+    }
+
+    std::vector<SortKeyEntry> RandomEntries(std::size_t count, uint64_t keyMask, uint32_t seed) {
+        std::mt19937_64 rng(seed);
+        std::vector<SortKeyEntry> entries(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            entries[i] = { rng() & keyMask, i };
+        }
+        return entries;
+    }
+
+}
+
+TEST_CASE(RadixSortMatchesStableSort) {
+    std::vector<SortKeyEntry> scratch;
+    // Full keys, few distinct keys (stability matters), and keys using only some bytes (skipped passes).
+    for (uint64_t mask : { ~uint64_t{ 0 }, uint64_t{ 0x7 }, uint64_t{ 0xFF0000FF00000000 }, uint64_t{ 0xFFFF } }) {
+        for (std::size_t count : { 2, 3, 100, 5000 }) {
+            auto entries = RandomEntries(count, mask, static_cast<uint32_t>(count ^ mask));
+            const auto expected = Reference(entries);
+            RadixSort(entries, scratch);
+            CHECK(SameOrder(entries, expected));
+        }
+    }
+}
+
+TEST_CASE(RadixSortHandlesTrivialInputs) {
+    std::vector<SortKeyEntry> scratch;
+    std::vector<SortKeyEntry> empty;
+    RadixSort(empty, scratch);
+    CHECK(empty.empty());
+
+    std::vector<SortKeyEntry> single = { { 42, 7 } };
+    RadixSort(single, scratch);
+    CHECK(single.size() == 1 && single[0].key_ == 42 && single[0].index_ == 7);
+
+    // Identical keys: every pass is skipped and the input order is kept.
+    auto same = RandomEntries(64, 0, 1);
+    const auto expected = same;
+    RadixSort(same, scratch);
+    CHECK(SameOrder(same, expected));
+}
+
+TEST_CASE(RadixSortReusesTheScratchBuffer) {
+    std::vector<SortKeyEntry> scratch;
+    auto entries = RandomEntries(1000, ~uint64_t{ 0 }, 2);
+    RadixSort(entries, scratch);
+    CHECK(scratch.size() == 1000);
+    // An odd number of passes swaps the buffers; sorting again from either must still work.
+    auto again = RandomEntries(1000, 0xFFFFFF, 3);
+    const auto expected = Reference(again);
+    RadixSort(again, scratch);
+    CHECK(SameOrder(again, expected));
+}
@@ -0,0 +1,109 @@
+#include "UnitTest.h"
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "Utilities/RangeAllocator.h"
+
+TEST_CASE(RangeAllocatorIsFirstFitAfterTheUsedPrefix) {
+    RangeAllocator allocator;
+    allocator.Reset(100, 10);
+    CHECK(allocator.GetUsed() == 10);
+    CHECK(allocator.Allocate(20) == 10);
+    CHECK(allocator.Allocate(30) == 30);
+    CHECK(allocator.Allocate(41) == RangeAllocator::kInvalid);
+    CHECK(allocator.Allocate(40) == 60);
+    CHECK(allocator.GetFree() == 0);
+    CHECK(allocator.GetFreeBlockCount() == 0);
+    CHECK(allocator.Allocate(1) == RangeAllocator::kInvalid);
+    CHECK(allocator.Allocate(0) == 0);      // Empty ranges never fail.
+}
+
+TEST_CASE(RangeAllocatorCoalescesFreedNeighbours) {
+    RangeAllocator allocator;
+    allocator.Reset(90);
+    const std::size_t a = allocator.Allocate(30);
+    const std::size_t b = allocator.Allocate(30);
+    const std::size_t c = allocator.Allocate(30);
+
+    allocator.Free(a, 30);
+    allocator.Free(c, 30);
+    CHECK(allocator.GetFreeBlockCount() == 2);
+    CHECK(allocator.GetLargestFree() == 30);
+    CHECK(allocator.GetFragmentedFree() == 30);
+    CHECK(allocator.Allocate(31) == RangeAllocator::kInvalid);
+
+    allocator.Free(b, 30);      // Joins both neighbours.
+    CHECK(allocator.GetFreeBlockCount() == 1);
+    CHECK(allocator.GetLargestFree() == 90);
+    CHECK(allocator.GetUsed() == 0);
+    CHECK(allocator.Allocate(90) == 0);
+}
+
+TEST_CASE(RangeAllocatorFirstFitReusesTheLowestHole) {
+    RangeAllocator allocator;
+    allocator.Reset(100);
+    const std::size_t a = allocator.Allocate(10);
+    allocator.Allocate(10);
+    const std::size_t c = allocator.Allocate(40);
+    allocator.Allocate(10);
+    allocator.Free(a, 10);
+    allocator.Free(c, 40);
+    CHECK(allocator.Allocate(5) == 0);      // The first hole that fits, not the best one.
+    CHECK(allocator.Allocate(20) == c);
+}
+
+TEST_CASE(RangeAllocatorGrowMergesTheFreeTail) {
+    RangeAllocator allocator;
+    allocator.Reset(50);
+    allocator.Allocate(40);
+    CHECK(allocator.Allocate(20) == RangeAllocator::kInvalid);
+    allocator.Grow(100);
+    CHECK(allocator.GetCapacity() == 100);
+    CHECK(allocator.GetFreeBlockCount() == 1);  // [40, 50) and [50, 100) merged.
+    CHECK(allocator.Allocate(60) == 40);
+    allocator.Grow(80);                         // Never shrinks.
+    CHECK(allocator.GetCapacity() == 100);
+}
+
+TEST_CASE(RangeAllocatorRandomAllocationsNeverOverlap) {
+    constexpr std::size_t kCapacity = 4096;
+    RangeAllocator allocator;
+    allocator.Reset(kCapacity);
+    std::vector<int> owner(kCapacity, -1);
+    std::vector<std::pair<std::size_t, std::size_t>> live;
+    std::mt19937 rng(7);
+    bool overlap = false;
+    for (int step = 0; step < 20000 && !overlap; ++step) {
+        if (live.empty() || rng() % 3 != 0) {
+            const std::size_t size = 1 + rng() % 64;
+            const std::size_t offset = allocator.Allocate(size);
+            if (offset == RangeAllocator::kInvalid) {
+                continue;
+            }
+            for (std::size_t i = offset; i < offset + size; ++i) {
+                overlap |= i >= kCapacity || owner[i] != -1;
+                if (i < kCapacity) owner[i] = step;
+            }
+            live.push_back({ offset, size });
+        }
+        else {
+            const std::size_t pick = rng() % live.size();
+            const auto [offset, size] = live[pick];
+            for (std::size_t i = offset; i < offset + size; ++i) owner[i] = -1;
+            allocator.Free(offset, size);
+            live[pick] = live.back();
+            live.pop_back();
+        }
+    }
+    CHECK(!overlap);
+    std::size_t used = 0;
+    for (const auto& range : live) used += range.second;
+    CHECK(allocator.GetUsed() == used);
+
+    for (const auto& [offset, size] : live) allocator.Free(offset, size);
+    CHECK(allocator.GetUsed() == 0);
+    CHECK(allocator.GetFreeBlockCount() == 1);
+    CHECK(allocator.GetLargestFree() == kCapacity);
+}
@@ -0,0 +1,81 @@
+#include "UnitTest.h"
+
+#include <stdexcept>
+
+#include "Graphics/Buffers/RingAllocator.h"
+
+using graphics::RingAllocator;
+
+namespace {
+
+    template <typename Fn>
+    bool ThrowsInvalidArgument(Fn&& fn) {
+        try {
+            fn();
+        }
+        catch (const std::invalid_argument&) {
+            return true;
+        }
+        return false;
+    }
+
+}
+
+TEST_CASE(RingAllocatorRejectsInvalidArguments) {
+    CHECK(ThrowsInvalidArgument([] { RingAllocator(0, 3); }));
+    CHECK(ThrowsInvalidArgument([] { RingAllocator(256, 0); }));
+    RingAllocator ring(256, 3);
+    CHECK(ThrowsInvalidArgument([&ring] { ring.Allocate(4, 0); }));
+    CHECK(ThrowsInvalidArgument([&ring] { ring.Allocate(4, 24); }));
+    CHECK(ring.GetUsed() == 0);
+    CHECK(ring.GetCapacity() == 768);
+}
+
+TEST_CASE(RingAllocatorPadsToTheAlignment) {
+    RingAllocator ring(256, 3);
+    CHECK(ring.Allocate(10) == 0);
+    CHECK(ring.Allocate(4, 16) == 16);
+    CHECK(ring.GetUsed() == 20);        // Padding counts as used.
+    CHECK(ring.Allocate(1, 256) == RingAllocator::kInvalid);   // Next multiple of 256 is the next region.
+    CHECK(ring.GetUsed() == 20);
+}
+
+TEST_CASE(RingAllocatorAlignsAbsoluteOffsetsAcrossRegionBoundaries) {
+    // Regions of 100 bytes start at 0, 100 and 200, none of them 64-byte aligned.
+    RingAllocator ring(100, 3);
+    ring.Advance();
+    CHECK(ring.GetRegionOffset(ring.GetRegion()) == 100);
+    CHECK(ring.Allocate(8, 64) == 128);
+    CHECK(ring.GetUsed() == 36);
+    CHECK(ring.Allocate(8, 64) == 192);
+    // 256 would be past the region end (200): no room, nothing consumed.
+    CHECK(ring.Allocate(1, 64) == RingAllocator::kInvalid);
+    CHECK(ring.GetUsed() == 100);
+    // Region [200, 300): padding to 256 leaves 44 bytes, so 45 fail and 44 fill it exactly.
+    ring.Advance();
+    CHECK(ring.Allocate(45, 256) == RingAllocator::kInvalid);
+    CHECK(ring.GetUsed() == 0);
+    CHECK(ring.Allocate(44, 256) == 256);
+    CHECK(ring.GetUsed() == 100);
+}
+
+TEST_CASE(RingAllocatorReturnsInvalidOnOverflow) {
+    RingAllocator ring(64, 2);
+    CHECK(ring.Allocate(65) == RingAllocator::kInvalid);
+    CHECK(ring.Allocate(60) == 0);
+    CHECK(ring.Allocate(5) == RingAllocator::kInvalid);
+    CHECK(ring.GetUsed() == 60);
+    CHECK(ring.Allocate(4) == 60);      // Exactly fills the region.
+    CHECK(ring.Allocate(1) == RingAllocator::kInvalid);
+}
+
+TEST_CASE(RingAllocatorAdvanceWrapsAndEmptiesTheRegion) {
+    RingAllocator ring(128, 3);
+    for (std::size_t expected : { 1, 2, 0, 1 }) {
+        ring.Allocate(100);
+        CHECK(ring.Advance() == expected);
+        CHECK(ring.GetRegion() == expected);
+        CHECK(ring.GetUsed() == 0);
+        CHECK(ring.Allocate(16, 16) == expected * 128);
+    }
+}
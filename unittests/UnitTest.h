@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+/**
+ * Minimal self-registering checks for the GL-free parts of the engine.
+ *
+ * TEST_CASE bodies run in registration order from UnitTestMain.cpp; CHECK failures are
+ * reported and counted without stopping the test. A test that needs an optional asset calls
+ * unittest::Skip() and returns.
+ */
+namespace unittest {
+
+    struct TestCase {
+        const char* name_;
+        void (*run_)();
+    };
+
+    std::vector<TestCase>& Registry();
+
+    struct Registrar {
+        Registrar(const char* name, void (*run)()) { Registry().push_back({ name, run }); }
+    };
+
+    void ReportFailure(const char* file, int line, const std::string& message);
+
+    /// Marks the running test as skipped (e.g. a model file is not present).
+    void Skip(const std::string& reason);
+
+    /// Directory of the repository's assets (models), set by the build.
+    std::string AssetPath(const std::string& relativePath);
+
+} // namespace unittest
+
+#define TEST_CASE(name) \
+    static void name(); \
+    static const unittest::Registrar name##Registrar_(#name, &name); \
+    static void name()
+
+#define CHECK(expr) \
+    do { \
+        if (!(expr)) { \
+            unittest::ReportFailure(__FILE__, __LINE__, #expr); \
+        } \
+    } while (0)
+
+#define CHECK_NEAR(actual, expected, tolerance) \
+    do { \
+        const double actual_ = static_cast<double>(actual); \
+        const double expected_ = static_cast<double>(expected); \
+        if (!(std::abs(actual_ - expected_) <= static_cast<double>(tolerance))) { \
+            unittest::ReportFailure(__FILE__, __LINE__, std::string(#actual) + " = " + std::to_string(actual_) + \
+                ", expected " + std::to_string(expected_) + " +/- " + std::to_string(static_cast<double>(tolerance))); \
+        } \
+    } while (0)
@@ -0,0 +1,66 @@
+#include "UnitTest.h"
+
+#include <iostream>
+
+#include "Utilities/Logger.h"
+
+namespace unittest {
+
+    namespace {
+        int failures_ = 0;
+        bool skipped_ = false;
+    }
+
+    std::vector<TestCase>& Registry() {
+        static std::vector<TestCase> tests;
+        return tests;
+    }
+
+    void ReportFailure(const char* file, int line, const std::string& message) {
+        ++failures_;
+        std::cerr << "  " << file << ":" << line << ": CHECK failed: " << message << "\n";
+    }
+
+    void Skip(const std::string& reason) {
+        skipped_ = true;
+        std::cout << "  skipped: " << reason << "\n";
+    }
+
+    std::string AssetPath(const std::string& relativePath) {
+#ifdef UNIT_TEST_ASSETS_DIR
+        return std::string(UNIT_TEST_ASSETS_DIR) + "/" + relativePath;
+#else
+        return "../assets/" + relativePath;
+#endif
+    }
+
+} // namespace unittest
+
+/// Usage: OpenGLPlaygroundTests [filter]; only tests whose name contains the filter run.
+int main(int argc, char** argv) {
+    Logger::Init();
+
+    const std::string filter = argc > 1 ? argv[1] : "";
+    int failedTests = 0;
+    std::size_t ranTests = 0;
+    for (const auto& test : unittest::Registry()) {
+        if (std::string(test.name_).find(filter) == std::string::npos) {
+            continue;
+        }
+        ++ranTests;
+        const int failuresBefore = unittest::failures_;
+        unittest::skipped_ = false;
+        std::cout << "[ RUN  ] " << test.name_ << "\n";
+        test.run_();
+        if (unittest::failures_ != failuresBefore) {
+            ++failedTests;
+            std::cout << "[ FAIL ] " << test.name_ << "\n";
+        }
+        else {
+            std::cout << (unittest::skipped_ ? "[ SKIP ] " : "[  OK  ] ") << test.name_ << "\n";
+        }
+    }
+    std::cout << ranTests << " test(s), " << failedTests << " failed.\n";
+    spdlog::shutdown();
+    return failedTests == 0 ? 0 : 1;
+}
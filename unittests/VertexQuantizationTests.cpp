@@ -0,0 +1,162 @@
+#include "UnitTest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "Graphics/Meshes/VertexQuantization.h"
+
+using namespace graphics;
+
+namespace {
+
+    constexpr float kUnorm16HalfStep = 0.5f / 65535.0f;
+
+    /// Decodes a normal the way the vertex shader sees it: snorm16 components, then OctDecode.
+    glm::vec3 RoundTripNormal(const glm::vec3& n) {
+        const glm::vec2 e = quantization::OctEncode(n);
+        const glm::vec2 q(quantization::DecodeSnorm16(quantization::EncodeSnorm16(e.x)),
+            quantization::DecodeSnorm16(quantization::EncodeSnorm16(e.y)));
+        return quantization::OctDecode(q);
+    }
+
+    float AngleDegrees(const glm::vec3& a, const glm::vec3& b) {
+        // atan2 of sine and cosine: acos of a float dot product cannot resolve tiny angles.
+        return std::atan2(glm::length(glm::cross(a, b)), glm::dot(a, b)) * 57.29578f;
+    }
+
+    /// Evenly spread unit vectors plus the axes, poles and octant seams.
+    std::vector<glm::vec3> TestDirections() {
+        std::vector<glm::vec3> dirs = {
+            { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 },
+            glm::normalize(glm::vec3(1, 1, 0)), glm::normalize(glm::vec3(-1, 1, 0)),
+            glm::normalize(glm::vec3(1, 0, -1)), glm::normalize(glm::vec3(0, -1, -1)),
+            glm::normalize(glm::vec3(1, 1, 1)), glm::normalize(glm::vec3(-1, -1, -1)),
+            glm::normalize(glm::vec3(1e-4f, 0.0f, -1.0f)), glm::normalize(glm::vec3(0.0f, -1e-4f, 1.0f)),
+        };
+        constexpr int kCount = 20000;
+        const float golden = 3.14159265f * (3.0f - std::sqrt(5.0f));
+        for (int i = 0; i < kCount; ++i) {
+            const float z = 1.0f - 2.0f * (static_cast<float>(i) + 0.5f) / kCount;
+            const float r = std::sqrt(std::max(1.0f - z * z, 0.0f));
+            const float phi = golden * static_cast<float>(i);
+            dirs.emplace_back(r * std::cos(phi), r * std::sin(phi), z);
+        }
+        return dirs;
+    }
+
+}
+
+TEST_CASE(Unorm16RoundTripIsWithinHalfAStep) {
+    float maxError = 0.0f;
+    for (int i = 0; i <= 100000; ++i) {
+        const float v = static_cast<float>(i) / 100000.0f;
+        maxError = std::max(maxError, std::abs(quantization::DecodeUnorm16(quantization::EncodeUnorm16(v)) - v));
+    }
+    CHECK(maxError <= kUnorm16HalfStep + 1e-7f);
+    CHECK(quantization::EncodeUnorm16(0.0f) == 0);
+    CHECK(quantization::EncodeUnorm16(1.0f) == 65535);
+    CHECK(quantization::EncodeUnorm16(-3.0f) == 0);     // Clamped.
+    CHECK(quantization::EncodeUnorm16(7.0f) == 65535);
+}
+
+TEST_CASE(Snorm16RoundTripMatchesGLConversion) {
+    float maxError = 0.0f;
+    for (int i = -50000; i <= 50000; ++i) {
+        const float v = static_cast<float>(i) / 50000.0f;
+        maxError = std::max(maxError, std::abs(quantization::DecodeSnorm16(quantization::EncodeSnorm16(v)) - v));
+    }
+    CHECK(maxError <= 0.5f / 32767.0f + 1e-7f);
+    CHECK(quantization::DecodeSnorm16(-32768) == -1.0f);   // GL clamps the extra negative code.
+    CHECK(quantization::DecodeSnorm16(quantization::EncodeSnorm16(1.0f)) == 1.0f);
+}
+
+TEST_CASE(PositionRoundTripIsWithinHalfAStepOfTheRange) {
+    const glm::vec3 minPos(-12.5f, 0.25f, -0.001f);
+    const glm::vec3 maxPos(40.0f, 0.75f, 0.001f);
+    const QuantizationParams q = quantization::MakeParams(minPos, maxPos, glm::vec2(0.0f), glm::vec2(1.0f));
+    glm::vec3 maxError(0.0f);
+    for (int i = 0; i <= 4096; ++i) {
+        const float t = static_cast<float>(i) / 4096.0f;
+        const glm::vec3 p = minPos + (maxPos - minPos) * glm::vec3(t, 1.0f - t, t * t);
+        for (int axis = 0; axis < 3; ++axis) {
+            const uint16_t e = quantization::EncodeRange(p[axis], q.positionOffset_[axis], q.positionScale_[axis]);
+            const float decoded = q.positionOffset_[axis] + q.positionScale_[axis] * quantization::DecodeUnorm16(e);
+            maxError[axis] = std::max(maxError[axis], std::abs(decoded - p[axis]));
+        }
+    }
+    for (int axis = 0; axis < 3; ++axis) {
+        // Half a step of the axis range, plus float rounding of the reconstruction.
+        const float bound = q.positionScale_[axis] * kUnorm16HalfStep + std::abs(maxPos[axis]) * 1e-6f;
+        CHECK(maxError[axis] <= bound);
+    }
+}
+
+TEST_CASE(DegenerateAxesKeepTheirValue) {
+    const QuantizationParams q = quantization::MakeParams(glm::vec3(1.0f, 2.0f, 3.0f), glm::vec3(1.0f, 5.0f, 3.0f),
+        glm::vec2(0.5f), glm::vec2(0.5f));
+    CHECK(q.positionScale_.x == 1.0f);
+    CHECK(q.positionScale_.z == 1.0f);
+    CHECK(q.uvScale_.x == 1.0f && q.uvScale_.y == 1.0f);
+    const uint16_t e = quantization::EncodeRange(1.0f, q.positionOffset_.x, q.positionScale_.x);
+    CHECK(q.positionOffset_.x + q.positionScale_.x * quantization::DecodeUnorm16(e) == 1.0f);
+}
+
+TEST_CASE(UVRoundTripIsWithinHalfAStepOfTheRange) {
+    // Tiled UVs outside [0, 1] are quantized over their own range.
+    const glm::vec2 minUV(-2.0f, 0.0f);
+    const glm::vec2 maxUV(6.0f, 1.0f);
+    const QuantizationParams q = quantization::MakeParams(glm::vec3(0.0f), glm::vec3(1.0f), minUV, maxUV);
+    glm::vec2 maxError(0.0f);
+    for (int i = 0; i <= 8192; ++i) {
+        const float t = static_cast<float>(i) / 8192.0f;
+        const glm::vec2 uv = minUV + (maxUV - minUV) * glm::vec2(t, 1.0f - t);
+        for (int axis = 0; axis < 2; ++axis) {
+            const uint16_t e = quantization::EncodeRange(uv[axis], q.uvOffset_[axis], q.uvScale_[axis]);
+            const float decoded = q.uvOffset_[axis] + q.uvScale_[axis] * quantization::DecodeUnorm16(e);
+            maxError[axis] = std::max(maxError[axis], std::abs(decoded - uv[axis]));
+        }
+    }
+    CHECK(maxError.x <= q.uvScale_.x * kUnorm16HalfStep + 1e-6f);
+    CHECK(maxError.y <= q.uvScale_.y * kUnorm16HalfStep + 1e-6f);
+}
+
+TEST_CASE(OctahedralNormalsStayWithinTheAngularBound) {
+    // 16-bit octahedral vectors: about 0.005 degrees worst case; 0.01 leaves room for float rounding.
+    constexpr float kMaxAngleDegrees = 0.01f;
+    float maxAngle = 0.0f;
+    for (const glm::vec3& n : TestDirections()) {
+        const glm::vec3 decoded = RoundTripNormal(n);
+        CHECK_NEAR(glm::length(decoded), 1.0f, 1e-5f);
+        maxAngle = std::max(maxAngle, AngleDegrees(n, decoded));
+    }
+    CHECK(maxAngle <= kMaxAngleDegrees);
+    std::printf("  max angular error %.5f degrees\n", maxAngle);
+}
+
+TEST_CASE(OctahedralAxesAndPolesAreExact) {
+    // +Z is the octahedron's centre and -Z its folded corners: both must survive exactly.
+    const glm::vec3 axes[] = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+    for (const glm::vec3& axis : axes) {
+        const glm::vec3 decoded = RoundTripNormal(axis);
+        CHECK(AngleDegrees(axis, decoded) < 1e-3f);
+    }
+    const glm::vec2 minusZ = quantization::OctEncode(glm::vec3(0.0f, 0.0f, -1.0f));
+    CHECK(std::abs(minusZ.x) == 1.0f && std::abs(minusZ.y) == 1.0f);
+    CHECK(quantization::OctDecode(glm::vec2(0.0f)) == glm::vec3(0.0f, 0.0f, 1.0f));
+}
+
+TEST_CASE(OctahedralTangentsKeepTheirSign) {
+    // Tangents use the same encoding; a near-pole tangent must not flip hemisphere.
+    const glm::vec3 tangents[] = {
+        glm::normalize(glm::vec3(1e-3f, 0.0f, -1.0f)), glm::normalize(glm::vec3(-1e-3f, 1e-3f, -1.0f)),
+        glm::normalize(glm::vec3(0.0f, 1e-3f, 1.0f)), glm::normalize(glm::vec3(0.7f, -0.7f, -1e-4f)),
+    };
+    for (const glm::vec3& t : tangents) {
+        const glm::vec3 decoded = RoundTripNormal(t);
+        CHECK(glm::dot(t, decoded) > 0.9999f);
+        CHECK((decoded.z < 0.0f) == (t.z < 0.0f) || std::abs(t.z) < 1e-3f);
+    }
+}
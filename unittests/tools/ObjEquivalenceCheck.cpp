@@ -0,0 +1,225 @@
+/**
+ * Compares the native ObjImporter with the Assimp path of ModelLoader on OBJ files.
+ *
+ * Both importers run with the settings ModelLoader uses (Assimp: the same post-processing
+ * flags; native: smooth normals for corners without 'vn'). Meshes are compared per material
+ * (mesh count, unique vertices, triangles, position bounds) and, where both sides produced
+ * the same meshes, one by one. Usage: ObjEquivalenceCheck [file.obj ...]; without arguments
+ * the repository's bunny, dragon and pig models are checked.
+ *
+ * Exit codes: 0 equivalent, 1 differences found, 77 no input file exists (ctest skip).
+ */
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include "Graphics/Meshes/ObjImporter.h"
+#include "Utilities/Logger.h"
+
+using namespace StaticLoader;
+
+namespace {
+
+    constexpr int kSkipped = 77;
+
+    struct MeshSummary {
+        std::size_t meshes_ = 0;
+        std::size_t vertices_ = 0;
+        std::size_t triangles_ = 0;
+        glm::vec3 min_ = glm::vec3(FLT_MAX);
+        glm::vec3 max_ = glm::vec3(-FLT_MAX);
+
+        void Add(std::size_t vertices, std::size_t triangles, const glm::vec3& min, const glm::vec3& max) {
+            ++meshes_;
+            vertices_ += vertices;
+            triangles_ += triangles;
+            min_ = glm::min(min_, min);
+            max_ = glm::max(max_, max);
+        }
+    };
+
+    struct ModelSummary {
+        std::vector<MeshSummary> meshes_;               ///< In importer order.
+        std::vector<std::string> meshMaterials_;        ///< Parallel to meshes_.
+        std::map<std::string, MeshSummary> materials_;  ///< Per material name.
+    };
+
+    template<typename PositionAt>
+    void Bounds(std::size_t count, PositionAt positionAt, glm::vec3& min, glm::vec3& max) {
+        min = glm::vec3(FLT_MAX);
+        max = glm::vec3(-FLT_MAX);
+        for (std::size_t i = 0; i < count; ++i) {
+            min = glm::min(min, positionAt(i));
+            max = glm::max(max, positionAt(i));
+        }
+    }
+
+    void AddMesh(ModelSummary& model, const std::string& material, std::size_t vertices, std::size_t triangles,
+        const glm::vec3& min, const glm::vec3& max)
+    {
+        MeshSummary mesh;
+        mesh.Add(vertices, triangles, min, max);
+        model.meshes_.push_back(mesh);
+        model.meshMaterials_.push_back(material);
+        model.materials_[material].Add(vertices, triangles, min, max);
+    }
+
+    bool SummarizeNative(const std::filesystem::path& path, ModelSummary& out) {
+        ObjImportSettings settings;
+        settings.generateNormals_ = true;
+        ObjModel model;
+        if (!ObjImporter(settings).Import(path, model)) {
+            return false;
+        }
+        for (const auto& mesh : model.meshes_) {
+            glm::vec3 min, max;
+            Bounds(mesh.positions_.size(), [&](std::size_t i) { return mesh.positions_[i]; }, min, max);
+            AddMesh(out, model.materials_[mesh.materialSlot_].name_, mesh.positions_.size(), mesh.indices_.size() / 3, min, max);
+        }
+        return true;
+    }
+
+    bool SummarizeAssimp(const std::filesystem::path& path, ModelSummary& out) {
+        // Same flags as ModelLoader::LoadStaticModel with normals requested.
+        Assimp::Importer importer;
+        const aiScene* scene = importer.ReadFile(path.string(), aiProcess_JoinIdenticalVertices |
+            aiProcess_Triangulate |
+            aiProcess_RemoveRedundantMaterials |
+            aiProcess_FindInvalidData |
+            aiProcess_OptimizeMeshes |
+            aiProcess_GenSmoothNormals);
+        if (!scene || !scene->mRootNode) {
+            std::fprintf(stderr, "  Assimp: %s\n", importer.GetErrorString());
+            return false;
+        }
+        for (unsigned m = 0; m < scene->mNumMeshes; ++m) {
+            const aiMesh* mesh = scene->mMeshes[m];
+            std::size_t triangles = 0;
+            for (unsigned f = 0; f < mesh->mNumFaces; ++f) {
+                triangles += mesh->mFaces[f].mNumIndices == 3 ? 1 : 0;
+            }
+            glm::vec3 min, max;
+            Bounds(mesh->mNumVertices, [&](std::size_t i) {
+                const aiVector3D& v = mesh->mVertices[i];
+                return glm::vec3(v.x, v.y, v.z);
+                }, min, max);
+            aiString name;
+            scene->mMaterials[mesh->mMaterialIndex]->Get(AI_MATKEY_NAME, name);
+            AddMesh(out, name.C_Str(), mesh->mNumVertices, triangles, min, max);
+        }
+        return true;
+    }
+
+    /// Relative to the model's extent, so the tolerance does not depend on its scale.
+    bool SameBounds(const MeshSummary& a, const MeshSummary& b, float extent) {
+        const float tolerance = std::max(extent, 1.0f) * 1e-5f;
+        for (int axis = 0; axis < 3; ++axis) {
+            if (std::abs(a.min_[axis] - b.min_[axis]) > tolerance || std::abs(a.max_[axis] - b.max_[axis]) > tolerance) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int Compare(const std::string& label, const MeshSummary& native, const MeshSummary& assimp, float extent) {
+        int differences = 0;
+        auto report = [&](const char* what, std::size_t a, std::size_t b) {
+            if (a != b) {
+                std::printf("  %s: %s native=%zu assimp=%zu\n", label.c_str(), what, a, b);
+                ++differences;
+            }
+            };
+        report("meshes", native.meshes_, assimp.meshes_);
+        report("vertices", native.vertices_, assimp.vertices_);
+        report("triangles", native.triangles_, assimp.triangles_);
+        if (!SameBounds(native, assimp, extent)) {
+            std::printf("  %s: bounds differ\n", label.c_str());
+            ++differences;
+        }
+        return differences;
+    }
+
+    int CheckFile(const std::filesystem::path& path) {
+        ModelSummary native, assimp;
+        if (!SummarizeNative(path, native) || !SummarizeAssimp(path, assimp)) {
+            std::printf("  import failed\n");
+            return 1;
+        }
+
+        MeshSummary whole;
+        for (const auto& mesh : assimp.meshes_) {
+            whole.Add(mesh.vertices_, mesh.triangles_, mesh.min_, mesh.max_);
+        }
+        const glm::vec3 size = whole.max_ - whole.min_;
+        const float extent = std::max({ size.x, size.y, size.z });
+
+        int differences = 0;
+        for (const auto& [material, summary] : assimp.materials_) {
+            const auto it = native.materials_.find(material);
+            if (it == native.materials_.end()) {
+                std::printf("  material '%s': missing from the native import\n", material.c_str());
+                ++differences;
+                continue;
+            }
+            differences += Compare("material '" + material + "'", it->second, summary, extent);
+        }
+        for (const auto& [material, summary] : native.materials_) {
+            if (!assimp.materials_.contains(material)) {
+                std::printf("  material '%s': missing from the Assimp import\n", material.c_str());
+                ++differences;
+            }
+        }
+
+        // Per mesh, when both importers produced the same meshes in the same order.
+        if (native.meshMaterials_ == assimp.meshMaterials_) {
+            for (std::size_t m = 0; m < native.meshes_.size(); ++m) {
+                differences += Compare("mesh " + std::to_string(m), native.meshes_[m], assimp.meshes_[m], extent);
+            }
+        }
+        std::printf("  %zu mesh(es), %zu vertices, %zu triangles (Assimp): %s\n", assimp.meshes_.size(),
+            whole.vertices_, whole.triangles_, differences == 0 ? "equivalent" : "DIFFERENT");
+        return differences == 0 ? 0 : 1;
+    }
+
+}
+
+int main(int argc, char** argv) {
+    Logger::Init();
+
+    std::vector<std::filesystem::path> files;
+    for (int i = 1; i < argc; ++i) {
+        files.emplace_back(argv[i]);
+    }
+    if (files.empty()) {
+        const std::filesystem::path objs = std::filesystem::path(UNIT_TEST_ASSETS_DIR) / "Objs";
+        files = { objs / "bunny.obj", objs / "dragon.obj", objs / "pig_triangulated.obj" };
+    }
+
+    int checked = 0;
+    int failed = 0;
+    for (const auto& file : files) {
+        std::printf("%s\n", file.string().c_str());
+        if (!std::filesystem::exists(file)) {
+            std::printf("  not found, skipped\n");
+            continue;
+        }
+        ++checked;
+        failed += CheckFile(file);
+    }
+    spdlog::shutdown();
+    if (checked == 0) {
+        return kSkipped;
+    }
+    std::printf("%d of %d file(s) differ.\n", failed, checked);
+    return failed == 0 ? 0 : 1;
+}